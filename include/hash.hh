@@ -23,4 +23,28 @@ namespace Hash {
     static constexpr std::uint32_t FNV1a(std::string_view str) {
         return FNV1a(str.data(), str.size());
     }
+
+    /**
+     * Calculates the 64bit FNV1a hash of a buffer, iteratively so that it can be used on large inputs at runtime.
+     * @param str Buffer to be hashed
+     * @param n Length of the buffer.
+     * @param hash Hash to continue from, allows hashing several buffers in sequence.
+     * @return Calculated hash of the buffer
+     */
+    static constexpr std::uint64_t FNV1a_64(const char* str, std::size_t n, std::uint64_t hash = UINT64_C(14695981039346656037)) {
+        for (std::size_t i = 0; i < n; i++) {
+            hash = (hash ^ static_cast<unsigned char>(str[i])) * UINT64_C(1099511628211);
+        }
+        return hash;
+    }
+
+    /**
+     * Calculates the 64bit FNV1a hash of a std::string_view.
+     * @param str String to be hashed
+     * @param hash Hash to continue from, allows hashing several strings in sequence.
+     * @return Calculated hash of the string
+     */
+    static constexpr std::uint64_t FNV1a_64(std::string_view str, std::uint64_t hash = UINT64_C(14695981039346656037)) {
+        return FNV1a_64(str.data(), str.size(), hash);
+    }
 }
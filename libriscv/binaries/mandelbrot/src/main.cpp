@@ -0,0 +1,41 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "png.hpp"
+#include "mandelbrot.cpp"
+
+// The program from the PNG unit test, as a standalone benchmark:
+// Draws and encodes the mandelbrot set a number of times.
+// Usage: mandelbrot [frames] [output.png]
+int main(int argc, char** argv)
+{
+	constexpr size_t W = 512;
+	constexpr size_t H = 512;
+	const int frames = (argc > 1) ? atoi(argv[1]) : 8;
+
+	std::vector<uint8_t> png;
+	for (int counter = 0; counter < frames; counter++)
+	{
+		const double factor = powf(2.0, counter * -0.1);
+		const double x1 = -1.5;
+		const double x2 =  2.0 * factor;
+		const double y1 = -1.0 * factor;
+		const double y2 =  2.0 * factor;
+
+		auto bitmap = fractal<W, H, 120> (x1, y1, x2, y2);
+		auto* data = (const uint8_t *)bitmap.data();
+
+		png = encode(W, H, data);
+	}
+	printf("Encoded %d frames, last PNG is %zu bytes\n", frames, png.size());
+
+	if (argc > 2) {
+		FILE* fp = fopen(argv[2], "wb");
+		if (fp == nullptr)
+			return 1;
+		fwrite(png.data(), 1, png.size(), fp);
+		fclose(fp);
+	}
+	return 0;
+}
@@ -0,0 +1,142 @@
+#!/usr/bin/env bash
+set -e
+
+# Builds the emulator once per dispatch mode and runs the same
+# workloads on each of them, collecting the results as JSON.
+MODES="switch threaded tailcall bintr tcc"
+WORKLOADS="fib stream crc32 mandelbrot"
+OUTPUT="bench.json"
+BUILD_GUESTS=false
+BINARIES=$(realpath ../binaries)
+
+function usage()
+{
+   progname=$(basename $0)
+   cat << HEREDOC
+
+   Usage: $progname [options]
+
+   optional arguments:
+     -h, --help           show this help message and exit
+     -m, --modes list     dispatch modes to benchmark (default: "$MODES")
+     -w, --workloads list workloads to run (default: "$WORKLOADS")
+     -o, --output file    write the JSON results to file (default: $OUTPUT)
+     --build-guests       build the guest programs with their build scripts first
+     -v, --verbose        increase the verbosity of the bash script
+
+   dispatch modes:
+     switch               switch-based bytecode dispatch (RISCV_THREADED=OFF)
+     threaded             threaded dispatch (RISCV_THREADED=ON)
+     tailcall             tail-call dispatch (RISCV_TAILCALL_DISPATCH=ON, requires clang)
+     bintr                binary translation using the system compiler
+     tcc                  binary translation using libtcc
+
+HEREDOC
+}
+
+while [[ "$#" -gt 0 ]]; do
+    case $1 in
+		-h|--help ) usage; exit; ;;
+		-m|--modes) MODES="$2"; shift ;;
+		-w|--workloads) WORKLOADS="$2"; shift ;;
+		-o|--output) OUTPUT="$2"; shift ;;
+		--build-guests) BUILD_GUESTS=true ;;
+		-v|--verbose ) set -x ;;
+		*) echo "Unknown parameter passed: $1"; exit 1 ;;
+    esac
+    shift
+done
+
+function mode_options()
+{
+	local COMMON="-DCMAKE_BUILD_TYPE=Release -DRISCV_32I=ON -DRISCV_64I=ON"
+	case $1 in
+		switch)   echo "$COMMON -DRISCV_THREADED=OFF -DRISCV_TAILCALL_DISPATCH=OFF -DRISCV_BINARY_TRANSLATION=OFF" ;;
+		threaded) echo "$COMMON -DRISCV_THREADED=ON -DRISCV_TAILCALL_DISPATCH=OFF -DRISCV_BINARY_TRANSLATION=OFF" ;;
+		tailcall) echo "$COMMON -DRISCV_TAILCALL_DISPATCH=ON -DRISCV_BINARY_TRANSLATION=OFF" ;;
+		bintr)    echo "$COMMON -DRISCV_THREADED=ON -DRISCV_BINARY_TRANSLATION=ON -DRISCV_LIBTCC=OFF" ;;
+		tcc)      echo "$COMMON -DRISCV_THREADED=ON -DRISCV_BINARY_TRANSLATION=ON -DRISCV_LIBTCC=ON" ;;
+		*) echo "Unknown dispatch mode: $1" >&2; exit 1 ;;
+	esac
+}
+
+# The guest program and its arguments
+function workload_command()
+{
+	case $1 in
+		fib)        echo "$BINARIES/measure_mips/fib" ;;
+		stream)     echo "$BINARIES/STREAM/build/stream" ;;
+		crc32)      echo "$BINARIES/crc32/.build/crc32" ;;
+		mandelbrot) echo "$BINARIES/mandelbrot/build/mandelbrot 8" ;;
+		*) echo "Unknown workload: $1" >&2; exit 1 ;;
+	esac
+}
+
+function build_guest()
+{
+	case $1 in
+		fib)        (cd $BINARIES/measure_mips && ./build32.sh) ;;
+		stream)     (cd $BINARIES/STREAM && ./build.sh) ;;
+		crc32)      (cd $BINARIES/crc32 && ./build.sh) ;;
+		mandelbrot) (cd $BINARIES/mandelbrot && ./build.sh) ;;
+	esac
+}
+
+if [ "$BUILD_GUESTS" = true ]; then
+	for workload in $WORKLOADS; do
+		build_guest $workload
+	done
+fi
+
+RESULTS=()
+for mode in $MODES; do
+	if [ "$mode" = "tailcall" ]; then
+		# Tail-call dispatch is only available with clang
+		if ! command -v clang++ > /dev/null; then
+			echo "Skipping $mode: clang++ was not found" >&2
+			continue
+		fi
+		BUILD_ENV="CC=clang CXX=clang++"
+	else
+		BUILD_ENV=""
+	fi
+
+	BUILD_DIR=.bench/$mode
+	mkdir -p $BUILD_DIR
+	pushd $BUILD_DIR > /dev/null
+	env $BUILD_ENV cmake ../.. $(mode_options $mode) > /dev/null
+	make -j6 rvlinux > /dev/null
+	popd > /dev/null
+
+	for workload in $WORKLOADS; do
+		COMMAND=($(workload_command $workload))
+		if [ ! -f "${COMMAND[0]}" ]; then
+			echo "Skipping $workload: ${COMMAND[0]} was not found (use --build-guests)" >&2
+			continue
+		fi
+		METRICS=$BUILD_DIR/$workload.json
+		rm -f $METRICS
+		echo "* Running $workload with $mode dispatch" >&2
+		# Accurate instruction counting is needed to measure MIPS
+		$BUILD_DIR/rvlinux --accurate --fuel 0 --silent --metrics $METRICS "${COMMAND[@]}" > /dev/null
+		if [ ! -f $METRICS ]; then
+			echo "Error: $workload with $mode dispatch produced no metrics" >&2
+			exit 1
+		fi
+		# Prepend the mode and workload to the object from --metrics
+		RESULTS+=("$(sed "s/^{/{\"mode\": \"$mode\", \"workload\": \"$workload\", /" $METRICS)")
+	done
+done
+
+{
+	echo "["
+	for i in "${!RESULTS[@]}"; do
+		if [ $i -lt $((${#RESULTS[@]} - 1)) ]; then
+			echo "  ${RESULTS[$i]},"
+		else
+			echo "  ${RESULTS[$i]}"
+		fi
+	done
+	echo "]"
+} > $OUTPUT
+echo "Results for ${#RESULTS[@]} runs were written to $OUTPUT" >&2
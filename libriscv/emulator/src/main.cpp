@@ -1,5 +1,6 @@
 #include <libriscv/machine.hpp>
 #include <libriscv/debug.hpp>
+#include <libriscv/profiler.hpp>
 #include <libriscv/rsp_server.hpp>
 #include <inttypes.h>
 #include <chrono>
@@ -11,6 +12,7 @@
 #if defined(__linux__)
 #include <sys/stat.h>
 #include <sys/mman.h>
+#include <sys/resource.h>
 #endif
 static inline std::vector<uint8_t> load_file(const std::string &);
 static constexpr uint64_t MAX_MEMORY = (riscv::encompassing_Nbit_arena == 0) ? uint64_t(4000) << 20 : uint64_t(1) << riscv::encompassing_Nbit_arena;
@@ -37,11 +39,18 @@ struct Arguments {
 	bool ignore_text = false;
 	bool background = false; // Run binary translation in background thread
 	bool proxy_mode = false;  // Proxy mode for system calls
+	bool zero_copy = false;   // Share program pages with the ELF file mapping
 	uint64_t fuel = 30'000'000'000ULL; // Default: Timeout after ~30bn instructions
+	unsigned hot_threshold = 0; // Default: Translate everything up front
+	unsigned compile_jobs = 0;  // Default: One compiler per hardware thread
 	std::vector<std::string> allowed_files;
 	std::string output_file;
 	std::string call_function;
 	std::string jump_hints_file;
+	std::string decoder_snapshot_dir;
+	std::string profile_file;
+	std::string bytecode_file;
+	std::string metrics_file;
 };
 
 #ifdef HAVE_GETOPT_LONG
@@ -64,6 +73,8 @@ static const struct option long_options[] = {
 	{"translate-regcache", no_argument, 0, 'R'},
 	{"jump-hints", required_argument, 0, 'J'},
 	{"background", no_argument, 0, 'B'},
+	{"hot", required_argument, 0, 'H'},
+	{"jobs", required_argument, 0, 'j'},
 	{"mingw", no_argument, 0, 'm'},
 	{"output", required_argument, 0, 'o'},
 	{"from-start", no_argument, 0, 'F'},
@@ -73,6 +84,11 @@ static const struct option long_options[] = {
 	{"execute-only", no_argument, 0, 'X'},
 	{"ignore-text", no_argument, 0, 'I'},
 	{"call", required_argument, 0, 'c'},
+	{"decoder-snapshots", required_argument, 0, 'D'},
+	{"profile", required_argument, 0, 'p'},
+	{"bytecodes", required_argument, 0, 'b'},
+	{"zero-copy", no_argument, 0, 'z'},
+	{"metrics", required_argument, 0, 'M'},
 	{0, 0, 0, 0}
 };
 
@@ -96,6 +112,8 @@ static void print_help(const char* name)
 		"  -R, --translate-regcache Enable register caching in binary translator\n"
 		"  -J, --jump-hints file  Load jump location hints from file, unless empty then record instead\n"
 		"  -B  --background   Run binary translation in background thread\n"
+		"  -H, --hot samples  Tiered translation: only translate code once it has been sampled this often\n"
+		"  -j, --jobs n       Compile the binary translation in n parallel parts\n"
 		"  -m, --mingw        Cross-compile for Windows (MinGW)\n"
 		"  -o, --output file  Output embeddable binary translated code (C99)\n"
 		"  -F, --from-start   Start debugger from the beginning (_start)\n"
@@ -105,6 +123,11 @@ static void print_help(const char* name)
 		"  -X, --execute-only Enforce execute-only segments (no read/write)\n"
 		"  -I, --ignore-text  Ignore .text section, and use segments only\n"
 		"  -c, --call func    Call a function after loading the program\n"
+		"  -D, --decoder-snapshots dir  Store and reuse decoded execute segments in dir\n"
+		"  -p, --profile file Sample the guest call stacks and write them as folded stacks to file\n"
+		"  -b, --bytecodes file  Write the recorded bytecode sequences to file (for superinstructions)\n"
+		"  -z, --zero-copy    Share the program pages with the ELF file mapping (disables the memory arena)\n"
+		"  -M, --metrics file Write startup time, runtime, instruction count and peak RSS to file as JSON\n"
 		"\n"
 	);
 	printf("libriscv is compiled with:\n"
@@ -144,6 +167,9 @@ static void print_help(const char* name)
 #endif
 #ifdef RISCV_TIMED_VMCALLS
 		"-  Timed VM calls are enabled (experimental)\n"
+#endif
+#ifdef RISCV_RECORD_BYTECODES
+		"-  Bytecode sequence recording is enabled\n"
 #endif
 		"\n"
 	);
@@ -152,7 +178,7 @@ static void print_help(const char* name)
 static int parse_arguments(int argc, const char** argv, Arguments& args)
 {
 	int c;
-	while ((c = getopt_long(argc, (char**)argv, "hvQad1f:gstTnNRJ:Bmo:FSPA:XIc:", long_options, nullptr)) != -1)
+	while ((c = getopt_long(argc, (char**)argv, "hvQad1f:gstTnNRJ:BH:j:mo:FSPA:XIc:D:p:b:zM:", long_options, nullptr)) != -1)
 	{
 		switch (c)
 		{
@@ -172,6 +198,8 @@ static int parse_arguments(int argc, const char** argv, Arguments& args)
 			case 'R': args.translate_regcache = true; break;
 			case 'J': break;
 			case 'B': args.background = true; break;
+			case 'H': break;
+			case 'j': break;
 			case 'm': args.mingw = true; break;
 			case 'o': break;
 			case 'F': args.from_start = true; break;
@@ -181,6 +209,11 @@ static int parse_arguments(int argc, const char** argv, Arguments& args)
 			case 'X': args.execute_only = true; break;
 			case 'I': args.ignore_text = true; break;
 			case 'c': break;
+			case 'D': break;
+			case 'p': break;
+			case 'b': break;
+			case 'z': args.zero_copy = true; break;
+			case 'M': break;
 			default:
 				fprintf(stderr, "Unknown option: %c\n", c);
 				return -1;
@@ -199,6 +232,26 @@ static int parse_arguments(int argc, const char** argv, Arguments& args)
 			if (args.verbose) {
 				printf("* Fuel set to %" PRIu64 "\n", args.fuel);
 			}
+		} else if (c == 'H') {
+			char* endptr;
+			args.hot_threshold = strtoul(optarg, &endptr, 10);
+			if (*endptr != '\0') {
+				fprintf(stderr, "Invalid number: %s\n", optarg);
+				return -1;
+			}
+			if (args.verbose) {
+				printf("* Tiered translation after %u samples\n", args.hot_threshold);
+			}
+		} else if (c == 'j') {
+			char* endptr;
+			args.compile_jobs = strtoul(optarg, &endptr, 10);
+			if (*endptr != '\0') {
+				fprintf(stderr, "Invalid number: %s\n", optarg);
+				return -1;
+			}
+			if (args.verbose) {
+				printf("* Translation compiler jobs: %u\n", args.compile_jobs);
+			}
 		} else if (c == 'o') {
 			args.output_file = optarg;
 			if (args.verbose) {
@@ -209,6 +262,26 @@ static int parse_arguments(int argc, const char** argv, Arguments& args)
 			if (args.verbose) {
 				printf("* Function to VMCall: %s\n", args.call_function.c_str());
 			}
+		} else if (c == 'D') {
+			args.decoder_snapshot_dir = optarg;
+			if (args.verbose) {
+				printf("* Decoder snapshot directory: %s\n", args.decoder_snapshot_dir.c_str());
+			}
+		} else if (c == 'p') {
+			args.profile_file = optarg;
+			if (args.verbose) {
+				printf("* Profile output file: %s\n", args.profile_file.c_str());
+			}
+		} else if (c == 'b') {
+			args.bytecode_file = optarg;
+			if (args.verbose) {
+				printf("* Bytecode sequence output file: %s\n", args.bytecode_file.c_str());
+			}
+		} else if (c == 'M') {
+			args.metrics_file = optarg;
+			if (args.verbose) {
+				printf("* Metrics output file: %s\n", args.metrics_file.c_str());
+			}
 		} else if (c == 'J') {
 			args.jump_hints_file = optarg;
 			if (args.verbose) {
@@ -252,10 +325,13 @@ static void run_program(
 
 	auto options = std::make_shared<riscv::MachineOptions<W>>(riscv::MachineOptions<W>{
 		.memory_max = MAX_MEMORY,
+		.zero_copy_segments = cli_args.zero_copy,
 		.enforce_exec_only = cli_args.execute_only,
 		.ignore_text_section = cli_args.ignore_text,
 		.verbose_loader = cli_args.verbose,
+		.use_memory_arena = !cli_args.zero_copy,
 		.use_shared_execute_segments = false, // We are only creating one machine, disabling this can enable some optimizations
+		.decoder_snapshot_dir = cli_args.decoder_snapshot_dir,
 #ifdef NODEJS_WORKAROUND
 		.ebreak_locations = {
 			"pthread_rwlock_rdlock", "pthread_rwlock_wrlock" // Live-patch locations
@@ -266,7 +342,7 @@ static void run_program(
 		.translate_future_segments = cli_args.translate_future,
 		.translate_trace = cli_args.trace,
 		.translate_timing = cli_args.timing,
-		.translate_ignore_instruction_limit = !cli_args.accurate, // Press Ctrl+C to stop
+		.translate_ignore_instruction_limit = !cli_args.accurate && cli_args.profile_file.empty(), // Press Ctrl+C to stop
 		.translate_use_register_caching = cli_args.translate_regcache,
 		.record_slowpaths_to_jump_hints = !cli_args.jump_hints_file.empty(),
 #ifdef _WIN32
@@ -274,19 +350,24 @@ static void run_program(
 		.translation_suffix = ".dll",
 #else
 		.translator_jump_hints = load_jump_hints<W>(cli_args.jump_hints_file, cli_args.verbose),
+		.translate_hot_threshold = cli_args.hot_threshold,
 		.translate_background_callback = cli_args.background ?
 			[] (auto& compilation_step) {
 				std::thread([compilation_step = std::move(compilation_step)] {
 					compilation_step();
 				}).detach();
 			} : std::function<void(std::function<void()>&)>(nullptr),
+		.translate_compile_jobs = cli_args.compile_jobs,
 		.cross_compile = cc,
 #endif
 #endif
 	});
 
 	// Create a RISC-V machine with the binary as input program
+	// The startup time includes decoding and binary translation
+	auto startup_t0 = std::chrono::high_resolution_clock::now();
 	riscv::Machine<W> machine { binary, *options };
+	std::chrono::duration<double> startup = std::chrono::high_resolution_clock::now() - startup_t0;
 
 	// Remember the options for later in case background compilation is enabled,
 	// if new execute segments need to be decoded and so on. Basically all future
@@ -500,6 +581,12 @@ static void run_program(
 		}
 	}
 
+	std::shared_ptr<riscv::Profiler<W>> profiler = nullptr;
+	if (!cli_args.profile_file.empty()) {
+		profiler = std::make_shared<riscv::Profiler<W>>();
+		machine.set_profiler(profiler);
+	}
+
 	auto t0 = std::chrono::high_resolution_clock::now();
 	try {
 		// If you run the emulator with --gdb or GDB=1, you can connect
@@ -550,7 +637,8 @@ static void run_program(
 #endif // NODEJS_WORKAROUND
 
 			// Normal RISC-V simulation
-			if (cli_args.accurate)
+			// Tiered translation and the profiler sample between instruction counter slices
+			if (cli_args.accurate || cli_args.hot_threshold > 0 || profiler != nullptr)
 				machine.simulate(cli_args.fuel);
 			else {
 #ifdef RISCV_TIMED_VMCALLS
@@ -612,6 +700,56 @@ static void run_program(
 			machine.memory.memory_usage_total() / uint64_t(1024));
 	}
 
+	if (!cli_args.metrics_file.empty()) {
+		// Used by bench.sh to compare dispatch modes and binary translation
+		FILE* f = fopen(cli_args.metrics_file.c_str(), "w");
+		if (f == nullptr) {
+			fprintf(stderr, "Error: Could not write metrics to %s\n", cli_args.metrics_file.c_str());
+		} else {
+			const uint64_t instructions = cli_args.accurate ? machine.instruction_counter() : 0;
+			long max_rss_kb = 0;
+#if defined(__linux__)
+			struct rusage usage;
+			if (getrusage(RUSAGE_SELF, &usage) == 0)
+				max_rss_kb = usage.ru_maxrss;
+#endif
+			fprintf(f, "{\"program\": \"%s\", \"binary_translation\": %s, \"libtcc\": %s, "
+				"\"exit_code\": %" PRId64 ", \"startup_ms\": %.3f, \"runtime_ms\": %.3f, "
+				"\"instructions\": %" PRIu64 ", \"mips\": %.1f, \"max_rss_kb\": %ld}\n",
+				args.at(0).c_str(),
+				(riscv::binary_translation_enabled && !cli_args.no_translate) ? "true" : "false",
+				riscv::libtcc_enabled ? "true" : "false",
+				int64_t(machine.return_value()),
+				startup.count()*1000.0, runtime.count()*1000.0,
+				instructions, instructions / (runtime.count() * 1e6),
+				max_rss_kb);
+			fclose(f);
+		}
+	}
+
+	if (profiler != nullptr) {
+		FILE* f = fopen(cli_args.profile_file.c_str(), "w");
+		if (f == nullptr || !profiler->write_folded(machine.memory, f)) {
+			fprintf(stderr, "Error: Could not write profile to %s\n", cli_args.profile_file.c_str());
+		} else if (!cli_args.silent) {
+			printf("Profile: %" PRIu64 " samples (%" PRIu64 " translated, %" PRIu64 " dropped) written to %s\n",
+				profiler->samples(), profiler->translated_samples(), profiler->dropped_samples(),
+				cli_args.profile_file.c_str());
+		}
+		if (f != nullptr)
+			fclose(f);
+	}
+
+	if (!cli_args.bytecode_file.empty()) {
+		FILE* f = riscv::bytecode_recording_enabled ? fopen(cli_args.bytecode_file.c_str(), "w") : nullptr;
+		if (f == nullptr || !riscv::write_bytecode_profile(f)) {
+			fprintf(stderr, "Error: Could not write bytecode sequences to %s%s\n", cli_args.bytecode_file.c_str(),
+				riscv::bytecode_recording_enabled ? "" : " (build with RISCV_RECORD_BYTECODES)");
+		}
+		if (f != nullptr)
+			fclose(f);
+	}
+
 	if (!cli_args.call_function.empty())
 	{
 		auto addr = machine.address_of(cli_args.call_function);
@@ -884,3 +884,6 @@ INSTRUCTION(RV32I_BC_LIVEPATCH, execute_livepatch) {
 	}
 	EXECUTE_CURRENT();
 }
+
+/** Superinstructions, generated from a profile **/
+#include "bytecode_superinstructions.cpp"
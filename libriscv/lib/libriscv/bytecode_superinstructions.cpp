@@ -0,0 +1,500 @@
+/**
+ * Generated by scripts/superinstructions.py from superinstructions.profile.
+ * Do not edit, regenerate with the generate_superinstructions target.
+**/
+INSTRUCTION(RV32I_BC_FUSED_ADDI_OP_ADD_MV, fused_addi_op_add_mv) {
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		REG(fi.get_rs1()) =
+			REG(fi.get_rs2()) + fi.signed_imm();
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_OP_ADD);
+	{
+		OP_INSTR();
+		dst = src1 + src2;
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_MV);
+	{
+		VIEW_INSTR_AS(fi, FasterMove);
+		REG(fi.get_rd()) = REG(fi.get_rs1());
+		NEXT_INSTR();
+	}
+}
+#if defined(RISCV_64I)
+INSTRUCTION(RV32I_BC_FUSED_LDD_LDD, fused_ldd_ldd) {
+	if constexpr (W >= 8) {
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr = REG(fi.get_rs2()) + fi.signed_imm();
+			REG(fi.get_rs1()) =
+				(int64_t)CPU().memory().template read<uint64_t>(addr);
+		}
+		NEXT_FUSED_INSTR(RV32I_BC_LDD);
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr = REG(fi.get_rs2()) + fi.signed_imm();
+			REG(fi.get_rs1()) =
+				(int64_t)CPU().memory().template read<uint64_t>(addr);
+			NEXT_INSTR();
+		}
+	}
+	else UNUSED_FUNCTION();
+}
+#endif
+#if defined(RISCV_64I)
+INSTRUCTION(RV32I_BC_FUSED_STD_STD_STD, fused_std_std_std) {
+	if constexpr (W >= 8) {
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr  = REG(fi.get_rs1()) + fi.signed_imm();
+			CPU().memory().template write<uint64_t>(addr, REG(fi.get_rs2()));
+		}
+		NEXT_FUSED_INSTR(RV32I_BC_STD);
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr  = REG(fi.get_rs1()) + fi.signed_imm();
+			CPU().memory().template write<uint64_t>(addr, REG(fi.get_rs2()));
+		}
+		NEXT_FUSED_INSTR(RV32I_BC_STD);
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr  = REG(fi.get_rs1()) + fi.signed_imm();
+			CPU().memory().template write<uint64_t>(addr, REG(fi.get_rs2()));
+			NEXT_INSTR();
+		}
+	}
+	else UNUSED_FUNCTION();
+}
+#endif
+#if defined(RISCV_EXT_COMPRESSED)
+INSTRUCTION(RV32I_BC_FUSED_C_STD_C_STD_C_STD, fused_c_std_c_std_c_std) {
+	if constexpr (W >= 8) {
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr = REG(fi.get_rs1()) + fi.signed_imm();
+			CPU().memory().template write<uint64_t>(addr, REG(fi.get_rs2()));
+		}
+		NEXT_FUSED_C_INSTR(RV32C_BC_STD);
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr = REG(fi.get_rs1()) + fi.signed_imm();
+			CPU().memory().template write<uint64_t>(addr, REG(fi.get_rs2()));
+		}
+		NEXT_FUSED_C_INSTR(RV32C_BC_STD);
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr = REG(fi.get_rs1()) + fi.signed_imm();
+			CPU().memory().template write<uint64_t>(addr, REG(fi.get_rs2()));
+			NEXT_C_INSTR();
+		}
+	}
+	else UNUSED_FUNCTION();
+}
+#endif
+INSTRUCTION(RV32I_BC_FUSED_LDBU_SLLI_OP_OR, fused_ldbu_slli_op_or) {
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		const auto addr = REG(fi.get_rs2()) + fi.signed_imm();
+		REG(fi.get_rs1()) =
+			saddr_t(CPU().memory().template read<uint8_t>(addr));
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_SLLI);
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		// SLLI: Logical left-shift 5/6/7-bit immediate
+		REG(fi.get_rs1()) =
+			REG(fi.get_rs2()) << fi.unsigned_imm();
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_OP_OR);
+	{
+		OP_INSTR();
+		dst = src1 | src2;
+		NEXT_INSTR();
+	}
+}
+#if defined(RISCV_EXT_COMPRESSED)
+INSTRUCTION(RV32I_BC_FUSED_C_LDD_C_LDD_C_LDD, fused_c_ldd_c_ldd_c_ldd) {
+	if constexpr (W >= 8) {
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr = REG(fi.get_rs2()) + fi.signed_imm();
+			REG(fi.get_rs1()) =
+				(int64_t)CPU().memory().template read<uint64_t>(addr);
+		}
+		NEXT_FUSED_C_INSTR(RV32C_BC_LDD);
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr = REG(fi.get_rs2()) + fi.signed_imm();
+			REG(fi.get_rs1()) =
+				(int64_t)CPU().memory().template read<uint64_t>(addr);
+		}
+		NEXT_FUSED_C_INSTR(RV32C_BC_LDD);
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr = REG(fi.get_rs2()) + fi.signed_imm();
+			REG(fi.get_rs1()) =
+				(int64_t)CPU().memory().template read<uint64_t>(addr);
+			NEXT_C_INSTR();
+		}
+	}
+	else UNUSED_FUNCTION();
+}
+#endif
+INSTRUCTION(RV32I_BC_FUSED_STW_STW_STW, fused_stw_stw_stw) {
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		const auto addr  = REG(fi.get_rs1()) + fi.signed_imm();
+		CPU().memory().template write<uint32_t>(addr, REG(fi.get_rs2()));
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_STW);
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		const auto addr  = REG(fi.get_rs1()) + fi.signed_imm();
+		CPU().memory().template write<uint32_t>(addr, REG(fi.get_rs2()));
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_STW);
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		const auto addr  = REG(fi.get_rs1()) + fi.signed_imm();
+		CPU().memory().template write<uint32_t>(addr, REG(fi.get_rs2()));
+		NEXT_INSTR();
+	}
+}
+INSTRUCTION(RV32I_BC_FUSED_STB_ADDI_BGEU, fused_stb_addi_bgeu) {
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		const auto addr = REG(fi.get_rs1()) + fi.signed_imm();
+		CPU().memory().template write<uint8_t>(addr, REG(fi.get_rs2()));
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_ADDI);
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		REG(fi.get_rs1()) =
+			REG(fi.get_rs2()) + fi.signed_imm();
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_BGEU);
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		if (REG(fi.get_rs1()) >= REG(fi.get_rs2())) {
+			PERFORM_BRANCH();
+		}
+		NEXT_BLOCK(4, false);
+	}
+}
+#if defined(RISCV_EXT_COMPRESSED)
+INSTRUCTION(RV32I_BC_FUSED_C_ADDI_C_ADDI, fused_c_addi_c_addi) {
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		REG(fi.get_rs1()) = REG(fi.get_rs2()) + fi.signed_imm();
+	}
+	NEXT_FUSED_C_INSTR(RV32C_BC_ADDI);
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		REG(fi.get_rs1()) = REG(fi.get_rs2()) + fi.signed_imm();
+		NEXT_C_INSTR();
+	}
+}
+#endif
+INSTRUCTION(RV32I_BC_FUSED_LDW_LDW, fused_ldw_ldw) {
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		const auto addr = REG(fi.get_rs2()) + fi.signed_imm();
+		REG(fi.get_rs1()) =
+			(int32_t)CPU().memory().template read<uint32_t>(addr);
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_LDW);
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		const auto addr = REG(fi.get_rs2()) + fi.signed_imm();
+		REG(fi.get_rs1()) =
+			(int32_t)CPU().memory().template read<uint32_t>(addr);
+		NEXT_INSTR();
+	}
+}
+#if defined(RISCV_64I)
+INSTRUCTION(RV32I_BC_FUSED_LDD_LDD_LDD, fused_ldd_ldd_ldd) {
+	if constexpr (W >= 8) {
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr = REG(fi.get_rs2()) + fi.signed_imm();
+			REG(fi.get_rs1()) =
+				(int64_t)CPU().memory().template read<uint64_t>(addr);
+		}
+		NEXT_FUSED_INSTR(RV32I_BC_LDD);
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr = REG(fi.get_rs2()) + fi.signed_imm();
+			REG(fi.get_rs1()) =
+				(int64_t)CPU().memory().template read<uint64_t>(addr);
+		}
+		NEXT_FUSED_INSTR(RV32I_BC_LDD);
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr = REG(fi.get_rs2()) + fi.signed_imm();
+			REG(fi.get_rs1()) =
+				(int64_t)CPU().memory().template read<uint64_t>(addr);
+			NEXT_INSTR();
+		}
+	}
+	else UNUSED_FUNCTION();
+}
+#endif
+#if defined(RISCV_EXT_COMPRESSED)
+INSTRUCTION(RV32I_BC_FUSED_C_STD_C_STD, fused_c_std_c_std) {
+	if constexpr (W >= 8) {
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr = REG(fi.get_rs1()) + fi.signed_imm();
+			CPU().memory().template write<uint64_t>(addr, REG(fi.get_rs2()));
+		}
+		NEXT_FUSED_C_INSTR(RV32C_BC_STD);
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr = REG(fi.get_rs1()) + fi.signed_imm();
+			CPU().memory().template write<uint64_t>(addr, REG(fi.get_rs2()));
+			NEXT_C_INSTR();
+		}
+	}
+	else UNUSED_FUNCTION();
+}
+#endif
+INSTRUCTION(RV32I_BC_FUSED_ADDI_JALR, fused_addi_jalr) {
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		REG(fi.get_rs1()) =
+			REG(fi.get_rs2()) + fi.signed_imm();
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_JALR);
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		// jump to register + immediate
+		// NOTE: if rs1 == rd, avoid clobber by storing address first
+		const auto address = REG(fi.rs2) + fi.signed_imm();
+		// Link *next* instruction (rd = PC + 4)
+		if (fi.rs1 != 0) {
+			REG(fi.rs1) = pc + 4;
+		}
+		if constexpr (VERBOSE_JUMPS) {
+			fprintf(stderr, "JALR x%d + %d => rd=%d   PC 0x%lX => 0x%lX\n",
+				fi.rs2, fi.signed_imm(), fi.rs1, long(pc), long(address));
+		}
+		static constexpr addr_t ALIGN_MASK = (compressed_enabled) ? 0x1 : 0x3;
+		pc = address & ~ALIGN_MASK;
+		OVERFLOW_CHECKED_JUMP();
+	}
+}
+INSTRUCTION(RV32I_BC_FUSED_ANDI_LI, fused_andi_li) {
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		// ANDI: And sign-extended 12-bit immediate
+		REG(fi.get_rs1()) = REG(fi.get_rs2()) & fi.signed_imm();
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_LI);
+	{
+		VIEW_INSTR_AS(fi, FasterImmediate);
+		REG(fi.get_rd()) = fi.signed_imm();
+		NEXT_INSTR();
+	}
+}
+#if defined(RISCV_64I)
+INSTRUCTION(RV32I_BC_FUSED_STD_STD, fused_std_std) {
+	if constexpr (W >= 8) {
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr  = REG(fi.get_rs1()) + fi.signed_imm();
+			CPU().memory().template write<uint64_t>(addr, REG(fi.get_rs2()));
+		}
+		NEXT_FUSED_INSTR(RV32I_BC_STD);
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr  = REG(fi.get_rs1()) + fi.signed_imm();
+			CPU().memory().template write<uint64_t>(addr, REG(fi.get_rs2()));
+			NEXT_INSTR();
+		}
+	}
+	else UNUSED_FUNCTION();
+}
+#endif
+INSTRUCTION(RV32I_BC_FUSED_OP_SH2ADD_LDW_MV, fused_op_sh2add_ldw_mv) {
+	{
+		OP_INSTR();
+		dst = src2 + (src1 << 2);
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_LDW);
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		const auto addr = REG(fi.get_rs2()) + fi.signed_imm();
+		REG(fi.get_rs1()) =
+			(int32_t)CPU().memory().template read<uint32_t>(addr);
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_MV);
+	{
+		VIEW_INSTR_AS(fi, FasterMove);
+		REG(fi.get_rd()) = REG(fi.get_rs1());
+		NEXT_INSTR();
+	}
+}
+INSTRUCTION(RV32I_BC_FUSED_OP_ADD_SEXT_B_BGE, fused_op_add_sext_b_bge) {
+	{
+		OP_INSTR();
+		dst = src1 + src2;
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_SEXT_B);
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		REG(fi.get_rs1()) = saddr_t(int8_t(REG(fi.get_rs2())));
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_BGE);
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		if ((saddr_t)REG(fi.get_rs1()) >= (saddr_t)REG(fi.get_rs2())) {
+			PERFORM_BRANCH();
+		}
+		NEXT_BLOCK(4, false);
+	}
+}
+INSTRUCTION(RV32I_BC_FUSED_STB_NOP_SRLI, fused_stb_nop_srli) {
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		const auto addr = REG(fi.get_rs1()) + fi.signed_imm();
+		CPU().memory().template write<uint8_t>(addr, REG(fi.get_rs2()));
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_NOP);
+	{
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_SRLI);
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		// SRLI: Shift-right logical 5/6/7-bit immediate
+		REG(fi.get_rs1()) = REG(fi.get_rs2()) >> fi.unsigned_imm();
+		NEXT_INSTR();
+	}
+}
+#if defined(RISCV_EXT_COMPRESSED)
+INSTRUCTION(RV32I_BC_FUSED_C_LDD_C_LDD, fused_c_ldd_c_ldd) {
+	if constexpr (W >= 8) {
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr = REG(fi.get_rs2()) + fi.signed_imm();
+			REG(fi.get_rs1()) =
+				(int64_t)CPU().memory().template read<uint64_t>(addr);
+		}
+		NEXT_FUSED_C_INSTR(RV32C_BC_LDD);
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr = REG(fi.get_rs2()) + fi.signed_imm();
+			REG(fi.get_rs1()) =
+				(int64_t)CPU().memory().template read<uint64_t>(addr);
+			NEXT_C_INSTR();
+		}
+	}
+	else UNUSED_FUNCTION();
+}
+#endif
+#if defined(RISCV_EXT_COMPRESSED)
+INSTRUCTION(RV32I_BC_FUSED_LDBU_C_ADDI_BNE_FW, fused_ldbu_c_addi_bne_fw) {
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		const auto addr = REG(fi.get_rs2()) + fi.signed_imm();
+		REG(fi.get_rs1()) =
+			saddr_t(CPU().memory().template read<uint8_t>(addr));
+	}
+	NEXT_FUSED_INSTR(RV32C_BC_ADDI);
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		REG(fi.get_rs1()) = REG(fi.get_rs2()) + fi.signed_imm();
+	}
+	NEXT_FUSED_C_INSTR(RV32I_BC_BNE_FW);
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		if (REG(fi.get_rs1()) != REG(fi.get_rs2())) {
+			PERFORM_FORWARD_BRANCH();
+		}
+		NEXT_BLOCK(4, false);
+	}
+}
+#endif
+#if defined(RISCV_64I)
+INSTRUCTION(RV32I_BC_FUSED_SLLI_OP_ADD_LDWU, fused_slli_op_add_ldwu) {
+	if constexpr (W >= 8) {
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			// SLLI: Logical left-shift 5/6/7-bit immediate
+			REG(fi.get_rs1()) =
+				REG(fi.get_rs2()) << fi.unsigned_imm();
+		}
+		NEXT_FUSED_INSTR(RV32I_BC_OP_ADD);
+		{
+			OP_INSTR();
+			dst = src1 + src2;
+		}
+		NEXT_FUSED_INSTR(RV32I_BC_LDWU);
+		{
+			VIEW_INSTR_AS(fi, FasterItype);
+			const auto addr = REG(fi.get_rs2()) + fi.signed_imm();
+			REG(fi.get_rs1()) =
+				CPU().memory().template read<uint32_t>(addr);
+			NEXT_INSTR();
+		}
+	}
+	else UNUSED_FUNCTION();
+}
+#endif
+INSTRUCTION(RV32I_BC_FUSED_ADDI_ADDI_BGEU, fused_addi_addi_bgeu) {
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		REG(fi.get_rs1()) =
+			REG(fi.get_rs2()) + fi.signed_imm();
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_ADDI);
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		REG(fi.get_rs1()) =
+			REG(fi.get_rs2()) + fi.signed_imm();
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_BGEU);
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		if (REG(fi.get_rs1()) >= REG(fi.get_rs2())) {
+			PERFORM_BRANCH();
+		}
+		NEXT_BLOCK(4, false);
+	}
+}
+INSTRUCTION(RV32I_BC_FUSED_SLTIU_OP_SUB_OP_AND, fused_sltiu_op_sub_op_and) {
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		// SLTIU: Sign-extend, then treat as unsigned
+		REG(fi.get_rs1()) = (REG(fi.get_rs2()) < addr_t(fi.signed_imm()));
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_OP_SUB);
+	{
+		OP_INSTR();
+		dst = src1 - src2;
+	}
+	NEXT_FUSED_INSTR(RV32I_BC_OP_AND);
+	{
+		OP_INSTR();
+		dst = src1 & src2;
+		NEXT_INSTR();
+	}
+}
+#if defined(RISCV_EXT_COMPRESSED)
+INSTRUCTION(RV32I_BC_FUSED_C_ADDI_C_ADDI_C_ADDI, fused_c_addi_c_addi_c_addi) {
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		REG(fi.get_rs1()) = REG(fi.get_rs2()) + fi.signed_imm();
+	}
+	NEXT_FUSED_C_INSTR(RV32C_BC_ADDI);
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		REG(fi.get_rs1()) = REG(fi.get_rs2()) + fi.signed_imm();
+	}
+	NEXT_FUSED_C_INSTR(RV32C_BC_ADDI);
+	{
+		VIEW_INSTR_AS(fi, FasterItype);
+		REG(fi.get_rs1()) = REG(fi.get_rs2()) + fi.signed_imm();
+		NEXT_C_INSTR();
+	}
+}
+#endif
@@ -1,6 +1,7 @@
 #pragma once
 #include "libriscv_settings.h" // Build-system generated
 
+#include <cstdio>
 #include <memory>
 #include <type_traits>
 #if __has_include(<span>)
@@ -91,6 +92,16 @@ namespace riscv
 		/// from the program loaded at construction.
 		bool protect_segments = true;
 
+		/// @brief Back the program segments with pages that point into the binary,
+		/// instead of copying them. Machines loading the same binary share the memory,
+		/// and when the binary is a mmap() of the ELF file, so do other processes.
+		/// Writable segments become copy-on-write.
+		/// @details The binary must be page-aligned (as with mmap()), it must never
+		/// change and it must outlive every machine that uses it. Only whole pages
+		/// outside of the flat read-write arena are shared, the rest are copied.
+		/// Requires protect_segments.
+		bool zero_copy_segments = false;
+
 		/// @brief Enabling this will allow unsafe RWX segments (read-write-execute).
 		bool allow_write_exec_segment = false;
 
@@ -112,6 +123,15 @@ namespace riscv
 		/// but requires the forks to fault in pages instead (slower).
 		bool minimal_fork = false;
 
+		/// @brief Record the pages a fork changes, so that the fork can be
+		/// returned to the state of the main machine with Machine::reset_to(),
+		/// at a cost proportional to what it touched. Forks that share the
+		/// flat read-write arena will write to it through the page tables,
+		/// which saves each arena page before its first write.
+		/// @details Binary translations emit arena writes directly, so they
+		/// must be created with translation_use_arena disabled for this.
+		bool fork_dirty_tracking = false;
+
 		/// @brief Create a linear memory arena for main memory, increasing memory
 		/// locality and also enables read-write arena if the CMake option is ON.
 		bool use_memory_arena = true;
@@ -123,6 +143,14 @@ namespace riscv
 		/// translated code between machines. (Prevents some optimizations)
 		bool use_shared_execute_segments = true;
 
+		/// @brief Directory for decoder cache snapshots. When set, a decoded execute
+		/// segment is written to this directory, and later machines (also in other
+		/// processes) map the snapshot instead of decoding the segment again.
+		/// @details Snapshots are keyed by the CRC32-C of the execute segment and the
+		/// libriscv build configuration. Segments that are binary translated or that
+		/// have ebreak locations are always decoded. Only available on Linux.
+		std::string decoder_snapshot_dir {};
+
 		/// @brief Override a default-injected exit function with another function
 		/// that is found by looking up the provided symbol name in the current program.
 		/// Eg. if default_exit_function is "fast_exit", then the ELF binary must have
@@ -196,6 +224,17 @@ namespace riscv
 		/// @brief Jump location hints for the binary translator.
 		/// @details These hints can improve performance of the binary translation.
 		std::vector<address_type<W>> translator_jump_hints {};
+		/// @brief Tiered translation. When non-zero, an execute segment that has no
+		/// translation yet will start out interpreted, while the PC is sampled every
+		/// translate_hot_sample_interval instructions. Once a code region has been
+		/// sampled this many times, only the sampled regions and their static callees
+		/// are translated, and then live-patched into the running execute segment.
+		/// @details Translation time and code size follow the hot set of the program
+		/// instead of the whole execute segment. The compilation step is run from
+		/// translate_background_callback when it is set, otherwise it runs synchronously.
+		/// The partial translation is cached like any other, under its own hash.
+		unsigned translate_hot_threshold = 0;
+		unsigned translate_hot_sample_interval = 250'000;
 		/// @brief Enable background compilation of shared objects. The compilation step
 		/// will be executed from a user-provided callback, and will be applied to the machine
 		/// when ready. Applying the translation is thread-safe and will take effect on all
@@ -203,6 +242,11 @@ namespace riscv
 		/// For short-lived programs, this feature should be disabled, as it often takes more
 		/// time to translate and compile than to execute the program.
 		std::function<void(std::function<void()>& compilation_step)> translate_background_callback = nullptr;
+		/// @brief Split the translated code into this many C units, which are compiled
+		/// concurrently and then linked together into one shared object.
+		/// @details Zero uses the number of hardware threads. Only the system compiler
+		/// is invoked in parallel, libtcc always compiles a single unit.
+		unsigned translate_compile_jobs = 0;
 		/// @brief Allow the production of a secondary dependency-free DLL that can be
 		/// transferred to and loaded on Windows (or other) machines. It will be used
 		/// to greatly accelerate the emulation of the RISC-V program.
@@ -304,6 +348,11 @@ namespace riscv
 #else
 	static constexpr bool flat_readwrite_arena = false;
 #endif
+#ifdef RISCV_RADIX_PAGE_TABLE
+	static constexpr bool radix_page_table = true;
+#else
+	static constexpr bool radix_page_table = false;
+#endif
 #ifdef RISCV_ENCOMPASSING_ARENA_BITS
 	static constexpr int encompassing_Nbit_arena = RISCV_ENCOMPASSING_ARENA_BITS;
 	static constexpr uint64_t encompassing_arena_mask = (1ull << RISCV_ENCOMPASSING_ARENA_BITS) - 1;
@@ -321,11 +370,25 @@ namespace riscv
 #else
 	static constexpr bool libtcc_enabled = false;
 #endif
+#ifdef RISCV_RECORD_BYTECODES
+	static constexpr bool bytecode_recording_enabled = true;
+#else
+	static constexpr bool bytecode_recording_enabled = false;
+#endif
+
+	/// @brief Write the bytecode pairs and triples recorded by the dispatch
+	/// loops of every thread, which is the input of the superinstruction
+	/// generator. Only records with RISCV_RECORD_BYTECODES, and should not be
+	/// called while machines are running.
+	/// @return False if recording is disabled or the write failed
+	bool write_bytecode_profile(FILE*);
 
 
 	template <int W> struct MultiThreading;
 	template <int W> struct Multiprocessing;
+	template <int W> struct Profiler;
 	template <int W> struct SerializedMachine;
+	struct SyscallOffload;
 	struct Arena;
 
 	template <typename T>
@@ -49,6 +49,14 @@ namespace riscv
 		this->registers().copy_from(Registers<W>::Options::NoVectors, other.cpu.registers());
 	}
 	template <int W>
+	void CPU<W>::reset_to(const CPU& other)
+	{
+		this->registers().copy_from(Registers<W>::Options::NoVectors, other.registers());
+		this->m_exec = other.m_exec;
+		this->m_cache = {};
+		this->clear_current_exception();
+	}
+	template <int W>
 	void CPU<W>::reset()
 	{
 		this->m_regs = {};
@@ -119,13 +119,20 @@ namespace riscv
 
 		// Binary translation functions
 		int  load_translation(const MachineOptions<W>&, std::string* filename, DecodedExecuteSegment<W>&) const;
-		void try_translate(const MachineOptions<W>&, const std::string&, std::shared_ptr<DecodedExecuteSegment<W>>&) const;
+		void try_translate(const MachineOptions<W>&, const std::string&, std::shared_ptr<DecodedExecuteSegment<W>>&,
+			std::vector<address_t> hot_regions = {}) const;
+		void defer_translation(const MachineOptions<W>&, const std::string&, DecodedExecuteSegment<W>&) const;
+		/// @brief Simulate in slices of translate_hot_sample_interval instructions,
+		/// sampling the PC between slices until the current execute segment has
+		/// been translated. Used by tiered translation.
+		bool simulate_tiered(address_t pc, uint64_t icounter, uint64_t maxcounter);
 
 		void reset();
 		void reset_stack_pointer() noexcept;
 
 		CPU(Machine<W>&, unsigned cpu_id);
 		CPU(Machine<W>&, unsigned cpu_id, const Machine<W>& other); // Fork
+		void reset_to(const CPU& other); // Return a fork to its main CPU
 
 		DecodedExecuteSegment<W>& init_execute_area(const void* data, address_t begin, address_t length, bool is_likely_jit = false);
 		void set_execute_segment(DecodedExecuteSegment<W>& seg) noexcept { m_exec = &seg; }
@@ -1,5 +1,6 @@
 #include "machine.hpp"
 #include "decoder_cache.hpp"
+#include "superinstructions.hpp"
 #include "threaded_bytecodes.hpp"
 #include "rv32i_instr.hpp"
 #include "rvfd.hpp"
@@ -23,6 +24,8 @@ namespace riscv
 #undef VIEW_INSTR_AS
 #undef NEXT_INSTR
 #undef NEXT_C_INSTR
+#undef NEXT_FUSED_INSTR
+#undef NEXT_FUSED_C_INSTR
 #undef NEXT_BLOCK
 #undef SAFE_INSTR_NEXT
 #undef NEXT_SEGMENT
@@ -36,14 +39,31 @@ namespace riscv
 #define VIEW_INSTR_AS(name, x) \
 	auto &&name = *(x *)&decoder->instr;
 #define NEXT_INSTR()                  \
+	RECORD_BYTECODE_SEQUENCE(decoder, compressed_enabled ? 2 : 1) \
 	if constexpr (compressed_enabled) \
 		decoder += 2;                 \
 	else                              \
 		decoder += 1;                 \
 	EXECUTE_INSTR();
 #define NEXT_C_INSTR() \
+	RECORD_BYTECODE_SEQUENCE(decoder, 1) \
 	decoder += 1;      \
 	EXECUTE_INSTR();
+// Continue a superinstruction with the next element, unless
+// its bytecode was changed after fusing (eg. by live-patching)
+#define NEXT_FUSED_INSTR(bc)          \
+	if constexpr (compressed_enabled) \
+		decoder += 2;                 \
+	else                              \
+		decoder += 1;                 \
+	if (UNLIKELY(decoder->get_bytecode() != bc)) { \
+		EXECUTE_INSTR();              \
+	}
+#define NEXT_FUSED_C_INSTR(bc) \
+	decoder += 1;              \
+	if (UNLIKELY(decoder->get_bytecode() != bc)) { \
+		EXECUTE_INSTR();       \
+	}
 
 #define NEXT_BLOCK(len, OF)                                    \
 	pc += len;                                                 \
@@ -2,11 +2,13 @@
 #include <memory>
 #include "types.hpp"
 #include <unordered_set>
+#include <vector>
 
 namespace riscv
 {
 	template<int W> struct DecoderCache;
 	template<int W> struct DecoderData;
+	template<int W> struct TranslationProfile;
 
 	// A fully decoded execute segment
 	template <int W>
@@ -36,13 +38,24 @@ namespace riscv
 
 		auto* decoder_cache() noexcept { return m_exec_decoder; }
 		auto* decoder_cache() const noexcept { return m_exec_decoder; }
-		auto* decoder_cache_base() const noexcept { return m_decoder_cache.get(); }
+		auto* decoder_cache_base() const noexcept { return m_decoder_cache_base; }
 		size_t decoder_cache_size() const noexcept { return m_decoder_cache_size; }
 
 		auto* create_decoder_cache(DecoderCache<W>* cache, size_t size) {
 			m_decoder_cache.reset(cache);
+			m_decoder_mapping = nullptr;
+			m_decoder_cache_base = cache;
 			m_decoder_cache_size = size;
-			return m_decoder_cache.get();
+			return cache;
+		}
+		// Use a decoder cache that lives in a memory mapping (decoder snapshots),
+		// the mapping is released together with the execute segment
+		auto* map_decoder_cache(std::shared_ptr<void> mapping, DecoderCache<W>* cache, size_t size) {
+			m_decoder_cache = nullptr;
+			m_decoder_mapping = std::move(mapping);
+			m_decoder_cache_base = cache;
+			m_decoder_cache_size = size;
+			return cache;
 		}
 		void set_decoder(DecoderData<W>* dec) { m_exec_decoder = dec; }
 
@@ -74,13 +87,24 @@ namespace riscv
 		bintr_block_func<W> unchecked_mapping_at(unsigned i) const { return m_translator_mappings[i]; }
 		size_t translator_mappings() const noexcept { return m_translator_mappings.size(); }
 		auto* patched_decoder_cache() noexcept { return m_patched_exec_decoder; }
-		void set_patched_decoder_cache(std::unique_ptr<DecoderCache<W>[]> cache, DecoderData<W>* dec)
-			{ m_patched_decoder_cache = std::move(cache); m_patched_exec_decoder = dec; }
+		auto* patched_decoder_cache_base() const noexcept { return m_patched_decoder_cache.get(); }
+		void set_patched_decoder_cache(std::unique_ptr<DecoderCache<W>[]> cache, DecoderData<W>* dec) {
+			// A replaced patched decoder may still be running, so it is kept until destruction
+			if (m_patched_decoder_cache)
+				m_retired_decoder_caches.push_back(std::move(m_patched_decoder_cache));
+			m_patched_decoder_cache = std::move(cache); m_patched_exec_decoder = dec;
+		}
+		// Later tiers of a tiered translation, closed on destruction
+		void add_binary_translation_tier(void* dl) { m_bintr_tiers.push_back(dl); }
 
 		void set_record_slowpaths(bool do_record) { m_do_record_slowpaths = do_record; }
 		bool is_recording_slowpaths() const noexcept { return m_do_record_slowpaths; }
 		void insert_slowpath_address(address_t addr) { m_slowpath_addresses.insert(addr); }
 		auto& slowpath_addresses() const noexcept { return m_slowpath_addresses; }
+
+		// Tiered translation: execution samples collected before translating
+		TranslationProfile<W>* translation_profile() const noexcept { return m_translation_profile.get(); }
+		void set_translation_profile(std::shared_ptr<TranslationProfile<W>> profile) { m_translation_profile = std::move(profile); }
 #else
 		bool is_binary_translated() const noexcept { return false; }
 #endif
@@ -109,14 +133,19 @@ namespace riscv
 
 		// Decoder cache is used to run bytecode simulation at a high speed
 		size_t          m_decoder_cache_size = 0;
+		DecoderCache<W>* m_decoder_cache_base = nullptr;
 		std::unique_ptr<DecoderCache<W>[]> m_decoder_cache = nullptr;
+		std::shared_ptr<void> m_decoder_mapping = nullptr;
 
 #ifdef RISCV_BINARY_TRANSLATION
 		std::vector<bintr_block_func<W>> m_translator_mappings;
 		std::unique_ptr<DecoderCache<W>[]> m_patched_decoder_cache = nullptr;
 		DecoderData<W>* m_patched_exec_decoder = nullptr;
+		std::vector<std::unique_ptr<DecoderCache<W>[]>> m_retired_decoder_caches;
 		mutable void* m_bintr_dl = nullptr;
+		std::vector<void*> m_bintr_tiers;
 		std::unordered_set<address_t> m_slowpath_addresses;
+		std::shared_ptr<TranslationProfile<W>> m_translation_profile = nullptr;
 		uint32_t m_bintr_hash = 0x0; // CRC32-C of the execute segment + compiler options
 #endif
 		uint32_t m_crc32c_hash = 0x0; // CRC32-C of the execute segment
@@ -155,7 +184,10 @@ namespace riscv
 		m_exec_pagedata = std::move(other.m_exec_pagedata);
 
 		m_decoder_cache_size = other.m_decoder_cache_size;
+		m_decoder_cache_base = other.m_decoder_cache_base;
+		other.m_decoder_cache_base = nullptr;
 		m_decoder_cache = std::move(other.m_decoder_cache);
+		m_decoder_mapping = std::move(other.m_decoder_mapping);
 
 #ifdef RISCV_BINARY_TRANSLATION
 		m_translator_mappings = std::move(other.m_translator_mappings);
@@ -165,6 +197,10 @@ namespace riscv
 		m_is_libtcc = other.m_is_libtcc;
 		m_patched_decoder_cache = std::move(other.m_patched_decoder_cache);
 		m_patched_exec_decoder = other.m_patched_exec_decoder;
+		m_retired_decoder_caches = std::move(other.m_retired_decoder_caches);
+		m_bintr_tiers = std::move(other.m_bintr_tiers);
+		other.m_bintr_tiers.clear();
+		m_translation_profile = std::move(other.m_translation_profile);
 #endif
 	}
 
@@ -175,6 +211,8 @@ namespace riscv
 		extern void  dylib_close(void* dylib, bool is_libtcc);
 		if (m_bintr_dl)
 			dylib_close(m_bintr_dl, m_is_libtcc);
+		for (auto* dl : m_bintr_tiers)
+			dylib_close(dl, m_is_libtcc);
 #endif
 	}
 
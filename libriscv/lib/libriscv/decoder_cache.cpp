@@ -4,12 +4,21 @@
 #include "internal_common.hpp"
 #include "rvc.hpp"
 #include "safe_instr_loader.hpp"
+#include "superinstructions.hpp"
 #include "threaded_rewriter.cpp"
 #include "threaded_bytecodes.hpp"
 #include "util/crc32.hpp"
 #include <inttypes.h>
 #include <mutex>
 #include <unordered_set>
+#ifdef __linux__
+#include <atomic>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DECODER_SNAPSHOTS_ENABLED
+#endif
 //#define ENABLE_TIMINGS
 
 namespace riscv
@@ -270,6 +279,272 @@ namespace riscv
 		}
 	}
 
+	// Replace the first bytecode of frequent sequences with a superinstruction
+	// that executes the whole sequence with one dispatch. Every element except
+	// the last must be followed by the next in the same block, so that blocks
+	// and instruction counting stay the same. The other entries are untouched,
+	// which keeps jumping into the middle of a sequence valid.
+	template <int W>
+	static void fuse_superinstructions(
+		address_type<W> base_pc, address_type<W> last_pc, DecoderData<W>* exec_decoder)
+	{
+		// Recording must see every transition
+		if constexpr (superinstruction_count == 0 || bytecode_recording_enabled)
+			return;
+		static constexpr auto first_ops = [] {
+			std::array<bool, 256> first {};
+			for (size_t i = 0; i < superinstruction_count; i++)
+				first[superinstructions[i].ops[0]] = true;
+			return first;
+		}();
+
+		auto* entry = &exec_decoder[base_pc / DecoderCache<W>::DIVISOR];
+		auto* const end = &exec_decoder[last_pc / DecoderCache<W>::DIVISOR];
+		while (entry < end)
+		{
+			if (LIKELY(!first_ops[entry->get_bytecode()])) {
+				entry++;
+				continue;
+			}
+			const Superinstruction* match = nullptr;
+			DecoderData<W>* match_last = nullptr;
+			for (size_t i = 0; i < superinstruction_count; i++) {
+				const auto& super = superinstructions[i];
+				if (match != nullptr && super.length <= match->length)
+					continue;
+				auto* element = entry;
+				bool matched = true;
+				for (unsigned n = 0; matched && n < super.length; n++) {
+					matched = element < end && element->get_bytecode() == super.ops[n];
+					if (matched && n + 1 < super.length) {
+						const unsigned stride = (super.compressed & (1u << n)) ? 1 : (compressed_enabled ? 2 : 1);
+						matched = element->idxend >= stride;
+						element += stride;
+					}
+				}
+				if (matched) {
+					match = &super;
+					match_last = element;
+				}
+			}
+			if (match == nullptr) {
+				entry++;
+				continue;
+			}
+			entry->set_bytecode(match->bytecode);
+			// Elements of a superinstruction cannot begin another one
+			entry = match_last + 1;
+		}
+	}
+
+#ifdef DECODER_SNAPSHOTS_ENABLED
+	// A decoder snapshot is the finished decoder cache of an execute segment
+	// written to a file, which later machines map privately instead of decoding
+	// the same segment again. Entries are only written to when live-patched, so
+	// the pages stay shared with the page cache until then.
+	//
+	// Handler indices are assigned in the order handlers are first seen, which
+	// differs between processes, so the handler table is stored as offsets from
+	// a function in this library and the indices are remapped on load.
+	//
+	// Layout: header, handler offsets, decoder cache pages at data_offset
+	static const uint64_t SNAPSHOT_MAGIC = 0x52564443534e4150; // RVDCSNAP
+	static constexpr uint32_t SNAPSHOT_VERSION = 1;
+	static constexpr size_t SNAPSHOT_DATA_ALIGN = 65536; // Largest host page size
+
+	struct DecoderSnapshotHeader
+	{
+		uint64_t magic;
+		uint32_t version;
+		uint32_t crc32c; // CRC32-C of the execute segment
+		uint64_t build_hash;
+		uint64_t vaddr_begin;
+		uint64_t vaddr_end;
+		uint64_t pagedata_base;
+		uint64_t n_pages;
+		uint64_t data_offset;
+		uint32_t n_handlers;
+		uint32_t reserved;
+	};
+
+	template <int W>
+	static uintptr_t snapshot_anchor() {
+		return reinterpret_cast<uintptr_t>(&CPU<W>::decode);
+	}
+
+	// The decoder layout, plus distances between functions in this library
+	// as a stand-in for a build id: a rebuilt library must not use handler
+	// offsets from an older snapshot.
+	template <int W>
+	static uint32_t snapshot_build_hash()
+	{
+		const uint64_t config[] = {
+			W, compressed_enabled, binary_translation_enabled, PageSize,
+			sizeof(DecoderData<W>), sizeof(DecoderCache<W>),
+			reinterpret_cast<uintptr_t>(&DecoderData<W>::handler_index_for) - snapshot_anchor<W>(),
+			reinterpret_cast<uintptr_t>(&CPU<W>::computed_index_for) - snapshot_anchor<W>(),
+			BYTECODES_MAX, crc32c(superinstructions, sizeof(superinstructions)),
+		};
+		return crc32c(config, sizeof(config));
+	}
+
+	template <int W>
+	static std::string snapshot_filename(const MachineOptions<W>& options, const DecodedExecuteSegment<W>& exec)
+	{
+		char buffer[64];
+		const int len = snprintf(buffer, sizeof(buffer), "/rvdecoder%d-%08x-%08x",
+			W, exec.crc32c_hash(), snapshot_build_hash<W>());
+		return options.decoder_snapshot_dir + std::string(buffer, len);
+	}
+
+	template <int W>
+	static bool load_decoder_snapshot(const MachineOptions<W>& options, DecodedExecuteSegment<W>& exec, size_t n_pages)
+	{
+		const int fd = open(snapshot_filename(options, exec).c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+			return false;
+
+		DecoderSnapshotHeader hdr;
+		std::array<int64_t, 256> offsets;
+		struct stat st;
+		const size_t data_size = n_pages * sizeof(DecoderCache<W>);
+		const bool valid = fstat(fd, &st) == 0
+			&& pread(fd, &hdr, sizeof(hdr), 0) == ssize_t(sizeof(hdr))
+			&& hdr.magic == SNAPSHOT_MAGIC && hdr.version == SNAPSHOT_VERSION
+			&& hdr.crc32c == exec.crc32c_hash() && hdr.build_hash == snapshot_build_hash<W>()
+			&& hdr.vaddr_begin == exec.exec_begin() && hdr.vaddr_end == exec.exec_end()
+			&& hdr.pagedata_base == exec.pagedata_base() && hdr.n_pages == n_pages
+			&& hdr.n_handlers > 0 && hdr.n_handlers <= offsets.size()
+			&& hdr.data_offset % SNAPSHOT_DATA_ALIGN == 0
+			&& uint64_t(st.st_size) >= hdr.data_offset + data_size
+			&& pread(fd, offsets.data(), hdr.n_handlers * sizeof(int64_t), sizeof(hdr))
+				== ssize_t(hdr.n_handlers * sizeof(int64_t));
+		void* map = MAP_FAILED;
+		if (valid)
+			map = mmap(nullptr, data_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, hdr.data_offset);
+		close(fd);
+		if (map == MAP_FAILED)
+			return false;
+		std::shared_ptr<void> mapping(map, [data_size] (void* p) { munmap(p, data_size); });
+
+		// Translate the handler indices of the writer into ours. The offsets
+		// come from a file, so they are never registered as handlers unless
+		// they are known ones: either already registered, or what decoding
+		// the instruction of an entry that uses them produces.
+		std::array<int, 256> remap;
+		for (size_t i = 0; i < hdr.n_handlers; i++) {
+			const auto handler = reinterpret_cast<instruction_handler<W>>(snapshot_anchor<W>() + offsets[i]);
+			remap[i] = DecoderData<W>::known_handler_index(handler);
+		}
+		auto* cache = static_cast<DecoderCache<W>*>(map);
+		for (size_t p = 0; p < n_pages; p++) {
+			for (const auto& entry : cache[p].cache) {
+				const auto bytecode = entry.get_bytecode();
+				if (UNLIKELY(bytecode >= BYTECODES_MAX))
+					return false;
+#ifdef RISCV_BINARY_TRANSLATION
+				// Snapshots are never taken of translated segments
+				if (UNLIKELY(bytecode == RV32I_BC_TRANSLATOR))
+					return false;
+#endif
+				// Live-patch entries keep their own state in the handler index,
+				// and only checked system calls are live-patched while decoding
+				if (bytecode == RV32I_BC_LIVEPATCH) {
+					if (UNLIKELY(entry.m_handler < 2 || entry.m_handler > 3))
+						return false;
+					continue;
+				}
+				if (UNLIKELY(entry.m_handler >= hdr.n_handlers))
+					return false;
+				if (remap[entry.m_handler] < 0) {
+					const auto handler = reinterpret_cast<instruction_handler<W>>(snapshot_anchor<W>() + offsets[entry.m_handler]);
+					if (CPU<W>::decode(rv32i_instruction{entry.instr}).handler != handler)
+						return false;
+					remap[entry.m_handler] = DecoderData<W>::handler_index_for(handler);
+				}
+			}
+		}
+		// Handlers that no entry uses are left out
+		bool is_identity = true;
+		for (size_t i = 0; i < hdr.n_handlers; i++)
+			is_identity = is_identity && (remap[i] < 0 || size_t(remap[i]) == i);
+
+		for (size_t p = 0; p < n_pages && !is_identity; p++) {
+			for (auto& entry : cache[p].cache) {
+				if (entry.get_bytecode() == RV32I_BC_LIVEPATCH)
+					continue;
+				// Only rewritten pages become private copies
+				if (remap[entry.m_handler] != entry.m_handler)
+					entry.m_handler = remap[entry.m_handler];
+			}
+		}
+
+		exec.map_decoder_cache(std::move(mapping), cache, n_pages);
+		exec.set_decoder(cache[0].get_base() - exec.pagedata_base() / DecoderCache<W>::DIVISOR);
+		return true;
+	}
+
+	static bool snapshot_write(int fd, const void* data, size_t len, off_t offset)
+	{
+		auto* ptr = static_cast<const uint8_t*>(data);
+		while (len > 0) {
+			const ssize_t written = pwrite(fd, ptr, len, offset);
+			if (written <= 0)
+				return false;
+			ptr += written;
+			len -= written;
+			offset += written;
+		}
+		return true;
+	}
+
+	template <int W>
+	static void store_decoder_snapshot(const MachineOptions<W>& options, const DecodedExecuteSegment<W>& exec)
+	{
+		const size_t n_handlers = DecoderData<W>::get_handler_count();
+		std::vector<int64_t> offsets(n_handlers);
+		for (size_t i = 0; i < n_handlers; i++)
+			offsets[i] = reinterpret_cast<uintptr_t>(DecoderData<W>::get_handlers()[i]) - snapshot_anchor<W>();
+		static_assert(sizeof(DecoderSnapshotHeader) + 256 * sizeof(int64_t) <= SNAPSHOT_DATA_ALIGN);
+
+		const DecoderSnapshotHeader hdr {
+			.magic = SNAPSHOT_MAGIC,
+			.version = SNAPSHOT_VERSION,
+			.crc32c = exec.crc32c_hash(),
+			.build_hash = snapshot_build_hash<W>(),
+			.vaddr_begin = exec.exec_begin(),
+			.vaddr_end = exec.exec_end(),
+			.pagedata_base = exec.pagedata_base(),
+			.n_pages = exec.decoder_cache_size(),
+			.data_offset = SNAPSHOT_DATA_ALIGN,
+			.n_handlers = uint32_t(n_handlers),
+			.reserved = 0,
+		};
+
+		// Write to a temporary file and rename it, so that a snapshot
+		// is either complete or not there at all
+		static std::atomic<unsigned> counter = 0;
+		const std::string filename = snapshot_filename(options, exec);
+		const std::string tmpname = filename + "." + std::to_string(getpid())
+			+ "." + std::to_string(counter++);
+		const int fd = open(tmpname.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+		if (fd < 0)
+			return;
+		const bool ok = snapshot_write(fd, &hdr, sizeof(hdr), 0)
+			&& snapshot_write(fd, offsets.data(), n_handlers * sizeof(int64_t), sizeof(hdr))
+			&& snapshot_write(fd, exec.decoder_cache_base(),
+				exec.decoder_cache_size() * sizeof(DecoderCache<W>), SNAPSHOT_DATA_ALIGN);
+		close(fd);
+		if (ok && rename(tmpname.c_str(), filename.c_str()) == 0) {
+			if (options.verbose_loader) {
+				printf("libriscv: Stored decoder snapshot %s\n", filename.c_str());
+			}
+			return;
+		}
+		unlink(tmpname.c_str());
+	}
+#endif // DECODER_SNAPSHOTS_ENABLED
+
 	// The decoder cache is a sequential array of DecoderData<W> entries
 	// each of which (currently) serves a dual purpose of enabling
 	// threaded dispatch (m_bytecode) and fallback to callback function
@@ -339,7 +614,12 @@ namespace riscv
 			std::string bintr_filename;
 			int result = machine().cpu.load_translation(options, &bintr_filename, exec);
 			const bool must_translate = result > 0;
-			if (must_translate)
+			if (must_translate && options.translate_hot_threshold > 0 && !exec.is_binary_translated())
+			{
+				// Tiered translation: wait until we know what is hot
+				machine().cpu.defer_translation(options, bintr_filename, exec);
+			}
+			else if (must_translate)
 			{
 				machine().cpu.try_translate(
 					options, bintr_filename, shared_segment);
@@ -347,6 +627,21 @@ namespace riscv
 		}
 	#endif
 
+#ifdef DECODER_SNAPSHOTS_ENABLED
+		// Binary translation and ebreak locations modify the decoder
+		// cache, and likely-JIT segments are not worth keeping around
+		const bool use_snapshot = !options.decoder_snapshot_dir.empty()
+			&& options.ebreak_locations.empty()
+			&& !exec.is_binary_translated() && !exec.is_likely_jit();
+		if (use_snapshot && load_decoder_snapshot(options, exec, n_pages)) {
+			if (options.verbose_loader) {
+				printf("libriscv: Loaded decoder snapshot for execute segment 0x%08x\n",
+					exec.crc32c_hash());
+			}
+			return;
+		}
+#endif
+
 		// When compressed instructions are enabled, many decoder
 		// entries are illegal because they are between instructions.
 		bool was_full_instruction = true;
@@ -433,6 +728,12 @@ namespace riscv
 		TIME_POINT(t3);
 
 		realize_fastsim<W>(addr, dst, exec_segment, exec_decoder);
+		fuse_superinstructions<W>(addr, dst, exec_decoder);
+
+#ifdef DECODER_SNAPSHOTS_ENABLED
+		if (use_snapshot)
+			store_decoder_snapshot(options, exec);
+#endif
 
 		// Debugging: EBREAK locations
 		for (auto& loc : options.ebreak_locations) {
@@ -465,6 +766,15 @@ namespace riscv
 #endif
 	}
 
+	template <int W> RISCV_INTERNAL
+	int DecoderData<W>::known_handler_index(Handler handler) noexcept
+	{
+		auto it = handler_cache.find(handler);
+		if (it != handler_cache.end())
+			return it->second;
+		return -1;
+	}
+
 	template <int W> RISCV_INTERNAL
 	size_t DecoderData<W>::handler_index_for(Handler new_handler)
 	{
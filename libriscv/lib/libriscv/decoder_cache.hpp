@@ -81,9 +81,14 @@ struct DecoderData {
 	}
 
 	static size_t handler_index_for(Handler new_handler);
+	// The index of an already registered handler, or -1
+	static int known_handler_index(Handler handler) noexcept;
 	static Handler* get_handlers() noexcept {
 		return &instr_handlers[0];
 	}
+	static size_t get_handler_count() noexcept {
+		return handler_count;
+	}
 
 	void atomic_overwrite(const DecoderData<W>& other) noexcept {
 		static_assert(sizeof(DecoderData<W>) == 8, "DecoderData size mismatch");
@@ -80,7 +80,8 @@ static void syscall_epoll_pwait(Machine<W>& machine)
 	const auto vepoll_fd = machine.template sysarg<int>(0);
 	const auto g_events = machine.sysarg(1);
 	auto maxevents = machine.template sysarg<int>(2);
-	auto timeout = machine.template sysarg<int>(3);
+	const auto guest_timeout = machine.template sysarg<int>(3);
+	auto timeout = guest_timeout;
 	if (timeout < 0 || timeout > 1) timeout = 1;
 
 	std::array<struct epoll_event, 4096> events;
@@ -93,6 +94,22 @@ static void syscall_epoll_pwait(Machine<W>& machine)
 	if (machine.has_file_descriptors()) {
 		real_fd = machine.fds().translate(vepoll_fd);
 
+#ifdef RISCV_SYSCALL_OFFLOAD
+		// The epoll fd is readable when it has events
+		if (machine.syscall_offload() && guest_timeout != 0 && !SyscallOffload::is_ready(real_fd, POLLIN)) {
+			auto state = std::make_shared<std::vector<struct epoll_event>> (maxevents);
+			machine.offload_syscall([offload = machine.syscall_offload(), state, real_fd, guest_timeout] {
+				if (!offload->wait_ready(real_fd, POLLIN, guest_timeout))
+					return long(0); // Timeout (or cancelled)
+				return SyscallOffload::result_or_error(epoll_wait(real_fd, state->data(), state->size(), 0));
+			}, [state, g_events] (Machine<W>& machine, long res) {
+				if (res > 0)
+					machine.copy_to_guest(g_events, state->data(), res * sizeof(struct epoll_event));
+			});
+			SYSPRINT("SYSCALL epoll_pwait, epoll_fd: %d (real_fd: %d) offloaded\n", vepoll_fd, real_fd);
+			return;
+		}
+#endif
 		const int res = epoll_wait(real_fd, events.data(), maxevents, timeout);
 		if (res > 0) {
 			machine.copy_to_guest(g_events, events.data(), res * sizeof(struct epoll_event));
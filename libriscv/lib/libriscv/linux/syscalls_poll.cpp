@@ -34,8 +34,10 @@ static void syscall_ppoll(Machine<W>& machine)
 	const auto nfds  = machine.template sysarg<unsigned>(1);
 	const auto g_ts = machine.sysarg(2);
 
-	struct timespec ts;
-	machine.copy_from_guest(&ts, g_ts, sizeof(ts));
+	// A null timeout waits forever
+	struct timespec ts {};
+	if (g_ts != 0x0)
+		machine.copy_from_guest(&ts, g_ts, sizeof(ts));
 	//printf("Timeout from 0x%lX sec=%ld nsec=%ld\n",
 	//	(long)g_ts, ts.tv_sec, ts.tv_nsec);
 
@@ -55,7 +57,26 @@ static void syscall_ppoll(Machine<W>& machine)
 			linux_fds[i].fd = machine.fds().translate(fds[i].fd);
 		}
 
-	    const int res = poll_with_timeout(linux_fds.data(), nfds, &ts);
+#ifdef RISCV_SYSCALL_OFFLOAD
+		const bool nonzero_timeout = g_ts == 0x0 || ts.tv_sec != 0 || ts.tv_nsec != 0;
+		if (machine.syscall_offload() && nonzero_timeout && ::poll(linux_fds.data(), nfds, 0) == 0) {
+			// Nothing is ready yet: Wait in the pool, then translate back
+			auto state = std::make_shared<std::array<struct pollfd, 128>> (linux_fds);
+			const int timeout_ms = (g_ts == 0x0) ? -1 : ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+			machine.offload_syscall([offload = machine.syscall_offload(), state, nfds, timeout_ms] {
+				return SyscallOffload::result_or_error(offload->poll(state->data(), nfds, timeout_ms));
+			}, [state, fds, g_fds, nfds] (Machine<W>& machine, long res) mutable {
+				if (res > 0) {
+					for (unsigned i = 0; i < nfds; i++) {
+						fds[i].revents = (*state)[i].revents;
+					}
+					machine.copy_to_guest(g_fds, fds.data(), nfds * sizeof(fds[0]));
+				}
+			});
+			return;
+		}
+#endif
+	    const int res = poll_with_timeout(linux_fds.data(), nfds, (g_ts != 0x0) ? &ts : nullptr);
 		// The ppoll system call modifies TS
 		//clock_gettime(CLOCK_MONOTONIC, &ts);
 		//machine.copy_to_guest(g_ts, &ts, sizeof(ts));
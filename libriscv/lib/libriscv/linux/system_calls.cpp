@@ -1,6 +1,7 @@
 #include "../machine.hpp"
 
 #include "../internal_common.hpp"
+#include "../syscall_offload.hpp"
 #include "../threads.hpp"
 
 //#define SYSCALL_VERBOSE 1
@@ -242,6 +243,18 @@ static void syscall_read(Machine<W>& machine)
 		std::array<riscv::vBuffer, 512> buffers;
 		size_t cnt =
 			machine.memory.gather_writable_buffers_from_range(buffers.size(), buffers.data(), address, len);
+#ifdef RISCV_SYSCALL_OFFLOAD
+		if (machine.syscall_offload() && !SyscallOffload::is_ready(real_fd, POLLIN)) {
+			std::vector<riscv::vBuffer> iov(buffers.begin(), buffers.begin() + cnt);
+			machine.offload_syscall([offload = machine.syscall_offload(), real_fd, iov = std::move(iov)] {
+				if (!offload->wait_ready(real_fd, POLLIN))
+					return long(-EINTR);
+				return SyscallOffload::result_or_error(readv(real_fd, (const iovec *)iov.data(), iov.size()));
+			});
+			SYSPRINT("SYSCALL read, fd: %d from vfd: %d offloaded\n", real_fd, vfd);
+			return;
+		}
+#endif
 		const ssize_t res =
 			readv(real_fd, (const iovec *)&buffers[0], cnt);
 		machine.set_result_or_error(res);
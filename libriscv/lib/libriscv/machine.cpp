@@ -2,6 +2,7 @@
 #include "multiprocessing.hpp"
 #include "internal_common.hpp"
 #include "native_heap.hpp"
+#include "syscall_offload.hpp"
 #include "rv32i_instr.hpp"
 #include "threads.hpp"
 #include "util/auxvec.hpp"
@@ -44,9 +45,28 @@ namespace riscv
 		if (other.m_mt) {
 			m_mt.reset(new MultiThreading {*this, *other.m_mt});
 		}
+		this->m_profiler = other.m_profiler;
+		this->m_offload = other.m_offload;
 		// TODO: transfer arena?
 	}
 
+	template <int W>
+	void Machine<W>::reset_to(const Machine& main)
+	{
+		memory.reset_to(main.memory);
+		cpu.reset_to(main.cpu);
+		this->m_counter = main.m_counter;
+		this->m_max_counter = main.m_max_counter;
+		if (main.m_mt) {
+			m_mt.reset(new MultiThreading {*this, *main.m_mt});
+		} else {
+			m_mt = nullptr;
+		}
+		if (this->has_arena() && main.has_arena()) {
+			m_arena.reset(new Arena(*main.m_arena));
+		}
+	}
+
 	template <int W>
 	inline Machine<W>::Machine(const std::vector<uint8_t>& bin, const MachineOptions<W>& opts)
 		: Machine(std::string_view{(char*) bin.data(), bin.size()}, opts) {}
@@ -58,6 +78,9 @@ namespace riscv
 	template <int W>
 	Machine<W>::~Machine()
 	{
+		// An offloaded system call must not complete into a destroyed machine
+		if (m_parked && m_offload)
+			m_offload->cancel(this);
 	}
 
 	template <int W>
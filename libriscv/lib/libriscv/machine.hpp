@@ -5,7 +5,9 @@
 #include "posix/filedesc.hpp"
 #include "posix/signals.hpp"
 #include <array>
+#include <span>
 #include <string_view>
+#include <tuple>
 
 namespace riscv
 {
@@ -63,6 +65,16 @@ namespace riscv
 		/// modified while the fork is running. Forks consume very little resources.
 		Machine(const Machine& main, const MachineOptions<W>& opts = {});
 
+		/// @brief Return a fork to the state of the main machine it was forked from.
+		/// @param main The machine that this machine was forked from
+		///
+		/// Only the pages that the fork changed are restored, together with
+		/// registers, instruction counters, threads and the native heap arena,
+		/// so that a pool of forks can be recycled at a cost proportional to
+		/// what each run touched. The fork must have been created with
+		/// MachineOptions::fork_dirty_tracking enabled.
+		void reset_to(const Machine& main);
+
 		/// @brief Tears down the machine, freeing all owned memory and pages.
 		~Machine();
 
@@ -249,6 +261,20 @@ namespace riscv
 		template <uint64_t MAXI = UINT64_MAX, bool Throw = true, typename... Args>
 		constexpr address_t vmcall(address_t func_addr, Args&&... args);
 
+		/// @brief Calls a RISC-V C ABI function in the program once for each
+		/// tuple of arguments, back to back, storing each (integer) result in order.
+		/// Between calls only the stack pointer, the return address and the
+		/// argument registers are set. Arguments must be integers or floating-point.
+		/// Use PreparedCall::call_batch() to also return directly to the host.
+		/// @tparam MAXI The instruction limit of each call.
+		/// @tparam Throw Throw exception on execution timeout.
+		/// @tparam Tuple A std::tuple, std::pair or std::array of arguments.
+		/// @param func_addr The address of the function to call.
+		/// @param args The arguments for each call.
+		/// @param results The result of each call, at least args.size() long.
+		template <uint64_t MAXI = UINT64_MAX, bool Throw = true, typename Tuple>
+		void vmcall_batch(address_t func_addr, std::span<const Tuple> args, std::span<address_t> results);
+
 		/// @brief Preempt is like vmcall() except it also stores and
 		/// restores the current registers and counters before and after
 		/// the interrupting function call is completed. It allows calling
@@ -374,6 +400,15 @@ namespace riscv
 		bool multiprocess(unsigned cpus, uint64_t maxi, address_t stack, address_t stksize,
 			std::function<void(Machine&)> per_machine_setup_cb = nullptr);
 		uint32_t multiprocess_wait();
+		// multiprocess_submit() queues a guest function call, and
+		// multiprocess_tasks() runs every queued call with long-lived
+		// forks that steal work from each other. Calls made from a running
+		// task go to the deque of the worker running it. The 32-bit counter
+		// at counter_addr (if any) is incremented as each task finishes.
+		// Returns a bitmap of the workers that had a failing task.
+		void multiprocess_submit(address_t func, std::array<address_t, 4> args = {});
+		uint32_t multiprocess_tasks(unsigned workers, uint64_t maxi, address_t stack, address_t stksize,
+			address_t counter_addr = 0, std::function<void(Machine&)> per_machine_setup_cb = nullptr);
 
 		// Returns true if this machine is forked from another, and thus
 		// dependent on the original machine to function properly.
@@ -421,6 +456,16 @@ namespace riscv
 		// Signal structure, lazily created
 		Signals<W>& signals();
 		SignalAction<W>& sigaction(int sig) { return signals().get(sig); }
+		// Sampling profiler, optional and shareable between machines (see profiler.hpp)
+		void set_profiler(std::shared_ptr<Profiler<W>> profiler) noexcept { m_profiler = std::move(profiler); }
+		Profiler<W>* profiler() const noexcept { return m_profiler.get(); }
+		// Blocking system calls, optionally offloaded to a shareable pool of host threads (see syscall_offload.hpp)
+		void set_syscall_offload(std::shared_ptr<SyscallOffload> offload) noexcept { m_offload = std::move(offload); }
+		SyscallOffload* syscall_offload() const noexcept { return m_offload.get(); }
+		// A parked machine is waiting for an offloaded system call, and must not be resumed
+		bool is_parked() const noexcept { return m_parked; }
+		// Run a blocking system call in the pool, parking the machine until it is completed
+		void offload_syscall(std::function<long()> work, std::function<void(Machine&, long)> completion = nullptr);
 
 #ifdef RISCV_TIMED_VMCALLS
 		template <typename... Args>
@@ -442,10 +487,27 @@ namespace riscv
 		/// @return Returns the total number of serialized bytes
 		size_t serialize_to(std::vector<uint8_t>& vec) const;
 
+		/// @brief Serializes the machine state, but only the memory pages that
+		/// changed since the previous delta. The first delta is a complete baseline,
+		/// and it begins recording changed pages. Deltas are restored by passing
+		/// the baseline and then each delta, in order, to deserialize_from().
+		/// @param vec The vector to serialize into (append)
+		/// @return Returns the total number of serialized bytes
+		size_t serialize_delta_to(std::vector<uint8_t>& vec);
+
+		/// @brief Serializes the machine state directly to a file descriptor,
+		/// without staging it in memory first.
+		/// @param fd The file descriptor to write to
+		/// @param delta Write a delta instead of the complete state (see serialize_delta_to)
+		/// @return Returns the total number of bytes written
+		size_t serialize_to_fd(int fd, bool delta = false);
+
 		/// @brief Returns the machine to a previously stored state
 		/// NOTE: All previous memory traps are lost, syscall handlers,
 		/// destructor callbacks are kept. Page fault handler and
 		/// symbol lookup cache is also kept. Returns 0 on success.
+		/// A delta is applied on top of the current memory, which must be
+		/// the state that the delta was made from.
 		/// @param vec The vector to deserialize from
 		/// @return Returns 0 on success, otherwise a non-zero integer
 		int deserialize_from(const std::vector<uint8_t>& vec);
@@ -458,6 +520,9 @@ namespace riscv
 		auto resolve_args(std::index_sequence<indices...>) const;
 		static void setup_native_heap_internal(const size_t);
 		[[noreturn]] void timeout_exception(uint64_t);
+		bool simulate_profiled(uint64_t max_instructions, uint64_t counter, address_t pc);
+		template <typename Writer>
+		size_t serialize_with(Writer&, const std::vector<address_t>* changed) const;
 
 		uint64_t     m_counter = 0;
 		uint64_t     m_max_counter = 0;
@@ -472,6 +537,10 @@ namespace riscv
 		std::unique_ptr<Multiprocessing<W>> m_smp = nullptr;
 		std::unique_ptr<Signals<W>> m_signals = nullptr;
 		std::shared_ptr<MachineOptions<W>> m_options = nullptr;
+		std::shared_ptr<Profiler<W>> m_profiler = nullptr;
+		std::shared_ptr<SyscallOffload> m_offload = nullptr;
+		bool m_parked = false;
+		std::exception_ptr m_offload_exception = nullptr; // Failed completion, rethrown by simulate()
 
 #ifdef RISCV_TIMED_VMCALLS
 	public:
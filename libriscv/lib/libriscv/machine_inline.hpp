@@ -16,7 +16,24 @@ template <int W>
 template <bool Throw>
 inline bool Machine<W>::simulate_with(uint64_t max_instr, uint64_t counter, address_t pc)
 {
-	const bool stopped_normally = cpu.simulate(pc, counter, max_instr);
+	if (UNLIKELY(m_offload_exception != nullptr)) {
+		// Completing an offloaded system call failed
+		auto except = std::move(m_offload_exception);
+		m_offload_exception = nullptr;
+		std::rethrow_exception(except);
+	}
+	bool stopped_normally;
+	if (UNLIKELY(m_profiler != nullptr)) {
+		stopped_normally = this->simulate_profiled(max_instr, counter, pc);
+	} else {
+#ifdef RISCV_BINARY_TRANSLATION
+		stopped_normally = LIKELY(cpu.current_execute_segment().translation_profile() == nullptr)
+			? cpu.simulate(pc, counter, max_instr)
+			: cpu.simulate_tiered(pc, counter, max_instr);
+#else
+		stopped_normally = cpu.simulate(pc, counter, max_instr);
+#endif
+	}
 	if constexpr (Throw) {
 		// The simulation either ends normally, or it throws an exception
 		if (UNLIKELY(!stopped_normally))
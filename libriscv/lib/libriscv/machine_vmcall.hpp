@@ -45,6 +45,46 @@ inline address_type<W> Machine<W>::vmcall(address_t pc, Args&&... args)
 	return cpu.reg(REG_ARG0);
 }
 
+template <int W>
+template <uint64_t MAXI, bool Throw, typename Tuple>
+inline void Machine<W>::vmcall_batch(address_t pc, std::span<const Tuple> args, std::span<address_t> results)
+{
+	if (UNLIKELY(results.size() < args.size()))
+		throw MachineException(ILLEGAL_OPERATION, "vmcall_batch: Not enough room for the results", results.size());
+
+	// The same stack pointer and return address for every call
+	const address_t sp = memory.stack_initial() & ~address_t(0xF);
+	const address_t ra = memory.exit_address();
+	auto& regs = cpu.registers();
+
+	for (size_t i = 0; i < args.size(); i++)
+	{
+		regs.get(REG_SP) = sp;
+		regs.get(REG_RA) = ra;
+		std::apply([&regs] (const auto&... arg) {
+			[[maybe_unused]] int iarg = REG_ARG0;
+			[[maybe_unused]] int farg = REG_FA0;
+			([&] {
+				using T = remove_cvref<decltype(arg)>;
+				if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) {
+					regs.get(iarg++) = address_t(arg);
+					if constexpr (sizeof(T) > W) // upper 32-bits for 64-bit integers
+						regs.get(iarg++) = uint64_t(arg) >> 32;
+				}
+				else if constexpr (std::is_same_v<float, T>)
+					regs.getfl(farg++).set_float(arg);
+				else if constexpr (std::is_same_v<double, T>)
+					regs.getfl(farg++).f64 = arg;
+				else
+					static_assert(always_false<T>, "vmcall_batch: Arguments must be integers or floating-point");
+			}(), ...);
+		}, args[i]);
+
+		this->simulate_with<Throw>(MAXI, 0u, pc);
+		results[i] = regs.get(REG_ARG0);
+	}
+}
+
 template <int W>
 template <uint64_t MAXI, bool Throw, typename... Args> constexpr
 inline address_type<W> Machine<W>::vmcall(const char* funcname, Args&&... args)
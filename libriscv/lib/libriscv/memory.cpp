@@ -242,7 +242,30 @@ namespace riscv
 		}
 
 		// Load into virtual memory
-		this->memcpy(vaddr, src, len);
+		if (options.zero_copy_segments && options.protect_segments
+			&& (uintptr_t(src) - vaddr) % Page::size() == 0)
+		{
+			// Share the whole pages of the segment, and copy the partial pages
+			address_t begin = (vaddr + Page::size()-1) & ~address_t(Page::size()-1);
+			const address_t end = (vaddr + len) & ~address_t(Page::size()-1);
+			// The flat arena is read directly, and cannot share pages
+			if (uses_flat_memory_arena())
+				begin = std::max(begin, address_t(m_arena.pages * Page::size()));
+			if (begin < end) {
+				this->memcpy(vaddr, src, begin - vaddr);
+				this->insert_non_owned_memory(begin, (void*)&src[begin - vaddr], end - begin, {
+					.read  = attr.read,
+					.write = false,
+					.exec  = attr.exec,
+					.is_cow = attr.write
+				});
+				this->memcpy(end, &src[end - vaddr], vaddr + len - end);
+			} else {
+				this->memcpy(vaddr, src, len);
+			}
+		} else {
+			this->memcpy(vaddr, src, len);
+		}
 
 		if (options.protect_segments) {
 			this->set_page_attr(vaddr, len, attr);
@@ -462,6 +485,22 @@ namespace riscv
 		// Some machines don't need custom PF handlers
 		this->m_page_fault_handler = master.memory.m_page_fault_handler;
 
+		if (options.use_memory_arena) {
+			this->m_arena.data = master.memory.m_arena.data;
+			this->m_arena.pages = master.memory.m_arena.pages;
+			this->m_arena.read_boundary = master.memory.m_arena.read_boundary;
+			this->m_arena.write_boundary = master.memory.m_arena.write_boundary;
+			this->m_arena.initial_rodata_end = master.memory.m_arena.initial_rodata_end;
+		}
+
+		if (options.fork_dirty_tracking) {
+			this->m_dirty.tracking = true;
+			this->m_dirty.minimal  = options.minimal_fork;
+			// Arena writes must go through the page tables to be recorded
+			this->m_arena.write_boundary = 0;
+			this->m_dirty.arena_bitmap.resize((this->m_arena.pages + 63) / 64);
+		}
+
 		if (options.minimal_fork == false)
 		{
 			// Hardly any pages are dont_fork, so we estimate that
@@ -473,44 +512,112 @@ namespace riscv
 				const auto& page = it.second;
 				// Skip pages marked as dont_fork
 				if (page.attr.dont_fork) continue;
-				// Make every page non-owning
-				auto attr = page.attr;
-				if (attr.write) {
-					attr.write = false;
-					attr.is_cow = true;
-				}
-				attr.non_owning = true;
 				m_pages.try_emplace(
 					it.first,
-					attr, page.m_page.get()
+					fork_attributes(master.memory, it.first, page), page.m_page.get()
 				);
 			}
 		}
-		this->m_start_address = master.memory.m_start_address;
-		this->m_stack_address = master.memory.m_stack_address;
-		this->m_exit_address = master.memory.m_exit_address;
-		this->m_heap_address = master.memory.m_heap_address;
-		this->m_mmap_address = master.memory.m_mmap_address;
-		this->m_mmap_cache   = master.memory.m_mmap_cache;
+		this->fork_state_from(master.memory);
+	}
 
-		// Reference the same execute segments
-		this->m_exec_segs = master.memory.m_exec_segs;
-		for (size_t i = 0; i < m_exec_segs; i++) {
-			this->m_exec[i] = master.memory.m_exec[i];
-		}
+	template <int W>
+	PageAttributes Memory<W>::fork_attributes(const Memory& master, address_t pageno, const Page& page) const noexcept
+	{
+		// Make every page non-owning
+		auto attr = page.attr;
+		// Tracked forks write to shared arena pages in place
+		const bool arena_page = m_dirty.tracking && m_arena.data != nullptr
+			&& pageno < m_arena.pages && page.m_page.get() == &master.m_arena.data[pageno];
+		if (attr.write && !arena_page) {
+			attr.write = false;
+			attr.is_cow = true;
+		}
+		attr.non_owning = true;
+		return attr;
+	}
 
-		if (options.use_memory_arena) {
-			this->m_arena.data = master.memory.m_arena.data;
-			this->m_arena.pages = master.memory.m_arena.pages;
-			this->m_arena.read_boundary = master.memory.m_arena.read_boundary;
-			this->m_arena.write_boundary = master.memory.m_arena.write_boundary;
-			this->m_arena.initial_rodata_end = master.memory.m_arena.initial_rodata_end;
+	template <int W>
+	void Memory<W>::fork_state_from(const Memory& master)
+	{
+		this->m_start_address = master.m_start_address;
+		this->m_stack_address = master.m_stack_address;
+		this->m_exit_address = master.m_exit_address;
+		this->m_heap_address = master.m_heap_address;
+		this->m_mmap_address = master.m_mmap_address;
+		this->m_mmap_cache   = master.m_mmap_cache;
+
+		// Reference the same execute segments
+		this->m_exec_segs = master.m_exec_segs;
+		for (size_t i = 0; i < MAX_EXECUTE_SEGS; i++) {
+			this->m_exec[i] = (i < m_exec_segs) ? master.m_exec[i] : nullptr;
 		}
 
 		// invalidate all cached pages, because references are invalidated
 		this->invalidate_reset_cache();
 	}
 
+	template <int W>
+	void Memory<W>::save_arena_page(address_t pageno, const Page& page)
+	{
+		// Only pages backed by the shared arena are written in place
+		if (pageno >= m_arena.pages || page.data() != m_arena.data[pageno].buffer8.data())
+			return;
+		auto& word = m_dirty.arena_bitmap[pageno / 64];
+		const uint64_t bit = uint64_t(1) << (pageno % 64);
+		if (word & bit)
+			return;
+		word |= bit;
+
+		// Saved pages are kept between resets, to be reused
+		const size_t index = m_dirty.arena_pages.size();
+		m_dirty.arena_pages.push_back(pageno);
+		if (index == m_dirty.arena_saved.size())
+			m_dirty.arena_saved.emplace_back(new PageData(PageData::UNINITIALIZED));
+		std::memcpy(m_dirty.arena_saved[index]->buffer8.data(), page.data(), Page::size());
+	}
+
+	template <int W>
+	void Memory<W>::reset_to(const Memory& main)
+	{
+		if (UNLIKELY(!m_dirty.tracking))
+			throw MachineException(ILLEGAL_OPERATION, "Fork was not created with dirty page tracking");
+
+		// Return every changed page-table entry to the page loaned from main
+		for (const address_t pageno : m_dirty.pages)
+		{
+			auto it = main.m_pages.find(pageno);
+			if (m_dirty.minimal || it == main.m_pages.end() || it->second.attr.dont_fork) {
+				m_pages.erase(pageno);
+				continue;
+			}
+			const auto& page = it->second;
+			const auto attr = fork_attributes(main, pageno, page);
+			auto res = m_pages.try_emplace(pageno, attr, page.m_page.get());
+			if (!res.second) {
+				Page& mine = res.first->second;
+				mine.new_data(page.m_page.get(), false);
+				mine.attr = attr;
+			}
+		}
+		m_dirty.pages.clear();
+		m_dirty.seen.clear();
+
+		// Restore the arena pages that were written in place
+		for (size_t i = 0; i < m_dirty.arena_pages.size(); i++)
+		{
+			const address_t pageno = m_dirty.arena_pages[i];
+			std::memcpy(m_arena.data[pageno].buffer8.data(), m_dirty.arena_saved[i]->buffer8.data(), Page::size());
+			m_dirty.arena_bitmap[pageno / 64] &= ~(uint64_t(1) << (pageno % 64));
+		}
+		m_dirty.arena_pages.clear();
+
+#ifdef RISCV_EXT_ATOMICS
+		this->m_atomics = main.m_atomics;
+#endif
+		this->fork_state_from(main);
+	}
+
 	template <int W>
 	std::string Memory<W>::get_page_info(address_t addr) const
 	{
@@ -1,10 +1,12 @@
 #pragma once
 #include "elf.hpp"
 #include "page.hpp"
+#include "page_table.hpp"
 #include <cassert>
 #include <cstring>
 #include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include "decoded_exec_segment.hpp"
 #include "mmap_cache.hpp"
 #include "util/buffer.hpp" // <string>
@@ -205,6 +207,11 @@ namespace riscv
 
 		const auto& binary() const noexcept { return m_binary; }
 		void reset();
+		// Return a fork to the memory of the main machine it was forked from,
+		// restoring only the pages it changed. Requires fork_dirty_tracking.
+		void reset_to(const Memory& main);
+		// The number of page-table entries and arena pages that a reset_to() will restore
+		size_t dirty_pages() const noexcept { return m_dirty.pages.size() + m_dirty.arena_pages.size(); }
 		bool is_dynamic_executable() const noexcept { return this->m_is_dynamic; }
 
 		bool uses_flat_memory_arena() const noexcept { return riscv::flat_readwrite_arena && this->m_arena.data != nullptr; }
@@ -219,7 +226,7 @@ namespace riscv
 		// Serializes the current memory state to an existing vector
 		// Returns the final size of the serialized state
 		size_t serialize_to(std::vector<uint8_t>& vec) const;
-		// Returns memory to a previously stored state
+		// Returns memory to a previously stored state, or applies a delta to it
 		void deserialize_from(const std::vector<uint8_t>&, const SerializedMachine<W>&);
 
 		Memory(Machine<W>&, std::string_view, MachineOptions<W>);
@@ -262,9 +269,26 @@ namespace riscv
 		void binary_loader(const MachineOptions<W>&);
 		void binary_load_ph(const MachineOptions<W>&, const typename Elf::ProgramHeader*, address_t vaddr);
 		void serialize_execute_segment(const MachineOptions<W>&, const typename Elf::ProgramHeader*, address_t vaddr);
+		// True when the page points into the binary (see zero_copy_segments)
+		bool is_binary_page(const Page& page) const noexcept {
+			const auto* data = (const char *)page.data();
+			return page.attr.non_owning && data >= m_binary.data() && data < m_binary.data() + m_binary.size();
+		}
 		void generate_decoder_cache(const MachineOptions<W>&, std::shared_ptr<DecodedExecuteSegment<W>>&, bool is_initial);
 		// Machine copy-on-write fork
 		void machine_loader(const Machine<W>&, const MachineOptions<W>&);
+		void fork_state_from(const Memory&);
+		PageAttributes fork_attributes(const Memory&, address_t pageno, const Page&) const noexcept;
+		// Fork dirty tracking
+		void mark_dirty(address_t pageno) {
+			if (UNLIKELY(m_dirty.tracking) && m_dirty.seen.insert(pageno).second)
+				m_dirty.pages.push_back(pageno);
+		}
+		void save_arena_page(address_t pageno, const Page&);
+		// Delta serialization
+		bool next_serialize_delta(std::vector<address_t>& changed);
+		template <typename Writer>
+		void serialize_pages(Writer&, const std::vector<address_t>* changed) const;
 
 		address_t m_start_address = 0;
 		address_t m_stack_address = 0;
@@ -277,7 +301,7 @@ namespace riscv
 		mutable CachedPage<W, const PageData> m_rd_cache;
 		mutable CachedPage<W, PageData> m_wr_cache;
 
-		std::unordered_map<address_t, Page> m_pages;
+		PageTable<W> m_pages;
 
 		const bool m_original_machine;
 		bool m_is_dynamic = false;
@@ -310,7 +334,23 @@ namespace riscv
 			size_t    pages = 0;
 		} m_arena;
 
+		// Pages changed by a tracked fork since it was created or reset,
+		// or since the previous delta serialization. Arena pages are written
+		// in place, so they are saved before their first write, and the
+		// bitmap prevents saving a page twice.
+		struct {
+			std::vector<address_t> pages;
+			std::unordered_set<address_t> seen;
+			std::vector<address_t> arena_pages;
+			std::vector<uint64_t>  arena_bitmap;
+			std::vector<std::unique_ptr<PageData>> arena_saved;
+			bool tracking = false;
+			bool minimal  = false;
+			bool delta    = false;
+		} m_dirty;
+
 		friend struct CPU<W>;
+		friend struct Machine<W>;
 	};
 #include "memory_inline.hpp"
 #include "memory_inline_pages.hpp"
@@ -81,6 +81,7 @@ template <int W>
 template <typename... Args> inline
 Page& Memory<W>::allocate_page(const address_t page, Args&&... args)
 {
+	this->mark_dirty(page);
 	const auto it = m_pages.try_emplace(
 		page,
 		std::forward<Args> (args)...
@@ -108,6 +109,7 @@ inline void Memory<W>::trap(address_t page_addr, mmio_cb_t callback)
 	// a page if it doesn't exist. At least this way the trap will
 	// always work. Less surprises this way.
 	auto& page = create_writable_pageno(page_number(page_addr));
+	this->mark_dirty(page_number(page_addr));
 	// Disabling caching will force the slow-path for the page,
 	// and enables page traps when RISCV_DEBUG is enabled.
 	page.attr.cacheable = false;
@@ -27,12 +27,17 @@ namespace riscv
 		if (LIKELY(it != m_pages.end())) {
 			Page& page = it->second;
 			if (LIKELY(page.attr.write)) {
+				if (UNLIKELY(m_dirty.tracking)) {
+					this->mark_dirty(pageno);
+					this->save_arena_page(pageno, page);
+				}
 				return page;
 			} else if (page.attr.is_cow) {
 				m_page_write_handler(*this, pageno, page);
 				// The page may be read-cached at this time
 				// and the page data has likely changed now.
 				this->invalidate_cache(pageno, &page);
+				this->mark_dirty(pageno);
 				return page;
 			}
 		} else {
@@ -40,6 +45,8 @@ namespace riscv
 			Page& page = m_page_fault_handler(*this, pageno, init);
 			if (LIKELY(page.attr.write)) {
 				this->invalidate_cache(pageno, &page);
+				if (UNLIKELY(m_dirty.tracking))
+					this->save_arena_page(pageno, page);
 				return page;
 			}
 		}
@@ -49,14 +56,16 @@ namespace riscv
 	template <int W>
 	void Memory<W>::set_pageno_attr(const address_t pageno, PageAttributes attr)
 	{
+		this->mark_dirty(pageno);
 		auto it = pages().find(pageno);
 		if (it != pages().end()) {
 			auto& page = it->second;
 			// Keep non-owning and is_cow attributes
 			const bool is_cow = page.attr.is_cow;
 			page.attr.apply_regular_attributes(attr);
-			// If the page becomes writable and holds the CoW-page data, it's also copy-on-write
-			if (is_cow || (attr.write && page.is_cow_page())) {
+			// If the page becomes writable and holds the CoW-page data
+			// or a page of the program binary, it's also copy-on-write
+			if (is_cow || (attr.write && (page.is_cow_page() || is_binary_page(page)))) {
 				page.attr.is_cow = true;
 				page.attr.write = false;
 			}
@@ -103,6 +112,10 @@ namespace riscv
 			// If we don't find a page, we can treat it as a CoW zero page
 			if (it != m_pages.end()) {
 				Page& page = it->second;
+				if (UNLIKELY(m_dirty.tracking)) {
+					this->mark_dirty(pageno);
+					this->save_arena_page(pageno, page);
+				}
 				if (page.is_cow_page()) {
 					// This is the zero-page
 				} else {
@@ -134,7 +147,7 @@ namespace riscv
 					// Fast-path using madvise
 					if constexpr (MADVISE_ENABLED) {
 						// XXX: doesn't scale on busy server
-						if (offset == 0 && size == Page::size()) {
+						if (offset == 0 && size == Page::size() && !m_dirty.tracking) {
 							address_t new_dst = dst + (len & ~address_t(Page::size()-1));
 							new_dst = std::min(new_dst, (address_t)memory_arena_size());
 							const size_t new_size = new_dst - dst;
@@ -170,6 +183,7 @@ namespace riscv
 	template <int W>
 	bool Memory<W>::free_pageno(address_t pageno)
 	{
+		this->mark_dirty(pageno);
 		return m_pages.erase(pageno) != 0;
 	}
 
@@ -256,6 +270,7 @@ namespace riscv
 
 		auto attr = shared_page.attr;
 		attr.non_owning = true;
+		this->mark_dirty(pageno);
 		// NOTE: If you insert a const Page, DON'T modify it! The machine
 		// won't, unless system-calls do or manual intervention happens!
 		auto res = m_pages.try_emplace(
@@ -285,6 +300,7 @@ namespace riscv
 		{
 			const auto pageno = (dst + i) / Page::size();
 			PageData* pdata = reinterpret_cast<PageData*> ((char*) src + i);
+			this->mark_dirty(pageno);
 			m_pages.try_emplace(
 				pageno,
 				attr, pdata
@@ -22,6 +22,49 @@ bool Machine<W>::is_multiprocessing() const noexcept
 
 #ifdef RISCV_MULTIPROCESS
 
+// The scheduler and worker running tasks on this thread, if any
+static thread_local void* current_scheduler = nullptr;
+static thread_local size_t current_worker = 0;
+
+// Forks use the memory of the master machine, except for the stack
+template <int W>
+static void loan_master_memory(Machine<W>& master, Machine<W>& fork,
+	uint64_t stackpage, uint64_t stackendpage)
+{
+	using address_t = address_type<W>;
+	// For most workloads, we will only need a copy-on-write handler
+	fork.memory.set_page_write_handler(
+	[=, &master] (auto&, address_t pageno, Page& page)
+	{
+		if (pageno >= stackpage && pageno < stackendpage) {
+			page.make_writable();
+			return;
+		}
+		// Release old page if non-owned
+		if (page.attr.non_owning && page.m_page.get() != nullptr)
+			page.m_page.release();
+
+		std::lock_guard<std::mutex> lk(master.smp().m_lock);
+		// Retrieve writable page in main VM
+		auto& master_page = master.memory.create_writable_pageno(pageno);
+		// Return back page with memory loaned from master VM
+		page.loan(master_page);
+	});
+	fork.memory.set_page_readf_handler(
+	[&master] (auto&, address_t pageno) -> const Page& {
+		std::lock_guard<std::mutex> lk(master.smp().m_lock);
+		return master.memory.get_pageno(pageno);
+	});
+	fork.memory.set_page_fault_handler(
+	[=, &master] (auto& mem, const address_t pageno, bool init) -> Page& {
+		if (pageno >= stackpage && pageno < stackendpage) {
+			return mem.create_writable_pageno(pageno, init);
+		}
+		std::lock_guard<std::mutex> lk(master.smp().m_lock);
+		return master.memory.create_writable_pageno(pageno, init);
+	});
+}
+
 template <int W>
 Multiprocessing<W>::Multiprocessing(size_t workers)
 	: m_threadpool { workers }  {}
@@ -43,6 +86,46 @@ typename Multiprocessing<W>::failure_bits_t Multiprocessing<W>::wait()
 	return this->failures;
 }
 
+template <int W>
+void Multiprocessing<W>::submit_task(size_t worker, const Task& task)
+{
+	if (UNLIKELY(m_deques == nullptr))
+		m_deques.reset(new TaskDeque[workers()]);
+	auto& deque = m_deques[worker % workers()];
+	// Counted before it can be taken, so that the count
+	// never reaches zero while a task is being submitted
+	m_unfinished_tasks.fetch_add(1, std::memory_order_relaxed);
+	std::lock_guard<std::mutex> lk(deque.lock);
+	deque.tasks.push_back(task);
+}
+template <int W>
+bool Multiprocessing<W>::take_task(size_t worker, Task& task)
+{
+	if (UNLIKELY(m_deques == nullptr))
+		return false;
+	const size_t count = workers();
+	{
+		auto& own = m_deques[worker];
+		std::lock_guard<std::mutex> lk(own.lock);
+		if (!own.tasks.empty()) {
+			task = own.tasks.back();
+			own.tasks.pop_back();
+			return true;
+		}
+	}
+	for (size_t i = 1; i < count; i++)
+	{
+		auto& victim = m_deques[(worker + i) % count];
+		std::lock_guard<std::mutex> lk(victim.lock);
+		if (!victim.tasks.empty()) {
+			task = victim.tasks.front();
+			victim.tasks.pop_front();
+			return true;
+		}
+	}
+	return false;
+}
+
 template <int W>
 bool Machine<W>::multiprocess(unsigned num_cpus, uint64_t maxi,
 	address_t stack, address_t stksize, std::function<void(Machine&)> setup_cb)
@@ -74,37 +157,7 @@ bool Machine<W>::multiprocess(unsigned num_cpus, uint64_t maxi,
 				fork.cpu.increment_pc(4); // Step over current ECALL
 				fork.cpu.reg(REG_ARG0) = id; // Return value
 
-				// For most workloads, we will only need a copy-on-write handler
-				fork.memory.set_page_write_handler(
-				[=, this] (auto&, address_t pageno, Page& page)
-				{
-					if (pageno >= stackpage && pageno < stackendpage) {
-						page.make_writable();
-						return;
-					}
-					// Release old page if non-owned
-					if (page.attr.non_owning && page.m_page.get() != nullptr)
-						page.m_page.release();
-
-					std::lock_guard<std::mutex> lk(this->m_smp->m_lock);
-					// Retrieve writable page in main VM
-					auto& master_page = this->memory.create_writable_pageno(pageno);
-					// Return back page with memory loaned from master VM
-					page.loan(master_page);
-				});
-				fork.memory.set_page_readf_handler(
-				[this] (auto&, address_t pageno) -> const Page& {
-					std::lock_guard<std::mutex> lk(this->smp().m_lock);
-					return this->memory.get_pageno(pageno);
-				});
-				fork.memory.set_page_fault_handler(
-				[=, this] (auto& mem, const address_t pageno, bool init) -> Page& {
-					if (pageno >= stackpage && pageno < stackendpage) {
-						return mem.create_writable_pageno(pageno, init);
-					}
-					std::lock_guard<std::mutex> lk(this->smp().m_lock);
-					return this->memory.create_writable_pageno(pageno, init);
-				});
+				loan_master_memory(*this, fork, stackpage, stackendpage);
 
 				if (setup_cb != nullptr)
 					setup_cb(fork);
@@ -131,6 +184,98 @@ uint32_t Machine<W>::multiprocess_wait()
 	return smp().wait();
 }
 
+template <int W>
+void Machine<W>::multiprocess_submit(address_t func, std::array<address_t, 4> args)
+{
+	const typename Multiprocessing<W>::Task task { func, args };
+	// From inside a running task: the workers own deque
+	if (current_scheduler != nullptr) {
+		auto* scheduler = (Multiprocessing<W> *)current_scheduler;
+		scheduler->submit_task(current_worker, task);
+		return;
+	}
+	auto& mp = smp();
+	mp.submit_task(mp.m_next_deque++, task);
+}
+
+template <int W>
+uint32_t Machine<W>::multiprocess_tasks(unsigned workers, uint64_t maxi,
+	address_t stack, address_t stksize, address_t counter_addr,
+	std::function<void(Machine&)> setup_cb)
+{
+	if (UNLIKELY(is_multiprocessing()))
+		return -1;
+	auto& mp = smp();
+	workers = std::max(1u, std::min(workers, unsigned(mp.workers())));
+
+	const uint64_t stackpage = Memory<W>::page_number(stack);
+	const uint64_t stackendpage = Memory<W>::page_number(stack + stksize);
+	const address_t stack_top = (stack + stksize) & ~address_t(0xF);
+	mp.failures = 0x0;
+
+	// The completion counter lives in (and stays in) a master page
+	uint32_t* counter = nullptr;
+	if (counter_addr != 0x0) {
+		if (UNLIKELY(counter_addr % sizeof(uint32_t) != 0))
+			throw MachineException(INVALID_ALIGNMENT, "Misaligned task counter", counter_addr);
+		counter = &memory.template writable_read<uint32_t> (counter_addr);
+	}
+
+	std::vector<std::function<void()>> work;
+	work.reserve(workers);
+
+	for (unsigned id = 1; id <= workers; id++)
+	{
+		work.push_back(
+		[=, this, &mp] {
+			const size_t worker = id - 1;
+			std::unique_ptr<Machine<W>> fork;
+			try {
+				// One long-lived fork runs every task taken by this worker
+				fork.reset(new Machine<W> { *this, { .cpu_id = id, .use_memory_arena = false } });
+				fork->set_userdata(this->get_userdata<void>());
+				fork->set_printer([] (const auto&, const char*, size_t) {});
+				loan_master_memory(*this, *fork, stackpage, stackendpage);
+
+				if (setup_cb != nullptr)
+					setup_cb(*fork);
+			} catch (...) {
+				__sync_fetch_and_or(&mp.failures, 1u << id);
+				fork = nullptr;
+			}
+			current_scheduler = &mp;
+			current_worker = worker;
+
+			typename Multiprocessing<W>::Task task;
+			while (mp.m_unfinished_tasks.load(std::memory_order_acquire) > 0)
+			{
+				if (!mp.take_task(worker, task)) {
+					std::this_thread::yield();
+					continue;
+				}
+				// Without a fork, the tasks are drained as failures
+				if (fork != nullptr) {
+					try {
+						fork->cpu.reg(REG_SP) = stack_top;
+						fork->setup_call(task.args[0], task.args[1], task.args[2], task.args[3]);
+						fork->template simulate_with<true> (maxi, 0u, task.func);
+					} catch (...) {
+						__sync_fetch_and_or(&mp.failures, 1u << id);
+					}
+				}
+				if (counter != nullptr)
+					__sync_fetch_and_add(counter, 1u);
+				mp.m_unfinished_tasks.fetch_sub(1, std::memory_order_acq_rel);
+			}
+			current_scheduler = nullptr;
+		});
+	} // foreach worker
+
+	mp.async_work(std::move(work));
+	// The main vCPU waits, just like with multiprocess()
+	return multiprocess_wait();
+}
+
 #else // RISCV_MULTIPROCESS
 
 template <int W>
@@ -142,6 +287,12 @@ bool Machine<W>::multiprocess(unsigned, uint64_t, address_t, address_t, std::fun
 }
 template <int W>
 uint32_t Machine<W>::multiprocess_wait() { return -1; }
+template <int W>
+void Machine<W>::multiprocess_submit(address_t, std::array<address_t, 4>) {}
+template <int W>
+uint32_t Machine<W>::multiprocess_tasks(unsigned, uint64_t, address_t, address_t, address_t, std::function<void(Machine&)>) {
+	return -1;
+}
 
 #endif // RISCV_MULTIPROCESS
 
@@ -3,6 +3,8 @@
 
 #ifdef RISCV_MULTIPROCESS
 #include "util/threadpool.h"
+#include <array>
+#include <deque>
 #else
 #include <cstddef>
 #include <cstdint>
@@ -14,11 +16,21 @@ template <int W>
 struct Multiprocessing
 {
 	using failure_bits_t = uint32_t;
+	using address_t = address_type<W>;
+	// A function call in the guest, run by multiprocess_tasks()
+	struct Task {
+		address_t func;
+		std::array<address_t, 4> args;
+	};
 
 	Multiprocessing(size_t);
 #ifdef RISCV_MULTIPROCESS
 	void async_work(std::vector<std::function<void()>>&& wrk);
 	failure_bits_t wait();
+	// Work-stealing task deques, one for each worker. A worker takes
+	// the newest task from its own deque, and the oldest from the others.
+	void submit_task(size_t worker, const Task& task);
+	bool take_task(size_t worker, Task& task);
 	bool is_multiprocessing() const noexcept { return this->processing; }
 	size_t workers() const noexcept { return m_threadpool.get_pool_size(); }
 
@@ -26,6 +38,13 @@ struct Multiprocessing
 	std::mutex m_lock;
 	bool processing = false;
 	failure_bits_t failures = 0; // Bitmap of failed vCPU tasks
+	struct TaskDeque {
+		std::mutex lock;
+		std::deque<Task> tasks;
+	};
+	std::unique_ptr<TaskDeque[]> m_deques;
+	size_t m_next_deque = 0;
+	std::atomic<size_t> m_unfinished_tasks = 0; // Queued or running
 	static constexpr bool shared_page_faults = true;
 	static constexpr bool shared_read_faults = true;
 #else
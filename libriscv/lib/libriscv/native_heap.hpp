@@ -5,8 +5,11 @@
 #pragma once
 #include "common.hpp"
 #include <cstddef>
+#include <array>
+#include <bit>
 #include <cassert>
 #include <deque>
+#include <unordered_map>
 #include "util/function.hpp"
 
 namespace riscv
@@ -34,6 +37,27 @@ struct ArenaChunk
 	void subsume_next(Arena&, size_t extra);
 };
 
+// A page-sized chunk divided into objects of a single size class.
+// Slabs are regular (used) chunks in the chunk list, and they are
+// released back to it when they become empty.
+struct ArenaSlab
+{
+	using PointerType = ArenaChunk::PointerType;
+	static constexpr unsigned SHIFT = 12;
+	static constexpr size_t   SIZE  = 1u << SHIFT;
+	static constexpr uint32_t NONE  = UINT32_MAX;
+
+	PointerType data = 0;
+	ArenaChunk* chunk = nullptr;
+	uint16_t size_class = 0;
+	uint16_t used = 0;
+	// Links in the list of slabs with free objects, for the size class
+	uint32_t next = NONE;
+	uint32_t prev = NONE;
+	// One bit per object, set when allocated
+	std::array<uint64_t, SIZE / 8 / 64> bitmap {};
+};
+
 struct Arena
 {
 	static constexpr size_t ALIGNMENT = 8u;
@@ -119,15 +143,43 @@ struct Arena
 		// The minimum allocation is 8 bytes
 		return std::max(ALIGNMENT, word_align(size));
 	}
+
+	// Small allocations are made from slabs, one size class per slab
+	static constexpr std::array<uint16_t, 12> SIZE_CLASSES {
+		8, 16, 24, 32, 48, 64, 96, 128, 192, 256, 384, 512
+	};
+	static constexpr size_t MAX_SLAB_OBJECT = SIZE_CLASSES.back();
+	size_t slabs_used() const noexcept { return m_slabs.size() - m_free_slabs.size(); }
 private:
 	void internal_free(ArenaChunk* ch);
 	void foreach(Function<void(const ArenaChunk&)>) const;
+	static unsigned size_class_of(size_t size);
+	PointerType slab_malloc(unsigned size_class);
+	ArenaSlab*  find_slab(PointerType ptr);
+	const ArenaSlab* find_slab(PointerType ptr) const;
+	bool        slab_owns(const ArenaSlab&, PointerType ptr) const;
+	void        slab_free(ArenaSlab&, PointerType ptr);
+	uint32_t    new_slab(unsigned size_class);
+	void        release_slab(uint32_t idx);
+	void        unlink_slab(uint32_t idx);
+	size_t      slab_bytes_free() const;
 
 	std::deque<ArenaChunk> m_chunks;
 	std::vector<ArenaChunk*> m_free_chunks;
 	ArenaChunk  m_base_chunk;
 	unsigned    m_max_chunks = 4'000u;
 
+	std::vector<ArenaSlab> m_slabs;
+	std::vector<uint32_t>  m_free_slabs;
+	// Slab index by address, for free(), size() and realloc()
+	std::unordered_map<PointerType, uint32_t> m_slab_index;
+	// The first slab with free objects, for each size class
+	std::array<uint32_t, SIZE_CLASSES.size()> m_partial_slabs = [] {
+		std::array<uint32_t, SIZE_CLASSES.size()> heads;
+		heads.fill(ArenaSlab::NONE);
+		return heads;
+	}();
+
 	unknown_free_func_t m_free_unknown_chunk
 		= [] (auto, auto*) { return -1; };
 	unknown_realloc_func_t m_realloc_unknown_chunk
@@ -251,6 +303,12 @@ inline void Arena::internal_free(ArenaChunk* ch)
 inline Arena::PointerType Arena::malloc(size_t size)
 {
 	const size_t length = fixup_size(size);
+	if (length <= MAX_SLAB_OBJECT) {
+		const PointerType ptr = slab_malloc(size_class_of(length));
+		if (LIKELY(ptr != 0))
+			return ptr;
+		// Without room for a new slab, use the chunk list
+	}
 	ArenaChunk* ch = base_chunk().find_free(length);
 
 	if (ch != nullptr) {
@@ -321,6 +379,23 @@ inline Arena::ReallocResult
 	if (ptr == 0x0) // Regular malloc
 		return {malloc(newsize), 0};
 
+	if (ArenaSlab* slab = find_slab(ptr); slab != nullptr)
+	{
+		if (UNLIKELY(!slab_owns(*slab, ptr)))
+			return m_realloc_unknown_chunk(ptr, newsize);
+		const size_t old_len = SIZE_CLASSES[slab->size_class];
+		if (fixup_size(newsize) <= old_len) // Already long enough?
+			return {ptr, 0};
+		// Objects cannot grow, so always move
+		const PointerType newptr = malloc(newsize);
+		if (newptr != 0x0) {
+			// The new allocation may have created or moved a slab
+			slab_free(*find_slab(ptr), ptr);
+			return {newptr, old_len};
+		}
+		return {0x0, 0x0};
+	}
+
 	ArenaChunk* ch = base_chunk().find(ptr);
 	if (UNLIKELY(ch == nullptr || ch->free)) {
 		// Realloc failure handler
@@ -352,6 +427,12 @@ inline Arena::ReallocResult
 
 inline size_t Arena::size(PointerType ptr, bool allow_free)
 {
+	if (const ArenaSlab* slab = find_slab(ptr); slab != nullptr) {
+		const size_t objsize = SIZE_CLASSES[slab->size_class];
+		if (slab_owns(*slab, ptr) || (allow_free && (ptr - slab->data) % objsize == 0))
+			return objsize;
+		return 0;
+	}
 	ArenaChunk* ch = base_chunk().find(ptr);
 	if (UNLIKELY(ch == nullptr || (ch->free && !allow_free)))
 		return 0;
@@ -360,6 +441,12 @@ inline size_t Arena::size(PointerType ptr, bool allow_free)
 
 inline int Arena::free(PointerType ptr)
 {
+	if (ArenaSlab* slab = find_slab(ptr); slab != nullptr) {
+		if (UNLIKELY(!slab_owns(*slab, ptr)))
+			return m_free_unknown_chunk(ptr, nullptr);
+		slab_free(*slab, ptr);
+		return 0;
+	}
 	ArenaChunk* ch = base_chunk().find(ptr);
 	if (UNLIKELY(ch == nullptr || ch->free))
 		return m_free_unknown_chunk(ptr, ch);
@@ -390,7 +477,7 @@ inline size_t Arena::bytes_free() const
 	foreach([&size] (const ArenaChunk& chunk) {
 		if (chunk.free) size += chunk.size;
 	});
-	return size;
+	return size + slab_bytes_free();
 }
 inline size_t Arena::bytes_used() const
 {
@@ -398,7 +485,7 @@ inline size_t Arena::bytes_used() const
 	foreach([&size] (const ArenaChunk& chunk) {
 		if (!chunk.free) size += chunk.size;
 	});
-	return size;
+	return size - slab_bytes_free();
 }
 
 inline Arena::Arena(const Arena& other)
@@ -411,6 +498,18 @@ inline void Arena::transfer(Arena& dest) const
 	dest.m_base_chunk = m_base_chunk;
 	dest.m_chunks.clear();
 	dest.m_free_chunks.clear();
+	dest.m_slabs = m_slabs;
+	dest.m_free_slabs = m_free_slabs;
+	dest.m_slab_index = m_slab_index;
+	dest.m_partial_slabs = m_partial_slabs;
+	// Slabs point to their chunks, which are copied below
+	const auto relink_slab = [&] (const ArenaChunk* chunk, ArenaChunk* new_chunk) {
+		if (chunk->free) return;
+		auto it = m_slab_index.find(chunk->data >> ArenaSlab::SHIFT);
+		if (it != m_slab_index.end() && m_slabs[it->second].chunk == chunk)
+			dest.m_slabs[it->second].chunk = new_chunk;
+	};
+	relink_slab(&m_base_chunk, &dest.m_base_chunk);
 
 	ArenaChunk* last = &dest.m_base_chunk;
 
@@ -424,9 +523,184 @@ inline void Arena::transfer(Arena& dest) const
 		last->next = &new_chunk;
 		/* New last before next iteration */
 		last = &new_chunk;
+		relink_slab(chunk, &new_chunk);
 
 		chunk = chunk->next;
 	}
 }
 
+inline unsigned Arena::size_class_of(size_t size)
+{
+	// Size class by (size / 8), for fixed-up sizes
+	static constexpr auto table = [] {
+		std::array<uint8_t, MAX_SLAB_OBJECT / ALIGNMENT + 1> table {};
+		unsigned cls = 0;
+		for (size_t i = 1; i < table.size(); i++) {
+			while (SIZE_CLASSES[cls] < i * ALIGNMENT)
+				cls++;
+			table[i] = cls;
+		}
+		return table;
+	}();
+	return table[size / ALIGNMENT];
+}
+
+inline ArenaSlab* Arena::find_slab(PointerType ptr)
+{
+	if (m_slab_index.empty())
+		return nullptr;
+	auto it = m_slab_index.find(ptr >> ArenaSlab::SHIFT);
+	return (it != m_slab_index.end()) ? &m_slabs[it->second] : nullptr;
+}
+inline const ArenaSlab* Arena::find_slab(PointerType ptr) const
+{
+	return const_cast<Arena*>(this)->find_slab(ptr);
+}
+
+inline bool Arena::slab_owns(const ArenaSlab& slab, PointerType ptr) const
+{
+	const size_t objsize = SIZE_CLASSES[slab.size_class];
+	const size_t offset = ptr - slab.data;
+	if (offset % objsize != 0)
+		return false;
+	const size_t slot = offset / objsize;
+	// Objects past the end of the slab are always marked as allocated
+	return slot < ArenaSlab::SIZE / objsize
+		&& (slab.bitmap[slot / 64] & (1ull << (slot % 64))) != 0;
+}
+
+inline Arena::PointerType Arena::slab_malloc(unsigned size_class)
+{
+	uint32_t idx = m_partial_slabs[size_class];
+	if (idx == ArenaSlab::NONE) {
+		idx = new_slab(size_class);
+		if (idx == ArenaSlab::NONE)
+			return 0;
+	}
+	ArenaSlab& slab = m_slabs[idx];
+	const size_t objsize = SIZE_CLASSES[size_class];
+
+	// A slab in the partial list always has a free object
+	for (size_t w = 0; w < slab.bitmap.size(); w++) {
+		const uint64_t free_bits = ~slab.bitmap[w];
+		if (free_bits != 0) {
+			const unsigned bit = std::countr_zero(free_bits);
+			slab.bitmap[w] |= 1ull << bit;
+			if (++slab.used == ArenaSlab::SIZE / objsize)
+				unlink_slab(idx);
+			return slab.data + (w * 64 + bit) * objsize;
+		}
+	}
+	return 0;
+}
+
+inline void Arena::slab_free(ArenaSlab& slab, PointerType ptr)
+{
+	const size_t objsize = SIZE_CLASSES[slab.size_class];
+	const size_t slot = (ptr - slab.data) / objsize;
+	slab.bitmap[slot / 64] &= ~(1ull << (slot % 64));
+	const uint32_t idx = &slab - m_slabs.data();
+
+	if (slab.used-- == ArenaSlab::SIZE / objsize) {
+		// The slab was full, and now has a free object
+		auto& head = m_partial_slabs[slab.size_class];
+		slab.prev = ArenaSlab::NONE;
+		slab.next = head;
+		if (head != ArenaSlab::NONE)
+			m_slabs[head].prev = idx;
+		head = idx;
+	}
+	// Keep one empty slab per size class, so that repeatedly
+	// allocating and freeing a single object stays cheap
+	if (slab.used == 0 && (m_partial_slabs[slab.size_class] != idx || slab.next != ArenaSlab::NONE))
+		release_slab(idx);
+}
+
+inline uint32_t Arena::new_slab(unsigned size_class)
+{
+	// Find a free chunk that can hold a slab-aligned slab
+	constexpr PointerType MASK = ArenaSlab::SIZE - 1;
+	ArenaChunk* ch = &m_base_chunk;
+	PointerType aligned = 0;
+	for (; ch != nullptr; ch = ch->next) {
+		if (!ch->free) continue;
+		aligned = (ch->data + MASK) & ~MASK;
+		if (aligned >= ch->data && (aligned - ch->data) + ArenaSlab::SIZE <= ch->size)
+			break;
+	}
+	if (ch == nullptr)
+		return ArenaSlab::NONE;
+
+	// Split off the unaligned beginning and the remainder
+	if (aligned != ch->data) {
+		ch->split_next(*this, aligned - ch->data);
+		ch = ch->next;
+	}
+	if (ch->size > ArenaSlab::SIZE)
+		ch->split_next(*this, ArenaSlab::SIZE);
+	ch->free = false;
+
+	uint32_t idx;
+	if (!m_free_slabs.empty()) {
+		idx = m_free_slabs.back();
+		m_free_slabs.pop_back();
+	} else {
+		idx = m_slabs.size();
+		m_slabs.emplace_back();
+	}
+	ArenaSlab& slab = m_slabs[idx];
+	slab = ArenaSlab {};
+	slab.data = aligned;
+	slab.chunk = ch;
+	slab.size_class = size_class;
+	// Objects past the end of the slab are never handed out
+	for (size_t slot = ArenaSlab::SIZE / SIZE_CLASSES[size_class]; slot < slab.bitmap.size() * 64; slot++)
+		slab.bitmap[slot / 64] |= 1ull << (slot % 64);
+
+	m_slab_index.emplace(aligned >> ArenaSlab::SHIFT, idx);
+	auto& head = m_partial_slabs[size_class];
+	slab.next = head;
+	if (head != ArenaSlab::NONE)
+		m_slabs[head].prev = idx;
+	head = idx;
+	return idx;
+}
+
+inline void Arena::unlink_slab(uint32_t idx)
+{
+	ArenaSlab& slab = m_slabs[idx];
+	if (slab.prev != ArenaSlab::NONE)
+		m_slabs[slab.prev].next = slab.next;
+	else
+		m_partial_slabs[slab.size_class] = slab.next;
+	if (slab.next != ArenaSlab::NONE)
+		m_slabs[slab.next].prev = slab.prev;
+	slab.next = slab.prev = ArenaSlab::NONE;
+}
+
+inline void Arena::release_slab(uint32_t idx)
+{
+	ArenaSlab& slab = m_slabs[idx];
+	unlink_slab(idx);
+	m_slab_index.erase(slab.data >> ArenaSlab::SHIFT);
+	this->internal_free(slab.chunk);
+	slab.chunk = nullptr;
+	m_free_slabs.push_back(idx);
+}
+
+inline size_t Arena::slab_bytes_free() const
+{
+	// Empty slabs are free in their entirety
+	size_t size = 0;
+	for (const auto& slab : m_slabs) {
+		if (slab.chunk == nullptr) continue;
+		const size_t objsize = SIZE_CLASSES[slab.size_class];
+		if (slab.used == 0)
+			size += ArenaSlab::SIZE;
+		else
+			size += (ArenaSlab::SIZE / objsize - slab.used) * objsize;
+	}
+	return size;
+}
+
 } // namespace riscv
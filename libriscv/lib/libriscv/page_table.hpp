@@ -0,0 +1,238 @@
+#pragma once
+#include "page.hpp"
+#include <array>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+
+namespace riscv
+{
+	// A multi-level radix tree of pages, indexed by page number.
+	// It provides the subset of the std::unordered_map interface that
+	// Memory uses, so that the two can be swapped at configure-time.
+	// Lookups are a fixed number of array indexings, iteration is in
+	// ascending page order, and page references stay valid until the
+	// page is erased. Page numbers beyond the reach of the tree (above
+	// 48-bit addresses on 64- and 128-bit) are kept in a regular map.
+	template <int W>
+	struct RadixPageTable
+	{
+		using address_t   = address_type<W>;
+		using key_type    = address_t;
+		using mapped_type = Page;
+		using value_type  = std::pair<const address_t, Page>;
+		using overflow_t  = std::unordered_map<address_t, Page>;
+
+		static constexpr unsigned page_shift() noexcept {
+			unsigned shift = 0;
+			while ((size_t(1) << shift) < Page::size()) shift++;
+			return shift;
+		}
+		static constexpr unsigned ADDRESS_BITS = (W == 4) ? 32 : 48;
+		static constexpr unsigned KEY_BITS   = ADDRESS_BITS - page_shift();
+		static constexpr unsigned LEVEL_BITS = (W == 4) ? 10 : 9;
+		static constexpr unsigned LEVELS = (KEY_BITS + LEVEL_BITS - 1) / LEVEL_BITS;
+		static constexpr unsigned TREE_BITS = LEVELS * LEVEL_BITS;
+		static constexpr size_t   FANOUT = size_t(1) << LEVEL_BITS;
+		static_assert(LEVELS >= 2, "The radix tree needs at least two levels");
+
+		template <unsigned Level> struct Node;
+		// The last level holds the pages
+		template <unsigned Level>
+		using child_t = std::conditional_t<Level + 1 == LEVELS, value_type, Node<Level + 1>>;
+		template <unsigned Level>
+		struct Node {
+			std::array<std::unique_ptr<child_t<Level>>, FANOUT> child {};
+			unsigned count = 0;
+		};
+
+		struct iterator
+		{
+			value_type& operator* () const noexcept { return *m_ptr; }
+			value_type* operator-> () const noexcept { return m_ptr; }
+			bool operator== (const iterator& other) const noexcept { return m_ptr == other.m_ptr; }
+			bool operator!= (const iterator& other) const noexcept { return m_ptr != other.m_ptr; }
+			iterator& operator++ () {
+				if (!m_in_overflow) {
+					const address_t next = m_ptr->first + 1;
+					m_ptr = in_tree(next) ? m_table->first_from(next) : nullptr;
+					if (m_ptr == nullptr) {
+						m_in_overflow = true;
+						m_ov = m_table->m_overflow.begin();
+						m_ptr = (m_ov != m_table->m_overflow.end()) ? &*m_ov : nullptr;
+					}
+				} else {
+					++m_ov;
+					m_ptr = (m_ov != m_table->m_overflow.end()) ? &*m_ov : nullptr;
+				}
+				return *this;
+			}
+
+			iterator() = default;
+			iterator(RadixPageTable* t, value_type* ptr) : m_table(t), m_ptr(ptr) {}
+			iterator(RadixPageTable* t, typename overflow_t::iterator ov)
+				: m_table(t), m_ptr(ov != t->m_overflow.end() ? &*ov : nullptr), m_ov(ov), m_in_overflow(true) {}
+		private:
+			RadixPageTable* m_table = nullptr;
+			value_type* m_ptr = nullptr;
+			typename overflow_t::iterator m_ov {};
+			bool m_in_overflow = false;
+		};
+		using const_iterator = iterator;
+
+		iterator begin() const {
+			auto* self = const_cast<RadixPageTable*>(this);
+			if (auto* first = self->first_from(0))
+				return iterator(self, first);
+			return iterator(self, self->m_overflow.begin());
+		}
+		iterator end() const { return iterator(); }
+
+		size_t size() const noexcept { return m_size + m_overflow.size(); }
+		bool empty() const noexcept { return size() == 0; }
+		void reserve(size_t) {}
+
+		iterator find(address_t key) const
+		{
+			auto* self = const_cast<RadixPageTable*>(this);
+			if (UNLIKELY(!in_tree(key)))
+				return iterator(self, self->m_overflow.find(key));
+			return iterator(self, self->lookup(key));
+		}
+		size_t count(address_t key) const { return find(key) != end(); }
+
+		template <typename... Args>
+		std::pair<iterator, bool> try_emplace(address_t key, Args&&... args)
+		{
+			if (UNLIKELY(!in_tree(key))) {
+				auto res = m_overflow.try_emplace(key, std::forward<Args>(args)...);
+				return {iterator(this, res.first), res.second};
+			}
+			auto& slot = this->create_slot<0>(m_root, key);
+			if (slot != nullptr)
+				return {iterator(this, slot.get()), false};
+			slot.reset(new value_type(std::piecewise_construct,
+				std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...)));
+			m_size++;
+			return {iterator(this, slot.get()), true};
+		}
+
+		size_t erase(address_t key)
+		{
+			if (UNLIKELY(!in_tree(key)))
+				return m_overflow.erase(key);
+			if (this->erase_from<0>(m_root, key)) {
+				m_size--;
+				return 1;
+			}
+			return 0;
+		}
+
+		void clear()
+		{
+			for (auto& child : m_root.child)
+				child.reset();
+			m_root.count = 0;
+			m_size = 0;
+			m_overflow.clear();
+		}
+
+	private:
+		static bool in_tree(address_t key) noexcept {
+			if constexpr (TREE_BITS >= sizeof(address_t) * 8)
+				return true;
+			else
+				return (key >> TREE_BITS) == 0;
+		}
+		static size_t index_at(address_t key, unsigned level) noexcept {
+			return size_t(key >> ((LEVELS - 1 - level) * LEVEL_BITS)) & (FANOUT - 1);
+		}
+
+		value_type* lookup(address_t key) const noexcept
+		{
+			const Node<0>* node = &m_root;
+			return this->lookup_from<0>(node, key);
+		}
+		template <unsigned Level>
+		static value_type* lookup_from(const Node<Level>* node, address_t key) noexcept
+		{
+			auto* child = node->child[index_at(key, Level)].get();
+			if constexpr (Level + 1 == LEVELS) {
+				return child;
+			} else {
+				if (child == nullptr)
+					return nullptr;
+				return lookup_from<Level + 1>(child, key);
+			}
+		}
+
+		template <unsigned Level>
+		std::unique_ptr<value_type>& create_slot(Node<Level>& node, address_t key)
+		{
+			auto& child = node.child[index_at(key, Level)];
+			if constexpr (Level + 1 == LEVELS) {
+				if (child == nullptr) node.count++;
+				return child;
+			} else {
+				if (child == nullptr) {
+					child.reset(new Node<Level + 1>);
+					node.count++;
+				}
+				return create_slot<Level + 1>(*child, key);
+			}
+		}
+
+		template <unsigned Level>
+		bool erase_from(Node<Level>& node, address_t key)
+		{
+			auto& child = node.child[index_at(key, Level)];
+			if (child == nullptr)
+				return false;
+			if constexpr (Level + 1 != LEVELS) {
+				if (!erase_from<Level + 1>(*child, key))
+					return false;
+				// Keep the memory use proportional to the pages in use
+				if (child->count != 0)
+					return true;
+			}
+			child.reset();
+			node.count--;
+			return true;
+		}
+
+		// The first page at or after key
+		value_type* first_from(address_t key) const noexcept
+		{
+			return this->first_from<0>(m_root, key, true);
+		}
+		template <unsigned Level>
+		static value_type* first_from(const Node<Level>& node, address_t key, bool exact) noexcept
+		{
+			if (node.count == 0)
+				return nullptr;
+			const size_t start = exact ? index_at(key, Level) : 0;
+			for (size_t i = start; i < FANOUT; i++) {
+				auto* child = node.child[i].get();
+				if (child == nullptr)
+					continue;
+				if constexpr (Level + 1 == LEVELS) {
+					return child;
+				} else {
+					if (auto* res = first_from<Level + 1>(*child, key, exact && i == start))
+						return res;
+				}
+			}
+			return nullptr;
+		}
+
+		Node<0>    m_root;
+		size_t     m_size = 0;
+		overflow_t m_overflow;
+	};
+
+	template <int W>
+	using PageTable = std::conditional_t<radix_page_table,
+		RadixPageTable<W>, std::unordered_map<address_type<W>, Page>>;
+
+} // riscv
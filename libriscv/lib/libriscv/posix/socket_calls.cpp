@@ -1,4 +1,5 @@
 #include <libriscv/machine.hpp>
+#include <libriscv/syscall_offload.hpp>
 
 //#define SOCKETCALL_VERBOSE 1
 #ifdef SOCKETCALL_VERBOSE
@@ -191,6 +192,27 @@ static void syscall_accept(Machine<W>& machine)
 	if (machine.has_file_descriptors() && machine.fds().permit_sockets) {
 
 		const auto real_fd = machine.fds().translate(vfd);
+#ifdef RISCV_SYSCALL_OFFLOAD
+		if (machine.syscall_offload() && !SyscallOffload::is_ready(real_fd, POLLIN)) {
+			struct AcceptState {
+				alignas(16) char buffer[128];
+				socklen_t addrlen = sizeof(buffer);
+			};
+			auto state = std::make_shared<AcceptState>();
+			machine.offload_syscall([offload = machine.syscall_offload(), state, real_fd] {
+				if (!offload->wait_ready(real_fd, POLLIN))
+					return long(-EINTR);
+				return SyscallOffload::result_or_error(accept(real_fd, (struct sockaddr *)state->buffer, &state->addrlen));
+			}, [state, g_addr = g_addr, g_addrlen = g_addrlen] (Machine<W>& machine, long res) {
+				if (res >= 0) {
+					machine.set_result(machine.fds().assign_socket(res));
+					machine.copy_to_guest(g_addr, state->buffer, state->addrlen);
+					machine.copy_to_guest(g_addrlen, &state->addrlen, sizeof(state->addrlen));
+				}
+			});
+			return;
+		}
+#endif
 		alignas(16) char buffer[128];
 		socklen_t addrlen = sizeof(buffer);
 
@@ -361,6 +383,41 @@ static void syscall_recvfrom(Machine<W>& machine)
 		const size_t buffer_cnt =
 			machine.memory.gather_writable_buffers_from_range(buffers.size(), buffers.data(), g_buf, buflen);
 
+#ifdef RISCV_SYSCALL_OFFLOAD
+		if (machine.syscall_offload() && !(flags & MSG_DONTWAIT) && !SyscallOffload::is_ready(real_fd, POLLIN)) {
+			struct RecvState {
+				std::vector<riscv::vBuffer> iov;
+				alignas(16) char dest_addr[128];
+				socklen_t addrlen = sizeof(dest_addr);
+			};
+			auto state = std::make_shared<RecvState>();
+			state->iov.assign(buffers.begin(), buffers.begin() + buffer_cnt);
+			machine.offload_syscall([offload = machine.syscall_offload(), state, real_fd, flags = flags] {
+				if (!offload->wait_ready(real_fd, POLLIN))
+					return long(-EINTR);
+				struct msghdr hdr {
+					.msg_name = state->dest_addr,
+					.msg_namelen = state->addrlen,
+					.msg_iov = (struct iovec *)state->iov.data(),
+					.msg_iovlen = state->iov.size(),
+					.msg_control = nullptr,
+					.msg_controllen = 0,
+					.msg_flags = 0,
+				};
+				const long res = SyscallOffload::result_or_error(recvmsg(real_fd, &hdr, flags));
+				state->addrlen = hdr.msg_namelen;
+				return res;
+			}, [state, g_src_addr = g_src_addr, g_addrlen = g_addrlen] (Machine<W>& machine, long res) {
+				if (res >= 0) {
+					if (g_src_addr != 0x0)
+						machine.copy_to_guest(g_src_addr, state->dest_addr, state->addrlen);
+					if (g_addrlen != 0x0)
+						machine.copy_to_guest(g_addrlen, &state->addrlen, sizeof(state->addrlen));
+				}
+			});
+			return;
+		}
+#endif
 		alignas(16) char dest_addr[128];
 		struct msghdr hdr {
 			.msg_name = dest_addr,
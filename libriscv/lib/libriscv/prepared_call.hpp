@@ -226,6 +226,16 @@ resolve_return_value:
 			return this->call_with(*m_machine, std::forward<Args>(args)...);
 		}
 
+		/// @brief Call the prepared function once for each tuple of
+		/// arguments, storing each result in order. See Machine::vmcall_batch().
+		template <typename Tuple>
+		void call_batch(std::span<const Tuple> args, std::span<address_t> results) const
+		{
+			static_assert(!std::is_floating_point_v<Ret>,
+				"PreparedCall: Batched calls only return integer results");
+			m_machine->template vmcall_batch<IMAX>(m_pc, args, results);
+		}
+
 		Machine<W>& machine() const noexcept { return *m_machine; }
 		Machine<W>& machine() noexcept { return *m_machine; }
 
@@ -259,7 +269,8 @@ resolve_return_value:
 			this->m_pc = pc;
 
 #if defined(RISCV_BINARY_TRANSLATION)
-			auto& exec = m.cpu.current_execute_segment();
+			// The current execute segment may be another one, eg. after a vmcall
+			auto& exec = *m.memory.exec_segment_for(pc);
 			// We need an execute segment matching current PC
 			if (pc >= exec.exec_begin() && pc < exec.exec_end())
 			{
@@ -278,7 +289,7 @@ resolve_return_value:
 				this->m_mapping = nullptr;
 			}
 #else
-			m.cpu.create_fast_path_function(pc);
+			m.cpu.create_fast_path_function(*m.memory.exec_segment_for(pc), pc);
 #endif
 		}
 
@@ -0,0 +1,262 @@
+#include "profiler.hpp"
+
+#include "decoder_cache.hpp"
+#include "internal_common.hpp"
+#include "threaded_bytecodes.hpp"
+#include <algorithm>
+#include <cinttypes>
+#include <map>
+#include <thread>
+#include <unordered_map>
+
+namespace riscv
+{
+	// Frame pointers further than this above SP are not trusted
+	static constexpr uint64_t MAX_FRAME_DISTANCE = 16ull << 20;
+
+	template <int W>
+	Profiler<W>::Profiler(const ProfilerOptions& options)
+		: m_options(options)
+	{
+		size_t capacity = 64;
+		while (capacity < options.capacity)
+			capacity <<= 1;
+		this->m_mask = capacity - 1;
+		this->m_entries.reset(new Entry[capacity]);
+	}
+
+	template <int W>
+	static bool read_word(const Memory<W>& memory, address_type<W> addr, address_type<W>& value)
+	{
+		try {
+			memory.memcpy_out(&value, addr, sizeof(value));
+			return true;
+		} catch (const MachineException&) {
+			return false;
+		}
+	}
+
+	template <int W>
+	static bool is_code_address(const Memory<W>& memory, address_type<W> addr)
+	{
+		return addr != 0 && !memory.exec_segment_for(addr)->empty();
+	}
+
+	template <int W>
+	void Profiler<W>::sample(const Machine<W>& machine)
+	{
+		const auto& cpu = machine.cpu;
+		const unsigned max_depth = std::clamp(m_options.max_depth, 1u, MAX_DEPTH);
+		std::array<address_t, MAX_DEPTH> frames;
+		unsigned depth = 0;
+		frames[depth++] = cpu.pc();
+
+		if (m_options.frame_pointers) {
+			// The frame record of the standard RISC-V frame pointer convention:
+			// fp points just above the saved RA at fp-W and the callers fp at fp-2W.
+			address_t sp = cpu.reg(REG_SP);
+			address_t fp = cpu.reg(REG_FP);
+			while (depth < max_depth)
+			{
+				if (fp <= sp || fp - sp > MAX_FRAME_DISTANCE || fp % W != 0)
+					break;
+				address_t ra, caller_fp;
+				if (!read_word(machine.memory, fp - W, ra) || !read_word(machine.memory, fp - 2 * W, caller_fp))
+					break;
+				if (!is_code_address(machine.memory, ra))
+					break;
+				frames[depth++] = ra;
+				sp = fp;
+				fp = caller_fp;
+			}
+		}
+		// Without a frame chain, RA is the best guess for the caller
+		const address_t ra = cpu.reg(REG_RA);
+		if (depth == 1 && depth < max_depth && ra != frames[0] && is_code_address(machine.memory, ra))
+			frames[depth++] = ra;
+
+		bool translated = false;
+#ifdef RISCV_BINARY_TRANSLATION
+		const auto& exec = cpu.current_execute_segment();
+		if (exec.is_binary_translated() && exec.is_within(frames[0])) {
+			const auto* decoder = &exec.decoder_cache()[frames[0] >> DecoderCache<W>::SHIFT];
+			translated = decoder->get_bytecode() == RV32I_BC_TRANSLATOR;
+		}
+#endif
+		this->record(frames.data(), depth, translated);
+	}
+
+	template <int W>
+	void Profiler<W>::record(const address_t* frames, unsigned depth, bool translated)
+	{
+		m_samples.fetch_add(1, std::memory_order_relaxed);
+		if (translated)
+			m_translated.fetch_add(1, std::memory_order_relaxed);
+
+		// FNV-1a over the frames, where zero marks an empty entry
+		uint64_t hash = 0xcbf29ce484222325ull ^ uint64_t(translated);
+		for (unsigned i = 0; i < depth; i++) {
+			hash ^= uint64_t(frames[i]);
+			hash *= 0x100000001b3ull;
+		}
+		if (hash == 0)
+			hash = 1;
+
+		for (size_t probe = 0; probe <= m_mask; probe++)
+		{
+			auto& entry = m_entries[(hash + probe) & m_mask];
+			uint64_t current = entry.hash.load(std::memory_order_acquire);
+			if (current == 0) {
+				if (entry.hash.compare_exchange_strong(current, hash, std::memory_order_acq_rel)) {
+					// Claimed an empty entry: publish the stack
+					std::copy(frames, frames + depth, entry.frames.begin());
+					entry.depth = depth;
+					entry.translated = translated;
+					entry.count.store(1, std::memory_order_relaxed);
+					entry.ready.store(true, std::memory_order_release);
+					return;
+				}
+				// Another sampler claimed it, and current is now its hash
+			}
+			if (current != hash)
+				continue;
+			while (!entry.ready.load(std::memory_order_acquire))
+				std::this_thread::yield();
+			if (entry.depth == depth && entry.translated == translated
+				&& std::equal(frames, frames + depth, entry.frames.begin())) {
+				entry.count.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+		}
+		m_dropped.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	template <int W>
+	size_t Profiler<W>::unique_stacks() const noexcept
+	{
+		size_t count = 0;
+		for (size_t i = 0; i <= m_mask; i++)
+			count += m_entries[i].ready.load(std::memory_order_acquire);
+		return count;
+	}
+
+	template <int W>
+	void Profiler<W>::clear()
+	{
+		for (size_t i = 0; i <= m_mask; i++) {
+			auto& entry = m_entries[i];
+			entry.ready.store(false, std::memory_order_relaxed);
+			entry.count.store(0, std::memory_order_relaxed);
+			entry.hash.store(0, std::memory_order_release);
+		}
+		m_samples = 0;
+		m_translated = 0;
+		m_dropped = 0;
+	}
+
+	template <int W>
+	std::string Profiler<W>::folded_stacks(const Memory<W>& memory) const
+	{
+		// Symbol lookups are linear scans, so look up each address once
+		std::unordered_map<address_t, std::string> symbols;
+		auto symbolize = [&] (address_t addr) -> const std::string& {
+			auto it = symbols.find(addr);
+			if (it != symbols.end())
+				return it->second;
+			const auto site = memory.lookup(addr);
+			std::string name;
+			if (site.address == 0 && site.offset == 0 && site.size == 0) {
+				char buffer[32];
+				snprintf(buffer, sizeof(buffer), "0x%" PRIx64, uint64_t(addr));
+				name = buffer;
+			} else {
+				name = site.name;
+				// Semicolons separate the frames
+				std::replace(name.begin(), name.end(), ';', ':');
+			}
+			return symbols.emplace(addr, std::move(name)).first->second;
+		};
+
+		// Stacks with different addresses in the same functions are merged
+		std::map<std::string, uint64_t> stacks;
+		for (size_t i = 0; i <= m_mask; i++)
+		{
+			const auto& entry = m_entries[i];
+			if (!entry.ready.load(std::memory_order_acquire))
+				continue;
+			std::string stack;
+			for (unsigned f = entry.depth; f > 0; f--) {
+				if (!stack.empty())
+					stack += ';';
+				stack += symbolize(entry.frames[f-1]);
+			}
+			if (entry.translated)
+				stack += "_[j]";
+			stacks[stack] += entry.count.load(std::memory_order_relaxed);
+		}
+
+		std::string result;
+		for (const auto& it : stacks) {
+			result += it.first;
+			result += ' ';
+			result += std::to_string(it.second);
+			result += '\n';
+		}
+		return result;
+	}
+
+	template <int W>
+	bool Profiler<W>::write_folded(const Memory<W>& memory, FILE* file) const
+	{
+		const std::string folded = this->folded_stacks(memory);
+		return fwrite(folded.data(), 1, folded.size(), file) == folded.size();
+	}
+
+	template <int W>
+	bool Profiler<W>::simulate(Machine<W>& machine, address_t pc, uint64_t counter, uint64_t max)
+	{
+		auto& cpu = machine.cpu;
+		const uint64_t interval = std::max(uint64_t(1), m_options.interval);
+		while (true)
+		{
+			// The dispatch loops already check the instruction counter, so
+			// stopping at the end of a slice works for every dispatch mode.
+			const uint64_t slice = (counter < max && max - counter > interval)
+				? counter + interval : max;
+#ifdef RISCV_BINARY_TRANSLATION
+			const bool stopped = LIKELY(cpu.current_execute_segment().translation_profile() == nullptr)
+				? cpu.simulate(pc, counter, slice)
+				: cpu.simulate_tiered(pc, counter, slice);
+#else
+			const bool stopped = cpu.simulate(pc, counter, slice);
+#endif
+			if (stopped)
+				return true;
+			if (slice == max)
+				return false;
+
+			this->sample(machine);
+			pc = cpu.pc();
+			counter = machine.instruction_counter();
+		}
+	}
+
+	template <int W>
+	bool Machine<W>::simulate_profiled(uint64_t max_instr, uint64_t counter, address_t pc)
+	{
+		return m_profiler->simulate(*this, pc, counter, max_instr);
+	}
+
+	INSTANTIATE_32_IF_ENABLED(Profiler);
+	INSTANTIATE_64_IF_ENABLED(Profiler);
+	INSTANTIATE_128_IF_ENABLED(Profiler);
+#ifdef RISCV_32I
+	template bool Machine<4>::simulate_profiled(uint64_t, uint64_t, address_type<4>);
+#endif
+#ifdef RISCV_64I
+	template bool Machine<8>::simulate_profiled(uint64_t, uint64_t, address_type<8>);
+#endif
+#ifdef RISCV_128I
+	template bool Machine<16>::simulate_profiled(uint64_t, uint64_t, address_type<16>);
+#endif
+} // riscv
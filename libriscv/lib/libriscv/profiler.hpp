@@ -0,0 +1,82 @@
+#pragma once
+#include "machine.hpp"
+#include <atomic>
+#include <cstdio>
+
+namespace riscv
+{
+	struct ProfilerOptions
+	{
+		// Instructions executed between each sample
+		uint64_t interval = 10'000;
+		// Maximum number of frames recorded per sample, including the PC
+		unsigned max_depth = 16;
+		// Number of unique stacks that can be recorded, rounded up to a power of two.
+		// Samples with new stacks are dropped once the table is full.
+		size_t capacity = 4096;
+		// Walk the s0 frame-pointer chain. Only reliable for programs built
+		// with -fno-omit-frame-pointer. Otherwise, only the PC and RA are used.
+		bool frame_pointers = true;
+	};
+
+	/// @brief A sampling profiler for guest programs. Every interval instructions
+	/// the guest call stack is recorded into a lock-free table, which can be shared
+	/// by many machines (eg. forks running on different threads). The result is
+	/// written as folded stacks, which is the input format of flamegraph tools.
+	/// Samples that stopped in binary translated code are counted separately,
+	/// and the leaf frame is annotated with _[j].
+	/// @example
+	///   auto profiler = std::make_shared<Profiler<RISCV64>>();
+	///   machine.set_profiler(profiler);
+	///   machine.simulate();
+	///   profiler->write_folded(machine.memory, stdout);
+	template <int W>
+	struct Profiler
+	{
+		using address_t = address_type<W>;
+		static constexpr unsigned MAX_DEPTH = 64;
+
+		Profiler(const ProfilerOptions& options = {});
+
+		/// @brief Record the current call stack of a machine
+		void sample(const Machine<W>&);
+
+		/// @brief Symbolize the recorded stacks using the symbols of the program
+		/// @return Folded stacks, one per line: "root;...;leaf count"
+		std::string folded_stacks(const Memory<W>&) const;
+		/// @brief Write the folded stacks to a file
+		/// @return True if everything was written
+		bool write_folded(const Memory<W>&, FILE*) const;
+
+		uint64_t samples() const noexcept { return m_samples.load(std::memory_order_relaxed); }
+		uint64_t translated_samples() const noexcept { return m_translated.load(std::memory_order_relaxed); }
+		uint64_t dropped_samples() const noexcept { return m_dropped.load(std::memory_order_relaxed); }
+		size_t unique_stacks() const noexcept;
+		const ProfilerOptions& options() const noexcept { return m_options; }
+
+		// Forget all samples. Not safe while machines are sampling.
+		void clear();
+
+		// Run the machine in slices of interval instructions, sampling between each
+		bool simulate(Machine<W>&, address_t pc, uint64_t counter, uint64_t max);
+
+	private:
+		struct Entry {
+			std::atomic<uint64_t> hash { 0 };
+			std::atomic<uint64_t> count { 0 };
+			std::atomic<bool> ready { false };
+			bool     translated = false;
+			unsigned depth = 0;
+			std::array<address_t, MAX_DEPTH> frames {};
+		};
+		void record(const address_t* frames, unsigned depth, bool translated);
+
+		const ProfilerOptions m_options;
+		size_t m_mask = 0;
+		std::unique_ptr<Entry[]> m_entries;
+		std::atomic<uint64_t> m_samples { 0 };
+		std::atomic<uint64_t> m_translated { 0 };
+		std::atomic<uint64_t> m_dropped { 0 };
+	};
+
+} // riscv
@@ -1,6 +1,20 @@
 #include "rvv.hpp"
+#include "rvv_simd.hpp"
 #include "instr_helpers.hpp"
 
+// Handlers with whole-register SIMD are also compiled for AVX2,
+// and the decoder picks those when the host CPU supports it
+#ifdef RVV_HOST_AVX2
+#define VECTOR_SIMD_INSTR(x, impl, ...) \
+	VECTOR_INSTR(x, [] (auto& cpu, rv32i_instruction instr) RVINSTR_ATTR { impl(cpu, instr); }, __VA_ARGS__); \
+	VECTOR_INSTR(x##_AVX2, [] (auto& cpu, rv32i_instruction instr) RVINSTR_ATTR RVV_AVX2_ATTR { impl(cpu, instr); }, __VA_ARGS__)
+#define DECODED_VECTOR_SIMD(x) (rvv::host_avx2() ? DECODED_VECTOR(x##_AVX2) : DECODED_VECTOR(x))
+#else
+#define VECTOR_SIMD_INSTR(x, impl, ...) \
+	VECTOR_INSTR(x, [] (auto& cpu, rv32i_instruction instr) RVINSTR_ATTR { impl(cpu, instr); }, __VA_ARGS__)
+#define DECODED_VECTOR_SIMD(x) DECODED_VECTOR(x)
+#endif
+
 namespace riscv
 {
 	static const char *VOPNAMES[3][64] = {
@@ -100,36 +114,26 @@ namespace riscv
 						RISCV::regname(vi.VLS.rs2));
 	});
 
-	VECTOR_INSTR(VOPI_VV,
-	[] (auto& cpu, rv32i_instruction instr) RVINSTR_ATTR
+	template <typename CPU>
+	RISCV_ALWAYS_INLINE static inline void rvv_vopi_vv(CPU& cpu, rv32i_instruction instr)
 	{
 		const rv32v_instruction vi { instr };
 		auto& rvv = cpu.registers().rvv();
 		switch (vi.OPVV.funct6) {
 		case 0b000000: // VADD
-			for (size_t i = 0; i < rvv.u32(0).size(); i++) {
-				rvv.u32(vi.OPVV.vd)[i] = rvv.u32(vi.OPVV.vs1)[i] + rvv.u32(vi.OPVV.vs2)[i];
-			}
+			rvv::u32_vv<rvv::IntOp::ADD>(rvv.get(vi.OPVV.vd), rvv.get(vi.OPVV.vs1), rvv.get(vi.OPVV.vs2));
 			break;
 		case 0b000010: // VSUB
-			for (size_t i = 0; i < rvv.u32(0).size(); i++) {
-				rvv.u32(vi.OPVV.vd)[i] = rvv.u32(vi.OPVV.vs1)[i] - rvv.u32(vi.OPVV.vs2)[i];
-			}
+			rvv::u32_vv<rvv::IntOp::SUB>(rvv.get(vi.OPVV.vd), rvv.get(vi.OPVV.vs1), rvv.get(vi.OPVV.vs2));
 			break;
 		case 0b001001: // VAND
-			for (size_t i = 0; i < rvv.u32(0).size(); i++) {
-				rvv.u32(vi.OPVV.vd)[i] = rvv.u32(vi.OPVV.vs1)[i] & rvv.u32(vi.OPVV.vs2)[i];
-			}
+			rvv::u32_vv<rvv::IntOp::AND>(rvv.get(vi.OPVV.vd), rvv.get(vi.OPVV.vs1), rvv.get(vi.OPVV.vs2));
 			break;
 		case 0b001010: // VOR
-			for (size_t i = 0; i < rvv.u32(0).size(); i++) {
-				rvv.u32(vi.OPVV.vd)[i] = rvv.u32(vi.OPVV.vs1)[i] | rvv.u32(vi.OPVV.vs2)[i];
-			}
+			rvv::u32_vv<rvv::IntOp::OR>(rvv.get(vi.OPVV.vd), rvv.get(vi.OPVV.vs1), rvv.get(vi.OPVV.vs2));
 			break;
 		case 0b001011: // VXOR
-			for (size_t i = 0; i < rvv.u32(0).size(); i++) {
-				rvv.u32(vi.OPVV.vd)[i] = rvv.u32(vi.OPVV.vs1)[i] ^ rvv.u32(vi.OPVV.vs2)[i];
-			}
+			rvv::u32_vv<rvv::IntOp::XOR>(rvv.get(vi.OPVV.vd), rvv.get(vi.OPVV.vs1), rvv.get(vi.OPVV.vs2));
 			break;
 		case 0b001100: // VRGATHER
 			for (size_t i = 0; i < rvv.u32(0).size(); i++) {
@@ -140,7 +144,8 @@ namespace riscv
 		default:
 			cpu.trigger_exception(UNIMPLEMENTED_INSTRUCTION);
 		}
-	},
+	}
+	VECTOR_SIMD_INSTR(VOPI_VV, rvv_vopi_vv,
 	[] (char* buffer, size_t len, auto&, rv32i_instruction instr) RVPRINTR_ATTR {
 		const rv32v_instruction vi { instr };
 		return snprintf(buffer, len, "%s %s, %s, %s",
@@ -150,18 +155,18 @@ namespace riscv
 						RISCV::regname(vi.VLS.rs2));
 	});
 
-	VECTOR_INSTR(VOPF_VV,
-	[] (auto& cpu, rv32i_instruction instr) RVINSTR_ATTR
+	template <typename CPU>
+	RISCV_ALWAYS_INLINE static inline void rvv_vopf_vv(CPU& cpu, rv32i_instruction instr)
 	{
 		const rv32v_instruction vi { instr };
 		auto& rvv = cpu.registers().rvv();
 		switch (vi.OPVV.funct6) {
 		case 0b000000: // VFADD.VV
-			for (size_t i = 0; i < rvv.f32(0).size(); i++) {
-				rvv.f32(vi.OPVV.vd)[i] = rvv.f32(vi.OPVV.vs1)[i] + rvv.f32(vi.OPVV.vs2)[i];
-			}
+			rvv::f32_vv<rvv::FloatOp::ADD>(rvv.get(vi.OPVV.vd), rvv.get(vi.OPVV.vs1), rvv.get(vi.OPVV.vs2));
+			return;
+		case 0b000001: // VFREDUSUM: Unordered, so it can be summed pairwise
+			rvv.f32(vi.OPVV.vd)[0] = rvv::f32_sum(rvv.get(vi.OPVV.vs1), rvv.get(vi.OPVV.vs2));
 			return;
-		case 0b000001:   // VFREDUSUM
 		case 0b000011: { // VFREDOSUM
 			float sum = 0.0f;
 			for (size_t i = 0; i < rvv.f32(0).size(); i++) {
@@ -175,28 +180,21 @@ namespace riscv
 				return;
 			} break;
 		case 0b000010: // VFSUB.VV
-			for (size_t i = 0; i < rvv.f32(0).size(); i++) {
-				rvv.f32(vi.OPVV.vd)[i] = rvv.f32(vi.OPVV.vs1)[i] - rvv.f32(vi.OPVV.vs2)[i];
-			}
+			rvv::f32_vv<rvv::FloatOp::SUB>(rvv.get(vi.OPVV.vd), rvv.get(vi.OPVV.vs1), rvv.get(vi.OPVV.vs2));
 			return;
 		case 0b100100: // VFMUL.VV
-			for (size_t i = 0; i < rvv.f32(0).size(); i++) {
-				rvv.f32(vi.OPVV.vd)[i] = rvv.f32(vi.OPVV.vs1)[i] * rvv.f32(vi.OPVV.vs2)[i];
-			}
+			rvv::f32_vv<rvv::FloatOp::MUL>(rvv.get(vi.OPVV.vd), rvv.get(vi.OPVV.vs1), rvv.get(vi.OPVV.vs2));
 			return;
 		case 0b101000: // VFMADD.VV: Multiply-add (overwrites multiplicand)
-			for (size_t i = 0; i < rvv.f32(0).size(); i++) {
-				rvv.f32(vi.OPVV.vd)[i] = (rvv.f32(vi.OPVV.vs1)[i] * rvv.f32(vi.OPVV.vd)[i]) + rvv.f32(vi.OPVV.vs2)[i];
-			}
+			rvv::f32_muladd(rvv.get(vi.OPVV.vd), rvv.get(vi.OPVV.vs1), rvv.get(vi.OPVV.vd), rvv.get(vi.OPVV.vs2));
 			return;
 		case 0b101100: // VFMACC.VV: Multiply-accumulate (overwrites addend)
-			for (size_t i = 0; i < rvv.f32(0).size(); i++) {
-				rvv.f32(vi.OPVV.vd)[i] = (rvv.f32(vi.OPVV.vs1)[i] * rvv.f32(vi.OPVV.vs2)[i]) + rvv.f32(vi.OPVV.vd)[i];
-			}
+			rvv::f32_muladd(rvv.get(vi.OPVV.vd), rvv.get(vi.OPVV.vs1), rvv.get(vi.OPVV.vs2), rvv.get(vi.OPVV.vd));
 			return;
 		}
 		cpu.trigger_exception(UNIMPLEMENTED_INSTRUCTION);
-	},
+	}
+	VECTOR_SIMD_INSTR(VOPF_VV, rvv_vopf_vv,
 	[] (char* buffer, size_t len, auto&, rv32i_instruction instr) RVPRINTR_ATTR {
 		const rv32v_instruction vi { instr };
 		return snprintf(buffer, len, "%s.VV %s, %s, %s",
@@ -206,12 +204,22 @@ namespace riscv
 						RISCV::vecname(vi.OPVV.vs2));
 	});
 
-	VECTOR_INSTR(VOPM_VV,
-	[] (auto& cpu, rv32i_instruction instr) RVINSTR_ATTR
+	template <typename CPU>
+	RISCV_ALWAYS_INLINE static inline void rvv_vopm_vv(CPU& cpu, rv32i_instruction instr)
 	{
 		const rv32v_instruction vi { instr };
+		auto& rvv = cpu.registers().rvv();
+		switch (vi.OPVV.funct6) {
+		case 0b000000: // VREDSUM
+			rvv.u32(vi.OPVV.vd)[0] = rvv.u32(vi.OPVV.vs1)[0] + rvv::u32_sum(rvv.get(vi.OPVV.vs2));
+			return;
+		case 0b100101: // VMUL
+			rvv::u32_vv<rvv::IntOp::MUL>(rvv.get(vi.OPVV.vd), rvv.get(vi.OPVV.vs1), rvv.get(vi.OPVV.vs2));
+			return;
+		}
 		cpu.trigger_exception(UNIMPLEMENTED_INSTRUCTION);
-	},
+	}
+	VECTOR_SIMD_INSTR(VOPM_VV, rvv_vopm_vv,
 	[] (char* buffer, size_t len, auto&, rv32i_instruction instr) RVPRINTR_ATTR {
 		const rv32v_instruction vi { instr };
 		return snprintf(buffer, len, "VOPM.VV %s, %s, %s",
@@ -229,9 +237,7 @@ namespace riscv
 		switch (vi.OPVV.funct6) {
 		case 0b010111: // VMERGE.VI
 			if (vi.OPVI.vs2 == 0) {
-				for (size_t i = 0; i < rvv.u32(0).size(); i++) {
-					rvv.u32(vi.OPVI.vd)[i] = scalar;
-				}
+				rvv.u32(vi.OPVI.vd).fill(scalar);
 				return;
 			}
 		}
@@ -246,8 +252,8 @@ namespace riscv
 						RISCV::regname(vi.VLS.rs2));
 	});
 
-	VECTOR_INSTR(VOPF_VF,
-	[] (auto& cpu, rv32i_instruction instr) RVINSTR_ATTR
+	template <typename CPU>
+	RISCV_ALWAYS_INLINE static inline void rvv_vopf_vf(CPU& cpu, rv32i_instruction instr)
 	{
 		const rv32v_instruction vi { instr };
 		auto& rvv = cpu.registers().rvv();
@@ -255,11 +261,13 @@ namespace riscv
 		const auto vector = vi.OPVV.vs2;
 		switch (vi.OPVV.funct6) {
 		case 0b000000: // VFADD.VF
-			for (size_t i = 0; i < rvv.f32(0).size(); i++) {
-				rvv.f32(vi.OPVV.vd)[i] = rvv.f32(vector)[i] + scalar;
-			}
+			rvv::f32_vf<rvv::FloatOp::ADD>(rvv.get(vi.OPVV.vd), rvv.get(vector), scalar);
 			return;
-		case 0b000001:   // VFREDUSUM.VF
+		case 0b000001: { // VFREDUSUM.VF
+			VectorLane splat;
+			splat.f32.fill(scalar);
+			rvv.f32(vi.OPVV.vd)[0] = rvv::f32_sum(rvv.get(vector), splat);
+			} return;
 		case 0b000011: { // VFREDOSUM.VF
 			float sum = 0.0f;
 			for (size_t i = 0; i < rvv.f32(0).size(); i++) {
@@ -268,25 +276,20 @@ namespace riscv
 			rvv.f32(vi.OPVV.vd)[0] = sum;
 			} return;
 		case 0b000010: // VFSUB.VF
-			for (size_t i = 0; i < rvv.f32(0).size(); i++) {
-				rvv.f32(vi.OPVV.vd)[i] = rvv.f32(vector)[i] - scalar;
-			}
+			rvv::f32_vf<rvv::FloatOp::SUB>(rvv.get(vi.OPVV.vd), rvv.get(vector), scalar);
 			return;
 		case 0b010000: // VRFUNARY0.VF
 			if (vector == 0) { // VFMV.S.F
-				for (size_t i = 0; i < rvv.f32(0).size(); i++) {
-					rvv.f32(vi.OPVV.vd)[i] = scalar;
-				}
+				rvv.f32(vi.OPVV.vd).fill(scalar);
 				return;
 			} break;
 		case 0b100100: // VFMUL.VF
-			for (size_t i = 0; i < rvv.f32(0).size(); i++) {
-				rvv.f32(vi.OPVV.vd)[i] = rvv.f32(vector)[i] * scalar;
-			}
+			rvv::f32_vf<rvv::FloatOp::MUL>(rvv.get(vi.OPVV.vd), rvv.get(vector), scalar);
 			return;
 		}
 		cpu.trigger_exception(UNIMPLEMENTED_INSTRUCTION);
-	},
+	}
+	VECTOR_SIMD_INSTR(VOPF_VF, rvv_vopf_vf,
 	[] (char* buffer, size_t len, auto&, rv32i_instruction instr) RVPRINTR_ATTR {
 		const rv32v_instruction vi { instr };
 		return snprintf(buffer, len, "VOPF.VF %s, %s, %s",
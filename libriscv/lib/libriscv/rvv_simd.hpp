@@ -0,0 +1,151 @@
+#pragma once
+#include "common.hpp"
+#include "rvv_registers.hpp"
+#include <cstring>
+
+// Whole-register operations on 32-bit lanes for the vector handlers.
+// They use the compilers vector extensions, which become SSE2 on x86-64,
+// NEON on AArch64 and plain loops elsewhere. A second set of handlers
+// is compiled for AVX2, and the decoder picks it when the host has it.
+// The results are the same for every host.
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__AVX2__)
+#define RVV_HOST_AVX2
+#define RVV_AVX2_ATTR __attribute__((target("avx2")))
+#endif
+
+namespace riscv::rvv
+{
+	enum class IntOp : uint8_t { ADD, SUB, AND, OR, XOR, MUL };
+	enum class FloatOp : uint8_t { ADD, SUB, MUL };
+
+#ifdef RVV_HOST_AVX2
+	inline bool host_avx2() noexcept
+	{
+		return __builtin_cpu_supports("avx2");
+	}
+#endif
+
+#ifdef __GNUC__
+	typedef uint32_t u32x8 __attribute__((vector_size(32)));
+	typedef float    f32x8 __attribute__((vector_size(32)));
+	typedef float    f32x4 __attribute__((vector_size(16)));
+
+	template <typename V>
+	RISCV_ALWAYS_INLINE inline void load(V& v, const VectorLane& lane) noexcept
+	{
+		std::memcpy(&v, lane.u8.data(), sizeof(v));
+	}
+	template <typename V>
+	RISCV_ALWAYS_INLINE inline void store(VectorLane& lane, const V& v) noexcept
+	{
+		std::memcpy(lane.u8.data(), &v, sizeof(v));
+	}
+
+	// vd = vs1 OP vs2
+	template <IntOp OP>
+	RISCV_ALWAYS_INLINE inline void u32_vv(VectorLane& vd, const VectorLane& vs1, const VectorLane& vs2) noexcept
+	{
+		u32x8 a, b;
+		load(a, vs1); load(b, vs2);
+		if constexpr (OP == IntOp::ADD) store(vd, a + b);
+		else if constexpr (OP == IntOp::SUB) store(vd, a - b);
+		else if constexpr (OP == IntOp::AND) store(vd, a & b);
+		else if constexpr (OP == IntOp::OR)  store(vd, a | b);
+		else if constexpr (OP == IntOp::XOR) store(vd, a ^ b);
+		else store(vd, a * b);
+	}
+	template <FloatOp OP>
+	RISCV_ALWAYS_INLINE inline void f32_vv(VectorLane& vd, const VectorLane& vs1, const VectorLane& vs2) noexcept
+	{
+		f32x8 a, b;
+		load(a, vs1); load(b, vs2);
+		if constexpr (OP == FloatOp::ADD) store(vd, a + b);
+		else if constexpr (OP == FloatOp::SUB) store(vd, a - b);
+		else store(vd, a * b);
+	}
+	// vd = vs2 OP scalar
+	template <FloatOp OP>
+	RISCV_ALWAYS_INLINE inline void f32_vf(VectorLane& vd, const VectorLane& vs2, float scalar) noexcept
+	{
+		f32x8 a;
+		load(a, vs2);
+		if constexpr (OP == FloatOp::ADD) store(vd, a + scalar);
+		else if constexpr (OP == FloatOp::SUB) store(vd, a - scalar);
+		else store(vd, a * scalar);
+	}
+	// vd = (a * b) + c
+	RISCV_ALWAYS_INLINE inline void f32_muladd(VectorLane& vd, const VectorLane& a, const VectorLane& b, const VectorLane& c) noexcept
+	{
+		f32x8 x, y, z;
+		load(x, a); load(y, b); load(z, c);
+		store(vd, x * y + z);
+	}
+
+	// The sum of all lanes of (a + b), added pairwise in a fixed order:
+	// (0+4, 1+5, 2+6, 3+7), then (0+2) + (1+3)
+	RISCV_ALWAYS_INLINE inline float f32_sum(const VectorLane& a, const VectorLane& b) noexcept
+	{
+		f32x8 x, y;
+		load(x, a); load(y, b);
+		const f32x8 v = x + y;
+		f32x4 lo, hi;
+		std::memcpy(&lo, &v, sizeof(lo));
+		std::memcpy(&hi, (const char *)&v + sizeof(lo), sizeof(hi));
+		const f32x4 w = lo + hi;
+		return (w[0] + w[2]) + (w[1] + w[3]);
+	}
+#else
+	template <IntOp OP>
+	inline void u32_vv(VectorLane& vd, const VectorLane& vs1, const VectorLane& vs2) noexcept
+	{
+		for (size_t i = 0; i < vd.u32.size(); i++) {
+			const uint32_t a = vs1.u32[i], b = vs2.u32[i];
+			if constexpr (OP == IntOp::ADD) vd.u32[i] = a + b;
+			else if constexpr (OP == IntOp::SUB) vd.u32[i] = a - b;
+			else if constexpr (OP == IntOp::AND) vd.u32[i] = a & b;
+			else if constexpr (OP == IntOp::OR)  vd.u32[i] = a | b;
+			else if constexpr (OP == IntOp::XOR) vd.u32[i] = a ^ b;
+			else vd.u32[i] = a * b;
+		}
+	}
+	template <FloatOp OP>
+	inline void f32_vv(VectorLane& vd, const VectorLane& vs1, const VectorLane& vs2) noexcept
+	{
+		for (size_t i = 0; i < vd.f32.size(); i++) {
+			const float a = vs1.f32[i], b = vs2.f32[i];
+			if constexpr (OP == FloatOp::ADD) vd.f32[i] = a + b;
+			else if constexpr (OP == FloatOp::SUB) vd.f32[i] = a - b;
+			else vd.f32[i] = a * b;
+		}
+	}
+	template <FloatOp OP>
+	inline void f32_vf(VectorLane& vd, const VectorLane& vs2, float scalar) noexcept
+	{
+		VectorLane s;
+		s.f32.fill(scalar);
+		f32_vv<OP>(vd, vs2, s);
+	}
+	inline void f32_muladd(VectorLane& vd, const VectorLane& a, const VectorLane& b, const VectorLane& c) noexcept
+	{
+		for (size_t i = 0; i < vd.f32.size(); i++)
+			vd.f32[i] = a.f32[i] * b.f32[i] + c.f32[i];
+	}
+	inline float f32_sum(const VectorLane& a, const VectorLane& b) noexcept
+	{
+		float w[4];
+		for (size_t i = 0; i < 4; i++)
+			w[i] = (a.f32[i] + b.f32[i]) + (a.f32[i+4] + b.f32[i+4]);
+		return (w[0] + w[2]) + (w[1] + w[3]);
+	}
+#endif
+
+	// The sum of all lanes, wrapping around
+	inline uint32_t u32_sum(const VectorLane& a) noexcept
+	{
+		uint32_t sum = 0;
+		for (const uint32_t value : a.u32)
+			sum += value;
+		return sum;
+	}
+
+} // riscv::rvv
@@ -1,6 +1,9 @@
 #include <libriscv/machine.hpp>
 
 #include "internal_common.hpp"
+#include <algorithm>
+#include <errno.h>
+#include <unistd.h>
 #ifdef __GNUG__
 #define RISCV_PACKED __attribute__((packed))
 #else
@@ -10,6 +13,8 @@
 namespace riscv
 {
 	static const uint64_t MAGiC_V4LUE = 0x9c36ab9301aed873;
+	// The pages are only those changed since the previous state
+	static constexpr uint16_t SERIALIZED_DELTA = 0x1;
 	template <int W>
 	struct SerializedMachine
 	{
@@ -22,7 +27,7 @@ namespace riscv
 		uint16_t page_size;
 		uint16_t attr_size;
 		uint16_t serp_size;
-		uint16_t reserved;
+		uint16_t flags;
 		uint16_t cpu_offset;
 		uint32_t mem_offset;
 
@@ -40,28 +45,74 @@ namespace riscv
 		uint64_t addr;
 		PageAttributes attr;
 		bool is_cow_page = false;
-		uint8_t padding[3] {0};
+		bool is_removed = false;
+		uint8_t padding[2] {0};
 	} RISCV_PACKED;
 
-	template <int W>
-	size_t Machine<W>::serialize_to(std::vector<uint8_t>& vec) const
+	struct VectorWriter
 	{
-		const size_t before = vec.size();
+		std::vector<uint8_t>& vec;
 
+		void operator() (const void* data, size_t len) {
+			const auto* ptr = (const uint8_t*) data;
+			vec.insert(vec.end(), ptr, ptr + len);
+		}
+	};
+	// Page records are small, so they are gathered before each write()
+	struct FileWriter
+	{
+		int fd;
+		size_t len = 0;
+		std::array<uint8_t, 16 * PageSize> buffer;
+
+		void operator() (const void* data, size_t size) {
+			if (len + size > buffer.size())
+				flush();
+			std::memcpy(&buffer[len], data, size);
+			len += size;
+		}
+		void flush() {
+			const uint8_t* ptr = buffer.data();
+			while (len > 0) {
+				const ssize_t res = ::write(fd, ptr, len);
+				if (res < 0 && errno == EINTR)
+					continue;
+				if (res <= 0)
+					throw MachineException(SYSTEM_CALL_FAILED, "Failed to write serialized state", errno);
+				ptr += res;
+				len -= res;
+			}
+		}
+	};
+
+	template <int W>
+	template <typename Writer>
+	size_t Machine<W>::serialize_with(Writer& writer, const std::vector<address_t>* changed) const
+	{
+		unsigned page_count = 0;
 		unsigned datapage_count = 0;
-		for (const auto& it : memory.pages()) {
-			if (!it.second.is_cow_page()) datapage_count++;
+		if (changed == nullptr) {
+			page_count = memory.pages().size();
+			for (const auto& it : memory.pages()) {
+				if (!it.second.is_cow_page()) datapage_count++;
+			}
+		} else {
+			page_count = changed->size();
+			for (const auto pageno : *changed) {
+				auto it = memory.pages().find(pageno);
+				if (it != memory.pages().end() && !it->second.is_cow_page()) datapage_count++;
+			}
 		}
 
 		const SerializedMachine<W> header {
 			.magic    = MAGiC_V4LUE,
-			.n_pages  = (unsigned) memory.pages().size(),
+			.n_pages  = page_count,
 			.n_datapages = datapage_count,
 			.reg_size = sizeof(Registers<W>),
 			.page_size = Page::size(),
 			.attr_size = sizeof(PageAttributes),
 			.serp_size = sizeof(SerializedPage),
-			.reserved = 0,
+			.flags    = uint16_t(changed != nullptr ? SERIALIZED_DELTA : 0x0),
 			.cpu_offset = sizeof(SerializedMachine<W>),
 			.mem_offset = sizeof(SerializedMachine<W>) + 0x0,
 
@@ -74,13 +125,43 @@ namespace riscv
 			.heap_address  = memory.heap_address(),
 			.exit_address  = memory.exit_address(),
 		};
-		const auto* hptr = (const uint8_t*) &header;
-		vec.insert(vec.end(), hptr, hptr + sizeof(header));
-		this->cpu.serialize_to(vec);
-		this->memory.serialize_to(vec);
+		writer(&header, sizeof(header));
+		this->memory.serialize_pages(writer, changed);
 
-		const size_t after = vec.size();
-		return after - before;
+		return sizeof(header) + page_count * sizeof(SerializedPage)
+			+ datapage_count * sizeof(PageData);
+	}
+
+	template <int W>
+	size_t Machine<W>::serialize_to(std::vector<uint8_t>& vec) const
+	{
+		VectorWriter writer { vec };
+		const size_t before = vec.size();
+		this->serialize_with(writer, nullptr);
+		return vec.size() - before;
+	}
+	template <int W>
+	size_t Machine<W>::serialize_delta_to(std::vector<uint8_t>& vec)
+	{
+		std::vector<address_t> changed;
+		const bool delta = this->memory.next_serialize_delta(changed);
+
+		VectorWriter writer { vec };
+		const size_t before = vec.size();
+		this->serialize_with(writer, delta ? &changed : nullptr);
+		return vec.size() - before;
+	}
+	template <int W>
+	size_t Machine<W>::serialize_to_fd(int fd, bool delta)
+	{
+		std::vector<address_t> changed;
+		if (delta)
+			delta = this->memory.next_serialize_delta(changed);
+
+		std::unique_ptr<FileWriter> writer { new FileWriter { .fd = fd, .len = 0, .buffer = {} } };
+		const size_t bytes = this->serialize_with(*writer, delta ? &changed : nullptr);
+		writer->flush();
+		return bytes;
 	}
 	template <int W>
 	void CPU<W>::serialize_to(std::vector<uint8_t>& /* vec */) const
@@ -90,43 +171,90 @@ namespace riscv
 	size_t Memory<W>::serialize_to(std::vector<uint8_t>& vec) const
 	{
 		const size_t before = vec.size();
+		const size_t est_page_bytes =
+			this->m_pages.size() * (sizeof(SerializedPage) + sizeof(PageData));
+		vec.reserve(vec.size() + est_page_bytes);
+
+		VectorWriter writer { vec };
+		this->serialize_pages(writer, nullptr);
+
+		const size_t after = vec.size();
+		return after - before;
+	}
+
+	template <int W>
+	bool Memory<W>::next_serialize_delta(std::vector<address_t>& changed)
+	{
 		if (this->m_arena.pages > 0 && riscv::flat_readwrite_arena) {
 			throw MachineException(
 				FEATURE_DISABLED, "Serialize is incompatible with flat read-write arena");
 		}
+		if (m_dirty.tracking && !m_dirty.delta) {
+			throw MachineException(
+				FEATURE_DISABLED, "Delta serialization is incompatible with fork dirty tracking");
+		}
+		// Writes to cached pages must be seen by the page tables again
+		this->invalidate_reset_cache();
+		if (!m_dirty.delta) {
+			// The baseline: begin recording changed pages from now on
+			m_dirty.tracking = true;
+			m_dirty.delta = true;
+			return false;
+		}
+		changed = std::move(m_dirty.pages);
+		m_dirty.pages.clear();
+		m_dirty.seen.clear();
+		std::sort(changed.begin(), changed.end());
+		return true;
+	}
 
-		const size_t est_page_bytes =
-			this->m_pages.size() * (sizeof(SerializedPage) + sizeof(PageData));
-		vec.reserve(vec.size() + est_page_bytes);
+	template <int W>
+	template <typename Writer>
+	void Memory<W>::serialize_pages(Writer& writer, const std::vector<address_t>* changed) const
+	{
+		if (this->m_arena.pages > 0 && riscv::flat_readwrite_arena) {
+			throw MachineException(
+				FEATURE_DISABLED, "Serialize is incompatible with flat read-write arena");
+		}
 
-		for (const auto& it : this->m_pages)
+		auto serialize_page = [&writer] (address_t pageno, const Page* page)
 		{
-			const auto& page = it.second;
-
 			// XXX: 128-bit addresses not taken into account
 			SerializedPage spage {
-				.addr = static_cast<uint64_t>(it.first),
-				.attr = page.attr,
-				.is_cow_page = page.is_cow_page(),
+				.addr = static_cast<uint64_t>(pageno),
+				.attr = {},
 			};
+			if (page != nullptr) {
+				spage.attr = page->attr;
+				spage.is_cow_page = page->is_cow_page();
+			} else {
+				// The page was freed since the previous state
+				spage.is_removed = true;
+			}
 			// Make all pages owned from now on
 			spage.attr.is_cow = false;
 			spage.attr.non_owning = false;
 
 			// Serialize page attributes
-			auto* sptr = (const uint8_t*) &spage;
-			vec.insert(vec.end(), sptr, sptr + sizeof(SerializedPage));
+			writer(&spage, sizeof(SerializedPage));
 
 			// The zero-page (and other guard pages) may not have data
-			if (page.is_cow_page())
-				continue;
+			if (page == nullptr || page->is_cow_page())
+				return;
 
 			// Serialize page data
-			vec.insert(vec.end(), page.data(), page.data() + sizeof(PageData));
-		}
+			writer(page->data(), sizeof(PageData));
+		};
 
-		const size_t after = vec.size();
-		return after - before;
+		if (changed == nullptr) {
+			for (const auto& it : this->m_pages)
+				serialize_page(it.first, &it.second);
+		} else {
+			for (const auto pageno : *changed) {
+				auto it = this->m_pages.find(pageno);
+				serialize_page(pageno, it != this->m_pages.end() ? &it->second : nullptr);
+			}
+		}
 	}
 
 	template <int W>
@@ -146,6 +274,8 @@ namespace riscv
 			return -4;
 		if (header.serp_size != sizeof(SerializedPage))
 			return -5;
+		if (header.flags & ~SERIALIZED_DELTA)
+			return -6;
 		this->m_counter = header.counter;
 		this->m_max_counter = 0;
 		cpu.deserialize_from(vec, header);
@@ -182,8 +312,11 @@ namespace riscv
 		}
 
 		// completely reset the paging system as
-		// all pages will be completely replaced
-		this->clear_all_pages();
+		// all pages will be completely replaced,
+		// unless only the changed pages are stored
+		const bool delta = (state.flags & SERIALIZED_DELTA) != 0;
+		if (!delta)
+			this->clear_all_pages();
 		this->evict_execute_segments();
 
 		size_t off = state.mem_offset;
@@ -191,6 +324,12 @@ namespace riscv
 		{
 			const SerializedPage page = *(SerializedPage*) &vec[off];
 			off += sizeof(SerializedPage);
+			if (delta) {
+				// Changed pages replace the current ones
+				m_pages.erase(page.addr);
+				if (page.is_removed)
+					continue;
+			}
 
 			PageAttributes new_attr = page.attr;
 			// Pages with data
@@ -229,6 +368,9 @@ namespace riscv
 		}
 		// page tables have been changed
 		this->invalidate_reset_cache();
+		// The next delta is relative to the restored state
+		m_dirty.pages.clear();
+		m_dirty.seen.clear();
 	}
 
 	INSTANTIATE_32_IF_ENABLED(Machine);
@@ -0,0 +1,105 @@
+#include "superinstructions.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cinttypes>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace riscv
+{
+#ifdef RISCV_RECORD_BYTECODES
+	// Each thread records into its own tables, which outlive the thread
+	struct BytecodeRecording
+	{
+		std::array<uint64_t, 256 * 256> pairs {};
+		std::unordered_map<uint32_t, uint64_t> triples;
+		const void* last_to = nullptr;
+		unsigned last_from_bc = 0;
+	};
+	static std::mutex recordings_mutex;
+	static std::vector<std::unique_ptr<BytecodeRecording>> recordings;
+
+	static BytecodeRecording& thread_recording()
+	{
+		thread_local BytecodeRecording* recording = nullptr;
+		if (UNLIKELY(recording == nullptr)) {
+			std::lock_guard<std::mutex> lock(recordings_mutex);
+			recordings.push_back(std::make_unique<BytecodeRecording>());
+			recording = recordings.back().get();
+		}
+		return *recording;
+	}
+
+	void record_bytecode_sequence(const void* from, unsigned from_bc, const void* to, unsigned to_bc)
+	{
+		auto& rec = thread_recording();
+		rec.pairs[(from_bc << 8) | to_bc]++;
+		// A triple is two transitions where the first one ended where the second began
+		if (rec.last_to == from)
+			rec.triples[(rec.last_from_bc << 16) | (from_bc << 8) | to_bc]++;
+		rec.last_to = to;
+		rec.last_from_bc = from_bc;
+	}
+
+	bool write_bytecode_profile(FILE* file)
+	{
+		std::vector<std::pair<uint64_t, uint32_t>> sequences;
+		{
+			std::array<uint64_t, 256 * 256> pairs {};
+			std::unordered_map<uint32_t, uint64_t> triples;
+			std::lock_guard<std::mutex> lock(recordings_mutex);
+			for (const auto& rec : recordings) {
+				for (size_t i = 0; i < pairs.size(); i++)
+					pairs[i] += rec->pairs[i];
+				for (const auto& it : rec->triples)
+					triples[it.first] += it.second;
+			}
+			for (size_t i = 0; i < pairs.size(); i++) {
+				if (pairs[i] != 0)
+					sequences.emplace_back(pairs[i], uint32_t(i));
+			}
+			// Triples are told apart from pairs by the top bit
+			for (const auto& it : triples)
+				sequences.emplace_back(it.second, it.first | 0x80000000);
+		}
+		std::sort(sequences.begin(), sequences.end(), [] (const auto& a, const auto& b) {
+			return a.first != b.first ? a.first > b.first : a.second < b.second;
+		});
+
+		// The bytecode numbering depends on these build options
+		fprintf(file, "# libriscv bytecode sequences: count bytecode...\n");
+		fprintf(file, "# config:"
+#ifdef RISCV_64I
+			" RISCV_64I"
+#endif
+#ifdef RISCV_EXT_COMPRESSED
+			" RISCV_EXT_COMPRESSED"
+#endif
+#ifdef RISCV_EXT_VECTOR
+			" RISCV_EXT_VECTOR"
+#endif
+#ifdef RISCV_BINARY_TRANSLATION
+			" RISCV_BINARY_TRANSLATION"
+#endif
+			"\n");
+		for (const auto& it : sequences) {
+			const uint32_t seq = it.second;
+			if (seq & 0x80000000)
+				fprintf(file, "%" PRIu64 " %u %u %u\n", it.first,
+					(seq >> 16) & 0xFF, (seq >> 8) & 0xFF, seq & 0xFF);
+			else
+				fprintf(file, "%" PRIu64 " %u %u\n", it.first,
+					(seq >> 8) & 0xFF, seq & 0xFF);
+		}
+		return ferror(file) == 0;
+	}
+#else
+	bool write_bytecode_profile(FILE*)
+	{
+		return false;
+	}
+#endif
+
+} // riscv
@@ -0,0 +1,40 @@
+#pragma once
+#include "common.hpp"
+#include "threaded_bytecodes.hpp"
+#include <iterator>
+
+namespace riscv
+{
+	// A superinstruction is a bytecode that executes a frequent sequence
+	// of bytecodes with a single dispatch. The table is generated from a
+	// profile of real programs by scripts/superinstructions.py, and the
+	// decoder replaces the first bytecode of each matching sequence.
+	struct Superinstruction
+	{
+		uint8_t bytecode;
+		uint8_t length;
+		uint8_t ops[3];
+		// Bit N is set when element N steps one decoder entry (NEXT_C_INSTR)
+		uint8_t compressed;
+	};
+
+	static constexpr Superinstruction superinstructions[] = {
+#define SUPERINSTRUCTION(bc, lbl, len, op1, op2, op3, cmask) \
+		{ bc, len, { op1, op2, op3 }, cmask },
+#include "threaded_superinstructions.hpp"
+#undef SUPERINSTRUCTION
+		{ RV32I_BC_INVALID, 0, { 0, 0, 0 }, 0 } // Terminator
+	};
+	static constexpr size_t superinstruction_count = std::size(superinstructions) - 1;
+
+#ifdef RISCV_RECORD_BYTECODES
+	// Count a sequential transition between two bytecodes in the same block
+	void record_bytecode_sequence(const void* from, unsigned from_bc, const void* to, unsigned to_bc);
+	#define RECORD_BYTECODE_SEQUENCE(decoder, stride) \
+		record_bytecode_sequence((decoder), (decoder)->get_bytecode(), \
+			(decoder) + (stride), ((decoder) + (stride))->get_bytecode());
+#else
+	#define RECORD_BYTECODE_SEQUENCE(decoder, stride) /* */
+#endif
+
+} // riscv
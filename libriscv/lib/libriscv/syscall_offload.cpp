@@ -0,0 +1,150 @@
+#include "syscall_offload.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <errno.h>
+
+namespace riscv
+{
+#ifdef RISCV_SYSCALL_OFFLOAD
+	// Offloaded system calls wait at most this long between checking
+	// if they have been cancelled
+	static constexpr int WAIT_SLICE_MS = 50;
+
+	// The cancellation flag of the system call running on this thread
+	static thread_local const std::atomic<bool>* current_cancelled = nullptr;
+
+	SyscallOffload::SyscallOffload(unsigned workers)
+		: m_pool(workers)
+	{
+	}
+	SyscallOffload::~SyscallOffload()
+	{
+		// Waiting system calls give up, and the pool threads are joined
+		m_stopping.store(true);
+	}
+
+	void SyscallOffload::submit(const void* owner, work_t work, completion_t completion)
+	{
+		auto job = std::make_shared<Job>();
+		job->owner = owner;
+		job->work = std::move(work);
+		job->completion = std::move(completion);
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			m_jobs.push_back(job);
+		}
+		m_in_flight.fetch_add(1, std::memory_order_relaxed);
+
+		m_pool.enqueue([this, job] {
+			if (!job->cancelled.load()) {
+				current_cancelled = &job->cancelled;
+				job->result = job->work();
+				current_cancelled = nullptr;
+			}
+			std::lock_guard<std::mutex> lock(m_lock);
+			job->finished = true;
+			m_finished++;
+			m_done_cv.notify_all();
+		});
+	}
+
+	size_t SyscallOffload::complete(std::chrono::milliseconds timeout)
+	{
+		std::vector<std::shared_ptr<Job>> done;
+		{
+			std::unique_lock<std::mutex> lock(m_lock);
+			if (m_finished == 0 && timeout.count() > 0)
+				m_done_cv.wait_for(lock, timeout, [this] { return m_finished > 0; });
+			if (m_finished == 0)
+				return 0;
+
+			auto it = std::stable_partition(m_jobs.begin(), m_jobs.end(),
+				[] (const auto& job) { return !job->finished; });
+			done.assign(std::make_move_iterator(it), std::make_move_iterator(m_jobs.end()));
+			m_jobs.erase(it, m_jobs.end());
+			m_finished = 0;
+		}
+		m_in_flight.fetch_sub(done.size(), std::memory_order_relaxed);
+		// Every finished system call is completed, even when one of
+		// the completions fails, and the first failure is rethrown
+		std::exception_ptr failure = nullptr;
+		for (auto& job : done) {
+			try {
+				job->completion(job->result);
+			} catch (...) {
+				if (failure == nullptr)
+					failure = std::current_exception();
+			}
+		}
+		if (failure != nullptr)
+			std::rethrow_exception(failure);
+		return done.size();
+	}
+
+	void SyscallOffload::cancel(const void* owner)
+	{
+		std::unique_lock<std::mutex> lock(m_lock);
+		const auto is_owned = [owner] (const auto& job) { return job->owner == owner; };
+		for (auto& job : m_jobs) {
+			if (is_owned(job))
+				job->cancelled.store(true);
+		}
+		// Work that is already running gives up within a wait slice
+		m_done_cv.wait(lock, [&] {
+			return std::none_of(m_jobs.begin(), m_jobs.end(),
+				[&] (const auto& job) { return is_owned(job) && !job->finished; });
+		});
+		const size_t before = m_jobs.size();
+		for (auto& job : m_jobs) {
+			if (is_owned(job))
+				m_finished--;
+		}
+		m_jobs.erase(std::remove_if(m_jobs.begin(), m_jobs.end(), is_owned), m_jobs.end());
+		m_in_flight.fetch_sub(before - m_jobs.size(), std::memory_order_relaxed);
+	}
+
+	int SyscallOffload::poll(struct pollfd* fds, size_t nfds, int timeout_ms) const
+	{
+		int remaining = timeout_ms;
+		while (!m_stopping.load(std::memory_order_relaxed)
+			&& !(current_cancelled != nullptr && current_cancelled->load(std::memory_order_relaxed)))
+		{
+			const int slice = (remaining < 0 || remaining > WAIT_SLICE_MS) ? WAIT_SLICE_MS : remaining;
+			const int res = ::poll(fds, nfds, slice);
+			if (res != 0)
+				return res;
+			if (remaining >= 0) {
+				remaining -= slice;
+				if (remaining <= 0)
+					return 0;
+			}
+		}
+		errno = EINTR;
+		return -1;
+	}
+
+	bool SyscallOffload::wait_ready(int fd, short events, int timeout_ms) const
+	{
+		struct pollfd pfd { .fd = fd, .events = events, .revents = 0 };
+		return this->poll(&pfd, 1, timeout_ms) > 0;
+	}
+
+	bool SyscallOffload::is_ready(int fd, short events)
+	{
+		struct pollfd pfd { .fd = fd, .events = events, .revents = 0 };
+		return ::poll(&pfd, 1, 0) != 0;
+	}
+
+#else // RISCV_SYSCALL_OFFLOAD
+
+	SyscallOffload::SyscallOffload(unsigned) {
+		throw MachineException(FEATURE_DISABLED, "Offloaded system calls are not enabled (RISCV_SYSCALL_OFFLOAD)");
+	}
+	SyscallOffload::~SyscallOffload() {}
+	void SyscallOffload::submit(const void*, work_t, completion_t) {}
+	size_t SyscallOffload::complete(std::chrono::milliseconds) { return 0; }
+	void SyscallOffload::cancel(const void*) {}
+
+#endif // RISCV_SYSCALL_OFFLOAD
+} // riscv
@@ -0,0 +1,114 @@
+#pragma once
+#include "machine.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#ifdef RISCV_SYSCALL_OFFLOAD
+#include "util/threadpool.h"
+#include <poll.h>
+#endif
+
+namespace riscv
+{
+	/// @brief A pool of host threads that run blocking system calls on behalf
+	/// of guests. When a machine has a pool, the Linux system calls that would
+	/// block (read, accept, recvfrom, ppoll and epoll_pwait on a file that is
+	/// not ready) are submitted to it, and the machine is parked: it stops right
+	/// after the system call, and the host thread is free to run other machines.
+	/// complete() finishes system calls on the calling thread, writing their
+	/// results to the guests, after which the parked machines can be resumed.
+	/// A parked machine must not be resumed before that, but it can be
+	/// destroyed, which cancels its system call. When completing a system
+	/// call faults, the exception is thrown by the next simulate() of the
+	/// machine that made it.
+	/// @example
+	///   auto offload = std::make_shared<SyscallOffload>(4);
+	///   for (auto& machine : machines)
+	///       machine.set_syscall_offload(offload);
+	///   while (running) {
+	///       for (auto& machine : machines)
+	///           if (!machine.is_parked()) machine.simulate();
+	///       offload->complete(std::chrono::milliseconds(10));
+	///   }
+	struct SyscallOffload
+	{
+		// Runs on a pool thread, returning the result or -errno
+		using work_t = std::function<long()>;
+		// Runs on the thread calling complete(), with the result of the work
+		using completion_t = std::function<void(long)>;
+
+		SyscallOffload(unsigned workers = 4);
+		~SyscallOffload();
+
+		/// @brief Run work on a pool thread, and then its completion in complete()
+		/// @param owner Identifies the system calls that cancel() cancels
+		void submit(const void* owner, work_t work, completion_t completion);
+
+		/// @brief Run the completions of finished system calls, waiting up to
+		/// timeout for at least one of them to finish. If a completion throws,
+		/// the others are still run, and then the exception is rethrown.
+		/// @return The number of completed system calls
+		size_t complete(std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+		/// @brief Cancel the system calls of an owner, without completing them.
+		/// Waits until none of its work is running.
+		void cancel(const void* owner);
+
+		/// @brief The number of system calls that have not been completed yet
+		size_t in_flight() const noexcept { return m_in_flight.load(std::memory_order_relaxed); }
+
+#ifdef RISCV_SYSCALL_OFFLOAD
+		/// @brief Like poll(), but gives up when the system call is cancelled.
+		/// For use in the work of system calls, instead of blocking calls.
+		int poll(struct pollfd* fds, size_t nfds, int timeout_ms) const;
+		/// @brief Wait until the file has events, or until the timeout
+		bool wait_ready(int fd, short events, int timeout_ms = -1) const;
+		/// @brief Check if the file has events, without waiting
+		static bool is_ready(int fd, short events);
+		static long result_or_error(long result) { return (result >= 0) ? result : -errno; }
+
+	private:
+		struct Job {
+			const void*  owner;
+			work_t       work;
+			completion_t completion;
+			long result = 0;
+			bool finished = false;
+			std::atomic<bool> cancelled { false };
+		};
+		std::atomic<bool> m_stopping { false };
+		std::atomic<size_t> m_in_flight { 0 };
+		std::mutex m_lock;
+		std::condition_variable m_done_cv;
+		std::vector<std::shared_ptr<Job>> m_jobs;
+		size_t m_finished = 0;
+		ThreadPool m_pool;
+#else
+	private:
+		std::atomic<size_t> m_in_flight { 0 };
+#endif
+	};
+
+	template <int W>
+	inline void Machine<W>::offload_syscall(std::function<long()> work, std::function<void(Machine&, long)> completion)
+	{
+		// Stop right after the current system call, until the work is done
+		this->m_parked = true;
+		m_offload->submit(this, std::move(work), [this, completion = std::move(completion)] (long result) {
+			this->m_parked = false;
+			try {
+				this->set_result(result);
+				if (completion)
+					completion(*this, result);
+			} catch (...) {
+				// Eg. a guest fault when writing the result, which belongs to
+				// this machine: it is rethrown by its next simulate()
+				this->m_offload_exception = std::current_exception();
+			}
+		});
+		this->stop();
+	}
+
+} // riscv
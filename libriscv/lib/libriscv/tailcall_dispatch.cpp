@@ -2,6 +2,7 @@
 #include "decoder_cache.hpp"
 #include "internal_common.hpp"
 #include "instruction_counter.hpp"
+#include "superinstructions.hpp"
 #include "threaded_bytecodes.hpp"
 #include "rv32i_instr.hpp"
 #include "rvfd.hpp"
@@ -31,11 +32,23 @@
 #define EXECUTE_CURRENT()              \
 	MUSTTAIL return EXECUTE_INSTR();
 #define NEXT_INSTR()                   \
+	RECORD_BYTECODE_SEQUENCE(d, compressed_enabled ? 2 : 1) \
 	d += (compressed_enabled ? 2 : 1); \
 	EXECUTE_CURRENT()
 #define NEXT_C_INSTR() \
+	RECORD_BYTECODE_SEQUENCE(d, 1) \
 	d += 1;            \
 	EXECUTE_CURRENT()
+#define NEXT_FUSED_INSTR(bc)           \
+	d += (compressed_enabled ? 2 : 1); \
+	if (UNLIKELY(d->get_bytecode() != bc)) { \
+		EXECUTE_CURRENT()              \
+	}
+#define NEXT_FUSED_C_INSTR(bc) \
+	d += 1;                    \
+	if (UNLIKELY(d->get_bytecode() != bc)) { \
+		EXECUTE_CURRENT()      \
+	}
 
 #define RETURN_VALUES()   \
 	{pc}
@@ -355,6 +368,9 @@ namespace riscv
 #endif
 		[RV32I_BC_LIVEPATCH] = execute_livepatch,
 		[RV32I_BC_SYSTEM]  = rv32i_system,
+#define SUPERINSTRUCTION(bc, lbl, ...) [bc] = lbl,
+#include "threaded_superinstructions.hpp"
+#undef SUPERINSTRUCTION
 		};
 	}
 
@@ -129,4 +129,7 @@ static constexpr void *computed_opcode[] = {
 #endif
 	[RV32I_BC_LIVEPATCH]  = &&execute_livepatch,
 	[RV32I_BC_SYSTEM] = &&rv32i_system,
+#define SUPERINSTRUCTION(bc, lbl, ...) [bc] = &&lbl,
+#include "threaded_superinstructions.hpp"
+#undef SUPERINSTRUCTION
 };
@@ -138,6 +138,10 @@ namespace riscv
 #endif
 		RV32I_BC_LIVEPATCH,
 		RV32I_BC_SYSTEM,
+		// Generated from a profile, see superinstructions.hpp
+#define SUPERINSTRUCTION(bc, lbl, ...) bc,
+#include "threaded_superinstructions.hpp"
+#undef SUPERINSTRUCTION
 		BYTECODES_MAX
 	};
 	static_assert(BYTECODES_MAX <= 256, "A bytecode must fit in a byte");
@@ -0,0 +1,53 @@
+/**
+ * Generated by scripts/superinstructions.py from superinstructions.profile.
+ * Do not edit, regenerate with the generate_superinstructions target.
+**/
+// SUPERINSTRUCTION(bytecode, label, length, op1, op2, op3, compressed_mask)
+SUPERINSTRUCTION(RV32I_BC_FUSED_ADDI_OP_ADD_MV, fused_addi_op_add_mv, 3, RV32I_BC_ADDI, RV32I_BC_OP_ADD, RV32I_BC_MV, 0x0)
+#if defined(RISCV_64I)
+SUPERINSTRUCTION(RV32I_BC_FUSED_LDD_LDD, fused_ldd_ldd, 2, RV32I_BC_LDD, RV32I_BC_LDD, RV32I_BC_INVALID, 0x0)
+#endif
+#if defined(RISCV_64I)
+SUPERINSTRUCTION(RV32I_BC_FUSED_STD_STD_STD, fused_std_std_std, 3, RV32I_BC_STD, RV32I_BC_STD, RV32I_BC_STD, 0x0)
+#endif
+#if defined(RISCV_EXT_COMPRESSED)
+SUPERINSTRUCTION(RV32I_BC_FUSED_C_STD_C_STD_C_STD, fused_c_std_c_std_c_std, 3, RV32C_BC_STD, RV32C_BC_STD, RV32C_BC_STD, 0x3)
+#endif
+SUPERINSTRUCTION(RV32I_BC_FUSED_LDBU_SLLI_OP_OR, fused_ldbu_slli_op_or, 3, RV32I_BC_LDBU, RV32I_BC_SLLI, RV32I_BC_OP_OR, 0x0)
+#if defined(RISCV_EXT_COMPRESSED)
+SUPERINSTRUCTION(RV32I_BC_FUSED_C_LDD_C_LDD_C_LDD, fused_c_ldd_c_ldd_c_ldd, 3, RV32C_BC_LDD, RV32C_BC_LDD, RV32C_BC_LDD, 0x3)
+#endif
+SUPERINSTRUCTION(RV32I_BC_FUSED_STW_STW_STW, fused_stw_stw_stw, 3, RV32I_BC_STW, RV32I_BC_STW, RV32I_BC_STW, 0x0)
+SUPERINSTRUCTION(RV32I_BC_FUSED_STB_ADDI_BGEU, fused_stb_addi_bgeu, 3, RV32I_BC_STB, RV32I_BC_ADDI, RV32I_BC_BGEU, 0x0)
+#if defined(RISCV_EXT_COMPRESSED)
+SUPERINSTRUCTION(RV32I_BC_FUSED_C_ADDI_C_ADDI, fused_c_addi_c_addi, 2, RV32C_BC_ADDI, RV32C_BC_ADDI, RV32I_BC_INVALID, 0x1)
+#endif
+SUPERINSTRUCTION(RV32I_BC_FUSED_LDW_LDW, fused_ldw_ldw, 2, RV32I_BC_LDW, RV32I_BC_LDW, RV32I_BC_INVALID, 0x0)
+#if defined(RISCV_64I)
+SUPERINSTRUCTION(RV32I_BC_FUSED_LDD_LDD_LDD, fused_ldd_ldd_ldd, 3, RV32I_BC_LDD, RV32I_BC_LDD, RV32I_BC_LDD, 0x0)
+#endif
+#if defined(RISCV_EXT_COMPRESSED)
+SUPERINSTRUCTION(RV32I_BC_FUSED_C_STD_C_STD, fused_c_std_c_std, 2, RV32C_BC_STD, RV32C_BC_STD, RV32I_BC_INVALID, 0x1)
+#endif
+SUPERINSTRUCTION(RV32I_BC_FUSED_ADDI_JALR, fused_addi_jalr, 2, RV32I_BC_ADDI, RV32I_BC_JALR, RV32I_BC_INVALID, 0x0)
+SUPERINSTRUCTION(RV32I_BC_FUSED_ANDI_LI, fused_andi_li, 2, RV32I_BC_ANDI, RV32I_BC_LI, RV32I_BC_INVALID, 0x0)
+#if defined(RISCV_64I)
+SUPERINSTRUCTION(RV32I_BC_FUSED_STD_STD, fused_std_std, 2, RV32I_BC_STD, RV32I_BC_STD, RV32I_BC_INVALID, 0x0)
+#endif
+SUPERINSTRUCTION(RV32I_BC_FUSED_OP_SH2ADD_LDW_MV, fused_op_sh2add_ldw_mv, 3, RV32I_BC_OP_SH2ADD, RV32I_BC_LDW, RV32I_BC_MV, 0x0)
+SUPERINSTRUCTION(RV32I_BC_FUSED_OP_ADD_SEXT_B_BGE, fused_op_add_sext_b_bge, 3, RV32I_BC_OP_ADD, RV32I_BC_SEXT_B, RV32I_BC_BGE, 0x0)
+SUPERINSTRUCTION(RV32I_BC_FUSED_STB_NOP_SRLI, fused_stb_nop_srli, 3, RV32I_BC_STB, RV32I_BC_NOP, RV32I_BC_SRLI, 0x0)
+#if defined(RISCV_EXT_COMPRESSED)
+SUPERINSTRUCTION(RV32I_BC_FUSED_C_LDD_C_LDD, fused_c_ldd_c_ldd, 2, RV32C_BC_LDD, RV32C_BC_LDD, RV32I_BC_INVALID, 0x1)
+#endif
+#if defined(RISCV_EXT_COMPRESSED)
+SUPERINSTRUCTION(RV32I_BC_FUSED_LDBU_C_ADDI_BNE_FW, fused_ldbu_c_addi_bne_fw, 3, RV32I_BC_LDBU, RV32C_BC_ADDI, RV32I_BC_BNE_FW, 0x2)
+#endif
+#if defined(RISCV_64I)
+SUPERINSTRUCTION(RV32I_BC_FUSED_SLLI_OP_ADD_LDWU, fused_slli_op_add_ldwu, 3, RV32I_BC_SLLI, RV32I_BC_OP_ADD, RV32I_BC_LDWU, 0x0)
+#endif
+SUPERINSTRUCTION(RV32I_BC_FUSED_ADDI_ADDI_BGEU, fused_addi_addi_bgeu, 3, RV32I_BC_ADDI, RV32I_BC_ADDI, RV32I_BC_BGEU, 0x0)
+SUPERINSTRUCTION(RV32I_BC_FUSED_SLTIU_OP_SUB_OP_AND, fused_sltiu_op_sub_op_and, 3, RV32I_BC_SLTIU, RV32I_BC_OP_SUB, RV32I_BC_OP_AND, 0x0)
+#if defined(RISCV_EXT_COMPRESSED)
+SUPERINSTRUCTION(RV32I_BC_FUSED_C_ADDI_C_ADDI_C_ADDI, fused_c_addi_c_addi_c_addi, 3, RV32C_BC_ADDI, RV32C_BC_ADDI, RV32C_BC_ADDI, 0x3)
+#endif
@@ -151,7 +151,7 @@ typedef struct {
 typedef void (*syscall_t) (CPU*);
 typedef void (*handler) (CPU*, uint32_t);
 
-static struct CallbackTable {
+struct CallbackTable {
 	addr_t (*mem_ld) (const CPU*, addr_t, unsigned);
 	void (*mem_st) (const CPU*, addr_t, addr_t, unsigned);
 	void (*vec_load)(const CPU*, int, addr_t);
@@ -173,7 +173,20 @@ static struct CallbackTable {
 	int (*ctzl) (uint64_t);
 	int (*cpop) (uint32_t);
 	int (*cpopl) (uint64_t);
-} api;
+};
+// A translation compiled as several parts shares one callback table,
+// and the block functions are visible to the other parts
+#ifdef RISCV_TRANSLATION_PARTS
+#  define BLOCK_FUNC INTERNAL
+#  ifdef RISCV_TRANSLATION_MAIN
+INTERNAL struct CallbackTable api;
+#  else
+extern INTERNAL struct CallbackTable api;
+#  endif
+#else
+#  define BLOCK_FUNC static
+static struct CallbackTable api;
+#endif
 #define INS_COUNTER(cpu) (*(uint64_t *)((uintptr_t)cpu + RISCV_INS_COUNTER_OFF))
 #define MAX_COUNTER(cpu) (*(uint64_t *)((uintptr_t)cpu + RISCV_MAX_COUNTER_OFF))
 #define ARENA_READ_BOUNDARY  (RISCV_ARENA_END - 0x1000)
@@ -227,7 +240,7 @@ static inline uint64_t MUL128(
 	return (middle << 32) | (uint32_t)p00;
 }
 
-#ifndef EMBEDDABLE_CODE
+#if !defined(EMBEDDABLE_CODE) && (!defined(RISCV_TRANSLATION_PARTS) || defined(RISCV_TRANSLATION_MAIN))
 extern VISIBLE void init(struct CallbackTable* table, char* arena)
 {
 	api = *table;
@@ -100,6 +100,94 @@ namespace riscv
 		return dlopen(outfile.c_str(), RTLD_LAZY);
 	}
 
+	void*
+	compile_parts(const std::vector<std::string>& parts, int arch, const std::string& cflags,
+		const std::string& outfile)
+	{
+		struct Part {
+			char  name[64] {};
+			FILE* f = nullptr;
+		};
+		std::vector<Part> units(parts.size());
+		bool failed = false;
+
+		// start one compiler process per part, so they run concurrently
+		for (size_t i = 0; i < parts.size() && !failed; i++) {
+			auto& unit = units[i];
+			strncpy(unit.name, "/tmp/rvtrcode-XXXXXX", sizeof(unit.name));
+			const int fd = mkstemp(unit.name);
+			if (fd < 0) {
+				unit.name[0] = 0;
+				failed = true;
+				break;
+			}
+			ssize_t len = write(fd, parts[i].c_str(), parts[i].size());
+			close(fd);
+			if (len < (ssize_t) parts[i].size()) {
+				failed = true;
+				break;
+			}
+			const std::string command =
+				compile_command(arch, cflags) + " -c "
+				 + " -o " + std::string(unit.name) + ".o "
+				 + std::string(unit.name) + " 2>&1"; // redirect stderr
+			if (verbose()) {
+				printf("Command: %s\n", command.c_str());
+			}
+			unit.f = popen(command.c_str(), "r");
+			failed = (unit.f == nullptr);
+		}
+
+		// wait for all the compilers to finish
+		std::string objects;
+		for (auto& unit : units) {
+			if (unit.f != nullptr) {
+				char buffer[2048];
+				while (fgets(buffer, sizeof(buffer), unit.f) != NULL) {
+					if (verbose())
+						fprintf(stderr, "%s", buffer);
+				}
+				if (pclose(unit.f) != 0)
+					failed = true;
+				objects.append(" ").append(unit.name).append(".o");
+			}
+			if (unit.name[0] != 0 && !keep_code()) {
+				// delete temporary code file
+				unlink(unit.name);
+			}
+		}
+
+		if (!failed) {
+			// link the parts into one shared object
+			const std::string command =
+				compiler() + " -s -shared -o " + outfile + " -x none"
+				 + objects + " 2>&1"; // redirect stderr
+			if (verbose()) {
+				printf("Command: %s\n", command.c_str());
+			}
+			FILE* f = popen(command.c_str(), "r");
+			if (f != nullptr) {
+				char buffer[2048];
+				while (fgets(buffer, sizeof(buffer), f) != NULL) {
+					if (verbose())
+						fprintf(stderr, "%s", buffer);
+				}
+				failed = pclose(f) != 0;
+			} else {
+				failed = true;
+			}
+		}
+		for (auto& unit : units) {
+			if (unit.f != nullptr) {
+				unlink((std::string(unit.name) + ".o").c_str());
+			}
+		}
+
+		if (failed)
+			return nullptr;
+		return dlopen(outfile.c_str(), RTLD_LAZY);
+	}
+
 	static std::string mingw_compile_command(int /*arch*/,
 		const std::string& cflags, const MachineTranslationCrossOptions& cross_options)
 	{
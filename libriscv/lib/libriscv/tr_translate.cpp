@@ -4,10 +4,12 @@
 #  define RISCV_HAS_BITOPS
 # endif
 #endif
+#include <algorithm>
 #include <cmath>
 #include <chrono>
 #include <fstream>
 #include <mutex>
+#include <thread>
 #if defined(__MINGW32__) || defined(__MINGW64__) || defined(_MSC_VER)
 # define YEP_IS_WINDOWS 1
 # include "win32/dlfcn.h"
@@ -191,6 +193,11 @@ static std::unordered_map<std::string, std::string> create_defines_for(const Mac
 	if (options.translate_ignore_instruction_limit) {
 		defines.emplace("RISCV_IGNORE_INSTRUCTION_LIMIT", "1");
 	}
+	if (options.translate_hot_threshold > 0) {
+		// A tiered translation only covers the hot set, and must
+		// not be mistaken for a full translation in the cache.
+		defines.emplace("RISCV_TRANSLATE_HOT", "1");
+	}
 	if constexpr (encompassing_Nbit_arena != 0) {
 		defines.emplace("RISCV_NBIT_UNBOUNDED", std::to_string(encompassing_Nbit_arena));
 	}
@@ -392,6 +399,9 @@ void CPU<W>::binary_translate(const MachineOptions<W>& options, DecodedExecuteSe
 	// Run with VERBOSE=1 to see command and output
 	const bool verbose = options.verbose_loader;
 	const bool trace_instructions = options.translate_trace;
+	// Tiered translation scans the whole segment, and then
+	// keeps only the hot blocks and their static callees
+	const bool tiered = !output.hot_regions.empty();
 
 	const address_t basepc    = exec.exec_begin();
 	const address_t endbasepc = exec.exec_end();
@@ -454,6 +464,8 @@ if constexpr (SCAN_FOR_GP) {
 	// Code block and loop detection
 	TIME_POINT(t2);
 	static constexpr size_t ITS_TIME_TO_SPLIT = (libtcc_enabled) ? 150'000 : 1'250;
+	// Split at every return when tiered, so that blocks are roughly function-sized
+	const size_t split_at = (tiered) ? 1 : ITS_TIME_TO_SPLIT;
 	size_t icounter = 0;
 	std::unordered_set<address_type<W>> global_jump_locations;
 	std::unordered_map<address_type<W>, address_type<W>> single_return_locations;
@@ -472,7 +484,7 @@ if constexpr (SCAN_FOR_GP) {
 		}
 	}
 
-	for (address_t pc = basepc; pc < endbasepc && icounter < options.translate_instr_max; )
+	for (address_t pc = basepc; pc < endbasepc && (tiered || icounter < options.translate_instr_max); )
 	{
 		const auto block = pc;
 		std::size_t block_insns = 0;
@@ -487,7 +499,7 @@ if constexpr (SCAN_FOR_GP) {
 			block_insns++;
 
 			// JALR and STOP are show-stoppers / code-block enders
-			if (block_insns >= ITS_TIME_TO_SPLIT && is_stopping_instruction(instruction)) {
+			if (block_insns >= split_at && is_stopping_instruction(instruction)) {
 				break;
 			}
 		}
@@ -578,7 +590,7 @@ if constexpr (SCAN_FOR_GP) {
 
 		// Process block and add it for emission
 		const size_t length = block_instructions.size();
-		if (length > 0 && icounter + length < options.translate_instr_max)
+		if (length > 0 && (tiered || icounter + length < options.translate_instr_max))
 		{
 			if constexpr (VERBOSE_BLOCKS) {
 				printf("Block found at %#lX -> %#lX. Length: %zu\n", long(block), long(block_end), length);
@@ -608,13 +620,87 @@ if constexpr (SCAN_FOR_GP) {
 			icounter += length;
 			// we can't translate beyond this estimate, otherwise
 			// the compiler will never finish code generation
-			if (blocks.size() >= options.translate_blocks_max)
+			if (!tiered && blocks.size() >= options.translate_blocks_max)
 				break;
 		}
 
 		pc = block_end;
 	}
 
+	if (tiered) {
+		const size_t total_blocks = blocks.size();
+		// Blocks are sorted by address and do not overlap
+		auto block_index_of = [&blocks] (address_t addr) -> size_t {
+			auto it = std::upper_bound(blocks.begin(), blocks.end(), addr,
+				[] (address_t addr, const TransInfo<W>& blk) { return addr < blk.basepc; });
+			if (it == blocks.begin() || addr >= (it-1)->endpc)
+				return blocks.size();
+			return (it - blocks.begin()) - 1;
+		};
+		std::vector<bool> selected(blocks.size(), false);
+		std::vector<size_t> worklist;
+
+		for (size_t i = 0; i < blocks.size(); i++) {
+			const auto& blk = blocks[i];
+			static constexpr unsigned SHIFT = TranslationProfile<W>::REGION_SHIFT;
+			for (address_t region = blk.basepc >> SHIFT; region <= (blk.endpc - 1) >> SHIFT; region++) {
+				if (output.hot_regions.count(region)) {
+					selected[i] = true;
+					worklist.push_back(i);
+					break;
+				}
+			}
+		}
+		// Static callees of hot blocks are likely to be hot as well
+		while (!worklist.empty()) {
+			const auto& blk = blocks[worklist.back()];
+			worklist.pop_back();
+
+			address_t pc = blk.basepc;
+			for (const auto instruction : blk.instr) {
+				address_t callee = 0;
+				if (instruction.opcode() == RV32I_JAL && instruction.Jtype.rd != 0) {
+					callee = pc + instruction.Jtype.jump_offset();
+				}
+#ifdef RISCV_EXT_C
+				else if (W == 4 && instruction.is_compressed()
+					&& rv32c_instruction{instruction}.opcode() == CI_CODE(0b001, 0b01)) { // C.JAL
+					callee = pc + rv32c_instruction{instruction}.CJ.signed_imm();
+				}
+#endif
+				if (callee != 0) {
+					const size_t idx = block_index_of(callee);
+					if (idx < blocks.size() && !selected[idx]) {
+						selected[idx] = true;
+						worklist.push_back(idx);
+					}
+				}
+				if constexpr (compressed_enabled)
+					pc += instruction.length();
+				else
+					pc += 4;
+			}
+		}
+
+		std::vector<TransInfo<W>> hot_blocks;
+		icounter = 0;
+		for (size_t i = 0; i < blocks.size(); i++) {
+			const size_t length = blocks[i].instr.size();
+			if (!selected[i] || icounter + length >= options.translate_instr_max)
+				continue;
+			hot_blocks.push_back(std::move(blocks[i]));
+			icounter += length;
+			if (hot_blocks.size() >= options.translate_blocks_max)
+				break;
+		}
+		blocks = std::move(hot_blocks);
+
+		if (verbose) {
+			printf("libriscv: Tiered translation selected %zu/%zu blocks from %zu hot regions\n",
+				blocks.size(), total_blocks, output.hot_regions.size());
+		}
+	}
+
 	TIME_POINT(t3);
 	if (options.translate_timing) {
 		printf(">> Code block detection %ld ns\n", nanodiff(t2, t3));
@@ -624,11 +710,14 @@ if constexpr (SCAN_FOR_GP) {
 	auto& dlmappings = output.mappings;
 	extern const std::string bintr_code;
 	output.code = std::make_shared<std::string>(bintr_code);
+	output.block_offsets.reserve(blocks.size() + 1);
+	output.block_offsets.push_back(output.code->size());
 
 	for (auto& block : blocks)
 	{
 		block.blocks = &blocks;
 		auto result = emit(*output.code, block);
+		output.block_offsets.push_back(output.code->size());
 
 		for (auto& mapping : result) {
 			dlmappings.push_back(std::move(mapping));
@@ -671,12 +760,16 @@ VISIBLE const struct Mapping mappings[] = {
 		footer.append(buffer);
 	}
 	footer += "};\nVISIBLE const uint32_t no_handlers = "
-		+ std::to_string(mapping_indices.size()) + ";\n"
-		+ "VISIBLE const void* unique_mappings[] = {\n";
+		+ std::to_string(mapping_indices.size()) + ";\n";
 
 	// Create array of unique mappings
 	if (handlers.size() != blocks.size())
 		throw MachineException(INVALID_PROGRAM, "Mismatch in unique mappings");
+	// The footer may be compiled separately from the blocks
+	for (auto* handler : handlers) {
+		footer += "BLOCK_FUNC ReturnValues " + *handler + "(CPU*, uint64_t, uint64_t, addr_t);\n";
+	}
+	footer += "VISIBLE const void* unique_mappings[] = {\n";
 	for (auto* handler : handlers) {
 		footer += "    " + *handler + ",\n";
 	}
@@ -754,9 +847,39 @@ void CPU<W>::produce_embeddable_code(const MachineOptions<W>& options, DecodedEx
 	embed_file << "}\n";
 }
 
+// Split the emitted blocks into parts of roughly equal size. Each part
+// repeats the common header, and the last part holds the mapping tables.
+template <int W>
+static std::vector<std::string> split_translation(const TransOutput<W>& output, unsigned jobs)
+{
+	const std::string& code = *output.code;
+	const auto& offsets = output.block_offsets;
+	const std::string_view header(code.data(), offsets.front());
+	const size_t part_size = (code.size() - header.size()) / jobs + 1;
+
+	std::vector<std::string> parts;
+	size_t begin = header.size();
+	for (size_t i = 1; i < offsets.size(); i++)
+	{
+		if (offsets[i] - begin >= part_size || i == offsets.size() - 1)
+		{
+			std::string part = "#define RISCV_TRANSLATION_PARTS 1\n";
+			part.append(header);
+			part.append(code, begin, offsets[i] - begin);
+			parts.push_back(std::move(part));
+			begin = offsets[i];
+		}
+	}
+	std::string main_part = "#define RISCV_TRANSLATION_PARTS 1\n#define RISCV_TRANSLATION_MAIN 1\n";
+	main_part.append(header);
+	main_part.append(output.footer);
+	parts.push_back(std::move(main_part));
+	return parts;
+}
+
 template <int W>
 void CPU<W>::try_translate(const MachineOptions<W>& options, const std::string& filename,
-	std::shared_ptr<DecodedExecuteSegment<W>>& shared_segment) const
+	std::shared_ptr<DecodedExecuteSegment<W>>& shared_segment, std::vector<address_t> hot_regions) const
 {
 	// Check if compiling new translations is enabled
 	if (!options.translate_invoke_compiler)
@@ -767,14 +890,23 @@ void CPU<W>::try_translate(const MachineOptions<W>& options, const std::string&
 	output.t0 = t0;
 
 	output.defines = create_defines_for(machine(), options);
-	const bool live_patch = options.translate_background_callback != nullptr;
+	output.hot_regions.insert(hot_regions.begin(), hot_regions.end());
+	// A tiered translation is applied to a segment that is already running,
+	// and later tiers are added to the translation of the earlier ones
+	const bool tiered = !hot_regions.empty();
+	const bool live_patch = options.translate_background_callback != nullptr || tiered;
 	void* arena = machine().memory.memory_arena_ptr_ref();
 
 	// Compilation step
 	std::function<void()> compilation_step =
-	[this, options, output = std::move(output), filename, arena, live_patch, shared_segment = shared_segment] () mutable
+	[this, options, output = std::move(output), filename, arena, live_patch, tiered, shared_segment = shared_segment] () mutable
 	{
 		auto* exec = shared_segment.get();
+		// The next hot set can be translated once this tier is active, or has failed
+		struct TierDone {
+			TranslationProfile<W>* profile;
+			~TierDone() { if (profile) profile->translating = false; }
+		} tier_done { tiered ? exec->translation_profile() : nullptr };
 
 		this->binary_translate(options, *exec, output);
 
@@ -803,14 +935,21 @@ void CPU<W>::try_translate(const MachineOptions<W>& options, const std::string&
 			dylib = libtcc_compile(shared_library_code, W, output.defines, "");
 		} else {
 			extern void* compile(const std::string&, int arch, const std::string& cflags, const std::string&);
+			extern void* compile_parts(const std::vector<std::string>&, int arch, const std::string& cflags, const std::string&);
 			extern bool mingw_compile(const std::string&, int arch, const std::string& cflags, const std::string&, const MachineTranslationCrossOptions&);
 			const std::string cflags = defines_to_string(output.defines);
 
 			// If the binary translation has already been loaded, we can skip compilation
-			if (exec->is_binary_translated()) {
+			if (exec->is_binary_translated() && !tiered) {
 				dylib = exec->binary_translation_so();
 			} else {
-				dylib = compile(shared_library_code, W, cflags, filename);
+				unsigned jobs = options.translate_compile_jobs;
+				if (jobs == 0)
+					jobs = std::thread::hardware_concurrency();
+				if (jobs > 1 && output.block_offsets.size() > 2)
+					dylib = compile_parts(split_translation(output, jobs), W, cflags, filename);
+				else
+					dylib = compile(shared_library_code, W, cflags, filename);
 			}
 
 			// Optionally produce cross-compiled binaries
@@ -836,7 +975,7 @@ void CPU<W>::try_translate(const MachineOptions<W>& options, const std::string&
 
 		// Check compilation result
 		if (dylib != nullptr) {
-			if (!exec->is_binary_translated()) {
+			if (!exec->is_binary_translated() || tiered) {
 				activate_dylib(options, *exec, dylib, arena, libtcc_enabled, live_patch);
 			}
 
@@ -863,10 +1002,99 @@ void CPU<W>::try_translate(const MachineOptions<W>& options, const std::string&
 	}
 }
 
+template <int W>
+void CPU<W>::defer_translation(const MachineOptions<W>& options, const std::string& filename,
+	DecodedExecuteSegment<W>& exec) const
+{
+	// Check if compiling new translations is enabled
+	if (!options.translate_invoke_compiler)
+		return;
+
+	auto profile = std::make_shared<TranslationProfile<W>>();
+	profile->options  = options;
+	profile->filename = filename;
+	exec.set_translation_profile(std::move(profile));
+
+	if (options.verbose_loader) {
+		printf("libriscv: Deferring translation of 0x%lX-0x%lX until %u samples in a region\n",
+			(long)exec.exec_begin(), (long)exec.exec_end(), options.translate_hot_threshold);
+	}
+}
+
+template <int W>
+bool CPU<W>::simulate_tiered(address_t pc, uint64_t icounter, uint64_t maxcounter)
+{
+	while (true)
+	{
+		auto* profile = this->m_exec->translation_profile();
+		if (profile == nullptr || profile->translating)
+			return this->simulate(pc, icounter, maxcounter);
+
+		const uint64_t interval = std::max(1u, profile->options.translate_hot_sample_interval);
+		const uint64_t slice = (icounter < maxcounter && maxcounter - icounter > interval)
+			? icounter + interval : maxcounter;
+		if (this->simulate(pc, icounter, slice))
+			return true;
+		if (slice == maxcounter)
+			return false;
+
+		// The slice ran out: sample the PC of the current execute segment
+		pc = this->pc();
+		icounter = machine().instruction_counter();
+		profile = this->m_exec->translation_profile();
+		if (profile == nullptr || profile->translating)
+			continue;
+
+		std::vector<address_t> hot_regions;
+		unsigned tier = 0;
+		{
+			std::lock_guard<std::mutex> lock(profile->mtx);
+			const address_t region = pc >> TranslationProfile<W>::REGION_SHIFT;
+			const unsigned threshold = profile->options.translate_hot_threshold;
+			// Regions of an earlier tier are sampled when leaving translated code
+			if (profile->translated.count(region) == 0
+				&& ++profile->samples[region] >= threshold && !profile->translating.exchange(true))
+			{
+				// Every region that is hot by now goes into this tier, the
+				// translator adds their static callees. The rest keep counting.
+				for (auto it = profile->samples.begin(); it != profile->samples.end(); ) {
+					if (it->second >= threshold) {
+						hot_regions.push_back(it->first);
+						profile->translated.insert(it->first);
+						it = profile->samples.erase(it);
+					} else {
+						++it;
+					}
+				}
+				tier = ++profile->tiers;
+			}
+		}
+		if (!hot_regions.empty()) {
+			if (profile->options.verbose_loader) {
+				printf("libriscv: Translating %zu hot regions (tier %u) after %lu instructions\n",
+					hot_regions.size(), tier, (long)icounter);
+			}
+			if (tier == 1) {
+				this->try_translate(profile->options, profile->filename,
+					machine().memory.exec_segment_for(pc), std::move(hot_regions));
+			} else {
+				// Later tiers are only ever loaded by this segment, and need
+				// a file of their own: the dynamic loader caches by path
+				auto options = profile->options;
+				options.translation_cache = false;
+				this->try_translate(options, profile->filename + ".tier" + std::to_string(tier),
+					machine().memory.exec_segment_for(pc), std::move(hot_regions));
+			}
+		}
+	}
+}
+
 template <int W>
 void CPU<W>::activate_dylib(const MachineOptions<W>& options, DecodedExecuteSegment<W>& exec, void* dylib, void* arena, bool is_libtcc, bool live_patch)
 {
 	TIME_POINT(t11);
+	// A later tier of a tiered translation is added to the earlier ones
+	const bool append = live_patch && exec.is_binary_translated();
 
 	if (!initialize_translated_segment(exec, dylib, arena, is_libtcc))
 	{
@@ -879,7 +1107,8 @@ void CPU<W>::activate_dylib(const MachineOptions<W>& options, DecodedExecuteSegm
 		if (dylib != nullptr) {
 			dylib_close(dylib, is_libtcc);
 		}
-		exec.set_binary_translated(nullptr, false);
+		if (!append)
+			exec.set_binary_translated(nullptr, false);
 		return;
 	}
 
@@ -891,22 +1120,34 @@ void CPU<W>::activate_dylib(const MachineOptions<W>& options, DecodedExecuteSegm
 
 	if (no_mappings == nullptr || mappings == nullptr || *no_mappings > 500000UL) {
 		dylib_close(dylib, is_libtcc);
-		exec.set_binary_translated(nullptr, false);
+		if (!append)
+			exec.set_binary_translated(nullptr, false);
 		throw MachineException(INVALID_PROGRAM, "Invalid mappings in binary translation program");
 	}
 
 	// After this, we should automatically close the dylib on destruction
-	exec.set_binary_translated(dylib, is_libtcc);
+	if (append)
+		exec.add_binary_translation_tier(dylib);
+	else
+		exec.set_binary_translated(dylib, is_libtcc);
 
 	// Helper to rebuild decoder blocks
 	std::unique_ptr<DecoderCache<W>[]> patched_decoder_cache = nullptr;
 	DecoderData<W>* patched_decoder = nullptr;
 	DecoderData<W>* decoder_begin   = nullptr;
+	DecoderData<W>* original_decoder = nullptr;
 	std::vector<DecoderData<W>*> livepatch_bintr;
 	if (live_patch) {
 		patched_decoder_cache = std::make_unique<DecoderCache<W>[]>(exec.decoder_cache_size());
-		// Copy the decoder cache to the patched decoder cache
-		std::memcpy(patched_decoder_cache.get(), exec.decoder_cache_base(), exec.decoder_cache_size() * sizeof(DecoderCache<W>));
+		// Copy the decoder cache to the patched decoder cache, which
+		// for a later tier is the patched decoder of the earlier ones
+		const auto* source = append ? exec.patched_decoder_cache_base() : exec.decoder_cache_base();
+		std::memcpy(patched_decoder_cache.get(), source, exec.decoder_cache_size() * sizeof(DecoderCache<W>));
+		if (append) {
+			// The current decoder is the patched decoder of the earlier tiers,
+			// and code that still runs in the original decoder is redirected too
+			original_decoder = exec.decoder_cache_base()[0].get_base() - exec.pagedata_base() / DecoderCache<W>::DIVISOR;
+		}
 		// A horrible calculation to find the patched decoder
 		patched_decoder = patched_decoder_cache[0].get_base() - exec.pagedata_base() / DecoderCache<W>::DIVISOR;
 		decoder_begin = &decoder_entry_at(patched_decoder, exec.exec_begin());
@@ -916,13 +1157,15 @@ void CPU<W>::activate_dylib(const MachineOptions<W>& options, DecodedExecuteSegm
 	std::unordered_map<bintr_block_func<W>, unsigned> block_indices;
 	const unsigned nmappings = *no_mappings;
 	const unsigned unique_mappings = *no_handlers;
+	// The handlers of a later tier come after those of the earlier ones
+	const unsigned mapping_base = append ? exec.translator_mappings() : 0;
 
 	// Create N+1 mappings, where the last one is a catch-all for invalid mappings
-	exec.create_mappings(unique_mappings + 1);
+	exec.create_mappings(mapping_base + unique_mappings + 1);
 	for (unsigned i = 0; i < unique_mappings; i++) {
-		exec.set_mapping(i, handlers[i]);
+		exec.set_mapping(mapping_base + i, handlers[i]);
 	}
-	exec.set_mapping(unique_mappings, [] (CPU<W>&, uint64_t, uint64_t, address_t) -> bintr_block_returns<W> {
+	exec.set_mapping(mapping_base + unique_mappings, [] (CPU<W>&, uint64_t, uint64_t, address_t) -> bintr_block_returns<W> {
 		throw MachineException(INVALID_PROGRAM, "Translation mapping outside execute area");
 	});
 
@@ -979,13 +1222,15 @@ void CPU<W>::activate_dylib(const MachineOptions<W>& options, DecodedExecuteSegm
 					auto& p = decoder_entry_at(patched_decoder, addr);
 					p.set_bytecode(RV32I_BC_TRANSLATOR);
 					p.set_invalid_handler();
-					p.instr  = mapping_index;
+					p.instr  = mapping_base + mapping_index;
 					p.idxend = 0;
 				#ifdef RISCV_EXT_C
 					p.icount = 0;
 				#endif
 					auto& original_entry = decoder_entry_at(exec.decoder_cache(), addr);
 					livepatch_bintr.push_back(&original_entry);
+					if (original_decoder != nullptr)
+						livepatch_bintr.push_back(&decoder_entry_at(original_decoder, addr));
 				} else {
 					// Normal block-end hint that will be transformed into a translation
 					// bytecode if it passes a few more checks, later.
@@ -1262,17 +1507,23 @@ std::string MachineOptions<W>::translation_filename(const std::string& prefix, u
 }
 
 #ifdef RISCV_32I
-	template void CPU<4>::try_translate(const MachineOptions<4>&, const std::string&, std::shared_ptr<DecodedExecuteSegment<4>>&) const;
+	template void CPU<4>::try_translate(const MachineOptions<4>&, const std::string&, std::shared_ptr<DecodedExecuteSegment<4>>&, std::vector<address_type<4>>) const;
+	template void CPU<4>::defer_translation(const MachineOptions<4>&, const std::string&, DecodedExecuteSegment<4>&) const;
+	template bool CPU<4>::simulate_tiered(address_type<4>, uint64_t, uint64_t);
 	template int CPU<4>::load_translation(const MachineOptions<4>&, std::string*, DecodedExecuteSegment<4>&) const;
 	template std::string MachineOptions<4>::translation_filename(const std::string&, uint32_t, const std::string&);
 #endif
 #ifdef RISCV_64I
-	template void CPU<8>::try_translate(const MachineOptions<8>&, const std::string&, std::shared_ptr<DecodedExecuteSegment<8>>&) const;
+	template void CPU<8>::try_translate(const MachineOptions<8>&, const std::string&, std::shared_ptr<DecodedExecuteSegment<8>>&, std::vector<address_type<8>>) const;
+	template void CPU<8>::defer_translation(const MachineOptions<8>&, const std::string&, DecodedExecuteSegment<8>&) const;
+	template bool CPU<8>::simulate_tiered(address_type<8>, uint64_t, uint64_t);
 	template int CPU<8>::load_translation(const MachineOptions<8>&, std::string*, DecodedExecuteSegment<8>&) const;
 	template std::string MachineOptions<8>::translation_filename(const std::string&, uint32_t, const std::string&);
 #endif
 #ifdef RISCV_128I
-	template void CPU<16>::try_translate(const MachineOptions<16>&, const std::string&, std::shared_ptr<DecodedExecuteSegment<16>>&) const;
+	template void CPU<16>::try_translate(const MachineOptions<16>&, const std::string&, std::shared_ptr<DecodedExecuteSegment<16>>&, std::vector<address_type<16>>) const;
+	template void CPU<16>::defer_translation(const MachineOptions<16>&, const std::string&, DecodedExecuteSegment<16>&) const;
+	template bool CPU<16>::simulate_tiered(address_type<16>, uint64_t, uint64_t);
 	template int CPU<16>::load_translation(const MachineOptions<16>&, std::string*, DecodedExecuteSegment<16>&) const;
 	template std::string MachineOptions<16>::translation_filename(const std::string&, uint32_t, const std::string&);
 #endif
@@ -1,5 +1,7 @@
-#include "types.hpp"
+#include "common.hpp"
 #include "rv32i_instr.hpp"
+#include <atomic>
+#include <mutex>
 #include <unordered_set>
 #include <vector>
 
@@ -16,6 +18,28 @@ namespace riscv
 		std::shared_ptr<std::string> code;
 		std::string footer;
 		std::vector<TransMapping<W>> mappings;
+		// Offsets into code: the end of the common header,
+		// followed by the end of each block
+		std::vector<size_t> block_offsets;
+		// Tiered translation: when non-empty, only blocks
+		// touching these code regions (and their callees)
+		std::unordered_set<address_type<W>> hot_regions;
+	};
+
+	// PC samples of an execute segment waiting for tiered translation
+	template <int W>
+	struct TranslationProfile
+	{
+		static constexpr unsigned REGION_SHIFT = 8; // 256-byte code regions
+
+		MachineOptions<W> options;
+		std::string filename;
+		std::mutex mtx;
+		std::unordered_map<address_type<W>, unsigned> samples; // Region -> samples
+		std::unordered_set<address_type<W>> translated; // Regions in an earlier tier
+		unsigned tiers = 0;
+		// Set while a tier is being translated, until it has been activated
+		std::atomic<bool> translating = false;
 	};
 
 	template <int W>
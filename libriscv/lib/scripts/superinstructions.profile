@@ -0,0 +1,10881 @@
+# libriscv bytecode sequences: count bytecode...
+# config: RISCV_64I RISCV_EXT_COMPRESSED RISCV_EXT_VECTOR
+113034 21 21
+99970 18 18
+75001 21 21 21
+65601 18 1
+47399 4 44
+46312 1 21
+45864 54 18
+44636 18 18 18
+36363 21 18
+35653 11 2
+34411 2 3
+33246 3 3
+31596 15 4
+31594 44 15
+31594 4 44 15
+31594 15 4 44
+31594 44 15 4
+28927 1 34
+26939 18 3
+26571 18 1 34
+25401 1 1
+24178 11 54
+23810 18 18 1
+23807 18 21
+22632 1 21 21
+21188 15 1
+19526 12 1
+19058 21 18 18
+19021 21 2
+18987 18 1 1
+18958 2 32
+18844 18 54
+18130 18 18 21
+17643 3 29
+17581 21 21 2
+17554 3 32
+17198 3 34
+17052 3 1
+16963 3 37
+16888 21 2 3
+16818 2 3 29
+16732 18 21 18
+16265 54 18 3
+16258 2 3 3
+16153 15 15
+16061 15 15 1
+15963 1 54
+15908 11 2 3
+15905 3 3 32
+15865 1 54 18
+15864 12 1 54
+15850 37 56
+15850 56 28
+15850 37 56 28
+15848 18 3 34
+15846 11 2 32
+15839 1 4
+15799 1 4 44
+15799 15 1 4
+15798 44 35
+15797 4 44 35
+15752 3 37 56
+15595 1 36
+15543 1 21 18
+15309 1 11
+14670 3 36
+13659 18 54 18
+13393 2 31
+13188 18 8
+12220 54 18 1
+12188 8 3
+12131 54 1
+12099 3 1 11
+12089 1 43
+12089 43 11
+12089 1 1 43
+12089 1 11 54
+12089 1 43 11
+12089 8 3 1
+12089 11 54 1
+12089 11 54 18
+12089 18 8 3
+12089 43 11 54
+12089 54 1 36
+12089 54 18 8
+10856 18 1 21
+10206 21 3
+9630 18 31
+9335 3 18
+8242 21 35
+7676 37 26
+6996 54 21
+6915 41 37
+6908 18 41
+6908 18 41 37
+6908 21 18 41
+6908 41 37 26
+6908 54 21 35
+6477 21 1
+6402 3 3 36
+6333 1 37
+6319 21 21 3
+6084 1 1 21
+6014 3 21
+5664 1 3
+5661 2 29
+5182 18 54 21
+5181 21 18 54
+5053 18 18 3
+4991 11 31
+4532 2 2
+4521 21 3 3
+4504 18 11
+4351 3 18 1
+4350 1 35
+4242 3 3 3
+4126 2 34
+4003 1 3 3
+3948 21 36
+3887 11 2 31
+3870 1 31
+3595 18 3 18
+3530 21 21 1
+3484 18 45
+3481 18 29
+3456 1 26
+3413 18 32
+3369 3 31
+3284 21 37
+3181 18 21 21
+3018 18 35
+2986 1 38
+2976 37 3
+2942 54 18 31
+2936 11 3
+2902 19 19
+2892 2 1
+2878 15 1 11
+2875 1 2
+2861 18 12
+2847 1 18
+2844 3 35
+2839 37 18
+2716 18 25
+2667 37 21
+2622 18 11 31
+2552 11 1
+2521 10 21
+2501 19 19 19
+2498 21 21 18
+2403 1 21 3
+2395 38 31
+2393 37 15
+2281 15 19
+2221 3 21 36
+2165 3 1 3
+2159 18 4
+2152 18 15
+2146 11 11
+2131 19 18
+2048 18 3 31
+1987 11 37
+1962 3 2
+1946 37 18 1
+1932 3 18 35
+1925 1 30
+1924 37 19
+1923 19 1
+1907 45 25
+1890 18 2
+1878 37 21 21
+1865 37 35
+1861 3 3 21
+1856 21 1 26
+1851 18 37
+1830 21 21 37
+1818 1 1 3
+1814 2 15
+1812 21 18 21
+1811 1 32
+1804 21 3 18
+1796 18 1 30
+1793 18 1 31
+1786 11 3 1
+1767 21 54
+1759 1 21 54
+1741 1 37 3
+1735 21 54 21
+1734 1 37 35
+1729 37 3 35
+1728 45 31
+1727 1 38 31
+1727 11 1 1
+1727 18 45 25
+1727 18 45 31
+1722 2 2 15
+1684 10 21 21
+1674 37 1
+1640 4 54
+1624 21 37 21
+1622 55 18
+1592 4 54 18
+1573 15 2
+1556 18 34
+1536 18 4 54
+1529 2 21
+1523 2 2 2
+1519 1 19
+1517 1 37 18
+1501 18 19
+1500 21 19
+1496 18 12 1
+1487 21 34
+1478 21 104
+1474 1 21 1
+1468 19 26
+1463 1 19 26
+1450 3 2 1
+1448 1 56
+1448 11 39
+1448 39 44
+1448 44 1
+1448 56 27
+1448 1 11 39
+1448 1 56 27
+1448 11 39 44
+1448 39 44 1
+1448 44 1 56
+1444 12 21
+1439 3 21 21
+1436 18 18 54
+1436 21 21 104
+1434 18 3 21
+1425 54 18 34
+1420 53 55
+1417 37 19 18
+1414 53 55 18
+1407 2 15 1
+1386 1 25
+1380 1 53
+1369 21 18 19
+1363 3 3 2
+1352 55 18 29
+1348 38 27
+1346 12 21 21
+1343 21 3 36
+1336 15 31
+1336 2 21 21
+1328 18 38
+1316 21 18 12
+1309 1 53 55
+1308 2 1 53
+1308 18 12 21
+1297 2 11
+1297 19 18 18
+1280 18 3 3
+1276 21 26
+1242 21 10
+1217 21 21 10
+1215 18 15 1
+1205 18 3 1
+1201 15 18
+1201 18 11 11
+1197 21 10 21
+1187 3 18 21
+1178 19 34
+1153 15 32
+1139 15 1 21
+1135 18 19 1
+1135 19 1 21
+1132 21 11
+1125 18 42
+1109 15 1 1
+1106 18 1 35
+1095 21 1 1
+1092 18 21 2
+1079 8 54
+1066 104 3
+1055 18 18 31
+1054 1 12
+1051 3 1 21
+1038 42 2
+1038 18 18 42
+1038 18 42 2
+1036 42 2 32
+1024 1 2 3
+1017 1 2 21
+1007 21 104 3
+1004 11 11 31
+1002 37 32
+994 11 37 32
+988 11 38
+987 11 11 38
+986 2 18
+986 12 1 37
+982 21 1 2
+977 21 21 36
+975 18 1 18
+965 104 3 36
+959 11 37 18
+956 12 1 31
+947 15 38
+945 12 11
+945 1 12 11
+945 1 18 11
+945 12 11 37
+945 18 1 12
+944 11 26
+944 15 37
+944 1 11 26
+944 21 11 37
+942 18 1 25
+941 3 3 1
+941 11 38 27
+940 15 37 1
+940 37 1 19
+933 1 1 34
+928 2 35
+928 18 36
+916 1 29
+914 19 36
+913 18 21 3
+911 1 3 21
+904 21 1 29
+881 21 37 19
+863 2 30
+839 3 30
+834 1 1 26
+834 1 1 37
+832 18 37 15
+829 21 38
+827 19 35
+823 21 19 36
+818 21 15
+810 18 18 25
+807 1 1 36
+799 8 1
+796 2 1 21
+785 37 44
+783 3 21 1
+782 37 36
+782 37 3 21
+781 38 4
+780 2 12
+779 38 6
+777 2 2 12
+777 2 12 1
+776 1 21 19
+770 15 19 34
+768 1 37 26
+753 3 11
+753 21 37 3
+751 11 3 32
+745 45 32
+733 21 21 38
+731 2 11 11
+731 18 2 11
+728 1 1 1
+716 38 21
+685 38 21 21
+682 21 3 1
+679 1 38 21
+678 11 32
+676 18 2 1
+670 19 21
+666 12 37
+638 15 19 18
+637 12 37 1
+633 2 3 31
+631 44 44
+629 1 45
+629 44 25
+629 45 37
+629 1 45 37
+629 18 1 45
+629 37 44 44
+629 44 44 25
+629 45 37 44
+628 1 18 31
+622 3 18 3
+620 37 1 18
+604 19 18 31
+595 4 37
+591 3 18 18
+587 37 15 1
+578 53 54
+570 12 1 2
+566 18 18 8
+565 1 2 18
+561 2 18 1
+559 2 37
+559 8 54 18
+558 1 21 26
+558 15 38 31
+547 37 104
+547 21 3 21
+545 10 21 37
+544 21 15 18
+540 18 21 15
+539 18 4 37
+537 38 28
+534 38 29
+526 2 38
+526 1 1 19
+522 15 11
+520 2 38 28
+519 2 37 15
+518 11 104
+518 11 1 37
+517 104 26
+514 3 20
+514 20 36
+514 104 34
+514 3 20 36
+514 11 104 34
+514 15 18 8
+514 18 8 54
+514 18 11 104
+514 54 18 11
+513 21 2 38
+512 15 8
+512 15 45
+512 54 104
+512 8 54 104
+512 15 2 37
+512 15 8 54
+512 15 18 21
+512 15 45 32
+512 18 15 2
+512 18 18 36
+512 21 3 20
+512 37 15 45
+512 54 104 26
+510 21 1 3
+510 53 54 18
+504 104 21
+502 37 15 11
+498 15 11 31
+492 15 21
+488 1 46
+487 12 1 38
+486 18 18 35
+479 18 8 1
+476 37 18 18
+473 8 1 21
+473 37 21 35
+470 104 21 21
+465 21 104 21
+463 18 10
+463 44 21
+454 38 12
+454 18 18 2
+453 3 1 34
+449 3 21 3
+447 4 3
+446 15 3
+445 38 35
+442 3 3 34
+441 18 21 37
+437 46 1
+437 3 3 29
+437 46 1 21
+436 9 1
+436 12 9
+436 12 9 1
+433 3 1 18
+429 3 1 36
+423 3 53
+423 11 29
+423 18 3 53
+419 3 3 30
+418 3 53 54
+416 19 3
+416 21 18 3
+414 18 18 37
+410 18 3 37
+409 3 3 35
+407 18 18 38
+407 21 2 1
+403 2 3 30
+401 4 13
+401 13 37
+401 3 21 37
+401 4 13 37
+399 19 19 34
+398 38 30
+398 1 11 29
+397 3 28
+397 12 18
+397 18 18 29
+396 37 31
+395 37 34
+394 12 18 18
+394 13 37 34
+394 38 4 13
+393 37 3 34
+392 21 2 29
+391 6 18
+391 1 18 36
+391 15 19 35
+391 21 19 1
+390 15 3 18
+390 21 21 35
+389 6 34
+389 1 18 38
+389 3 37 3
+389 6 18 18
+389 15 19 3
+389 18 38 6
+389 21 3 37
+389 38 6 18
+389 38 6 34
+388 104 1
+388 1 38 30
+388 2 11 31
+388 3 37 19
+388 15 2 11
+388 18 15 3
+387 15 38 6
+387 19 1 3
+386 3 9
+386 9 3
+386 1 46 1
+386 3 3 9
+386 3 9 3
+386 3 21 19
+386 3 37 36
+386 4 3 37
+386 4 37 104
+386 9 1 46
+386 9 3 28
+386 18 38 4
+386 19 3 21
+386 21 38 27
+386 37 104 1
+386 38 4 3
+386 38 12 9
+386 104 1 21
+385 18 37 36
+384 19 1 26
+384 37 19 1
+375 11 3 3
+372 1 21 35
+367 18 21 26
+365 18 19 21
+361 21 31
+360 21 1 21
+357 9 46
+349 18 37 21
+344 1 37 15
+332 1 15
+327 21 21 19
+326 15 2 31
+322 1 18 21
+321 8 11
+320 18 3 11
+316 38 38
+316 37 15 2
+315 38 44
+315 104 38
+315 38 44 21
+315 44 21 34
+315 104 38 44
+314 2 15 32
+314 15 2 30
+311 15 35
+309 11 10
+309 3 11 1
+309 3 11 32
+308 10 26
+308 8 11 10
+308 11 10 26
+302 1 27
+302 2 1 1
+300 18 1 38
+293 15 26
+293 21 1 27
+290 2 2 1
+289 21 38 38
+289 38 38 29
+286 3 21 18
+283 1 11 1
+283 2 1 36
+277 11 1 31
+273 3 2 2
+271 21 2 30
+270 1 21 36
+265 37 15 31
+263 1 9
+261 15 41
+261 18 10 21
+260 1 1 25
+258 1 3 2
+258 1 9 46
+256 41 34
+256 15 21 15
+256 15 41 34
+256 21 15 41
+247 9 104
+245 19 21 36
+245 37 21 18
+241 46 3
+241 3 18 15
+241 9 46 3
+241 12 1 9
+241 18 38 29
+241 46 3 18
+234 104 29
+234 1 15 21
+234 9 104 29
+234 15 21 18
+234 18 1 15
+234 19 21 26
+231 55 3
+231 55 3 18
+230 18 1 3
+227 21 19 21
+225 21 21 31
+224 18 2 21
+217 2 55
+217 2 55 3
+216 21 53
+215 21 28
+214 53 18
+214 2 18 18
+210 3 18 11
+210 21 21 28
+208 21 2 21
+207 2 19
+203 10 37
+203 10 37 21
+202 18 10 37
+199 1 3 36
+197 15 25
+196 3 10
+196 3 55
+196 53 18 18
+195 3 10 21
+195 10 21 36
+195 18 3 10
+195 37 18 3
+193 11 27
+193 21 55
+193 55 31
+193 3 3 55
+193 3 55 31
+193 18 21 55
+193 21 21 53
+193 21 53 18
+193 21 55 18
+193 55 18 21
+188 38 1
+187 21 12
+187 1 21 2
+183 1 1 2
+181 1 3 1
+181 21 21 11
+176 8 1 35
+169 11 21
+168 37 15 37
+167 37 29
+167 18 18 12
+160 38 1 34
+159 2 27
+158 38 9
+154 11 36
+154 1 2 11
+154 2 11 36
+153 42 37
+153 45 1
+151 15 1 26
+150 21 1 31
+148 38 18
+148 18 11 32
+145 18 21 1
+140 15 18 18
+136 2 1 34
+135 37 37
+135 19 18 21
+133 2 3 2
+132 12 12
+131 19 2
+129 1 18 18
+129 54 18 37
+129 54 18 54
+128 19 2 34
+126 4 37 44
+126 12 1 21
+126 37 44 21
+126 44 21 1
+125 18 53
+125 19 21 21
+124 19 31
+123 4 45
+123 4 45 1
+123 45 1 25
+121 3 3 31
+119 2 36
+119 21 18 1
+118 21 12 1
+113 38 2
+112 8 37
+112 3 1 31
+109 3 3 18
+109 11 21 21
+108 104 44
+108 18 18 53
+106 21 4
+101 104 3 3
+100 3 38
+100 1 38 9
+99 19 54
+99 38 9 46
+98 3 8
+98 2 3 36
+98 3 2 27
+98 3 8 3
+98 3 11 21
+98 8 3 11
+98 8 37 29
+98 18 8 37
+98 21 3 8
+98 54 18 18
+97 18 30
+96 18 6
+95 1 11 32
+94 12 21 1
+94 18 18 6
+94 21 3 31
+93 1 42
+93 44 45
+93 104 104
+93 44 45 25
+93 104 44 45
+93 104 104 44
+92 6 1
+92 3 18 34
+92 6 1 34
+92 18 6 1
+92 18 38 18
+92 38 18 18
+91 15 36
+90 54 25
+90 1 15 15
+90 15 15 36
+90 21 1 15
+90 21 21 26
+89 38 41
+89 104 45
+89 2 15 19
+89 15 19 36
+89 18 18 19
+89 18 53 54
+89 21 2 15
+87 1 1 30
+87 1 1 31
+87 3 1 2
+87 12 1 1
+87 18 42 37
+87 21 2 2
+87 37 104 45
+87 42 37 104
+87 104 45 25
+85 21 1 37
+84 1 3 31
+82 1 37 19
+81 3 1 1
+80 15 1 31
+80 18 18 15
+78 18 37 18
+77 12 38
+77 37 19 31
+74 37 2
+72 4 28
+71 18 27
+71 1 53 54
+70 3 25
+69 1 21 12
+69 18 21 31
+67 18 26
+66 4 8
+66 46 4
+66 1 42 37
+66 2 2 31
+66 3 38 31
+66 18 1 42
+66 37 37 104
+66 37 104 104
+66 42 37 37
+65 21 46
+65 46 4 8
+64 21 29
+64 54 35
+64 19 21 18
+64 21 3 25
+64 37 2 19
+63 18 4 28
+62 37 11
+62 21 1 36
+60 21 6
+60 46 37
+60 18 1 37
+59 3 46
+59 1 21 29
+59 2 19 54
+59 3 46 37
+59 18 3 46
+59 19 54 35
+59 37 11 31
+59 46 37 2
+58 21 3 38
+57 1 37 11
+57 2 18 32
+57 18 2 31
+56 38 104
+56 54 34
+56 1 21 4
+56 1 54 34
+56 3 1 54
+56 18 37 35
+56 21 4 54
+56 21 11 3
+56 37 18 37
+56 38 104 3
+55 4 3 36
+55 18 2 3
+55 21 11 31
+54 2 25
+54 53 4
+54 12 38 18
+54 18 12 38
+54 21 2 31
+54 38 18 1
+54 55 18 25
+53 3 18 31
+53 19 18 35
+53 38 2 27
+52 12 8
+52 1 46 4
+51 11 18
+51 38 36
+51 2 21 12
+51 4 8 1
+51 8 1 46
+51 8 1 53
+51 9 46 1
+51 10 21 18
+51 12 1 18
+51 12 1 32
+51 12 8 1
+51 18 38 35
+50 18 104
+50 46 29
+50 1 1 46
+50 1 46 29
+50 9 1 1
+50 12 12 9
+50 18 2 19
+50 18 21 38
+50 21 18 31
+50 21 18 38
+50 37 18 4
+50 38 12 12
+49 6 31
+49 42 11
+49 1 19 21
+49 18 18 10
+49 42 11 37
+48 3 15
+48 4 29
+48 9 21
+48 16 1
+48 46 27
+48 46 30
+48 54 31
+48 1 12 8
+48 4 54 31
+48 9 21 21
+48 9 46 30
+48 15 3 36
+48 16 1 21
+48 18 1 19
+48 18 38 9
+48 18 38 36
+48 21 6 31
+48 21 21 6
+48 21 21 46
+48 21 46 27
+48 38 9 21
+48 53 4 54
+48 53 54 25
+47 2 18 29
+46 37 30
+46 41 38
+46 2 2 36
+46 38 41 38
+45 19 41
+45 37 8
+45 38 19
+45 41 21
+45 2 19 31
+45 3 15 32
+45 10 21 2
+45 11 11 21
+45 11 21 31
+45 18 3 35
+45 18 38 41
+45 19 41 21
+45 21 19 35
+45 37 8 54
+45 38 19 41
+45 41 21 21
+45 41 38 19
+44 10 3
+44 10 3 21
+44 21 10 3
+43 3 19
+43 11 4
+43 19 15
+43 11 4 37
+43 21 2 18
+42 18 28
+42 21 27
+42 21 32
+42 38 54
+42 41 18
+42 1 21 104
+42 1 54 25
+42 2 19 15
+42 18 37 1
+42 21 11 18
+42 21 38 41
+42 37 1 54
+42 38 41 18
+42 38 54 1
+42 41 18 19
+42 54 1 21
+41 2 26
+41 2 18 31
+41 37 3 3
+41 37 18 21
+40 2 21 2
+40 4 37 18
+40 19 54 21
+40 37 19 54
+40 54 21 34
+39 2 19 18
+39 21 3 32
+38 38 11
+38 1 2 36
+37 21 38 31
+36 38 37
+36 1 12 21
+36 1 37 37
+36 3 2 35
+36 19 15 32
+36 21 18 11
+35 55 21
+35 18 3 2
+35 37 15 32
+35 54 18 32
+34 8 46
+34 1 21 38
+34 2 2 18
+34 11 11 1
+34 18 37 3
+34 21 1 35
+33 44 37
+33 1 38 11
+33 3 2 3
+33 11 38 2
+33 18 3 38
+33 21 38 12
+33 37 37 29
+33 38 11 11
+32 44 32
+32 2 18 21
+32 2 21 36
+32 3 1 30
+32 18 18 26
+32 21 38 2
+32 21 54 18
+31 4 12
+31 1 1 4
+31 11 11 37
+31 12 12 1
+31 21 21 34
+30 37 12
+30 45 44
+30 53 1
+30 18 2 2
+30 18 18 45
+30 18 45 44
+30 37 44 32
+30 44 37 44
+30 45 44 37
+29 1 1 35
+29 8 1 1
+29 12 1 3
+28 37 38
+28 38 8
+28 1 18 3
+28 11 1 26
+28 12 12 12
+28 15 18 37
+28 21 11 32
+28 21 21 12
+28 37 18 32
+28 37 37 1
+27 12 2
+27 21 25
+27 41 1
+27 42 12
+27 104 30
+27 1 42 12
+27 3 1 25
+27 3 38 37
+27 4 37 12
+27 12 1 42
+27 12 37 37
+27 18 18 104
+27 18 21 12
+27 18 37 38
+27 18 104 30
+27 21 2 37
+27 21 21 25
+27 37 1 35
+27 37 12 1
+27 37 38 38
+27 38 2 25
+27 38 21 26
+27 38 37 21
+27 38 38 21
+27 42 12 37
+26 21 41
+26 2 3 11
+26 2 21 3
+26 21 21 41
+26 21 41 1
+26 41 1 21
+25 1 55
+25 3 11 31
+25 11 11 29
+25 11 37 21
+25 19 3 36
+25 53 1 55
+24 20 21
+24 37 4
+24 2 11 32
+24 3 2 29
+24 3 19 21
+24 18 18 11
+24 18 18 34
+24 21 12 12
+24 37 21 10
+24 55 21 21
+23 46 18
+23 1 3 35
+23 1 11 3
+23 1 21 53
+23 1 55 21
+23 2 3 1
+23 2 21 18
+23 3 21 2
+23 15 11 32
+23 18 1 36
+23 21 21 27
+23 21 53 1
+22 1 8
+22 44 2
+22 11 18 31
+22 21 3 2
+22 21 12 38
+22 21 18 2
+22 37 3 19
+22 44 2 11
+21 4 27
+21 16 4
+21 18 55
+21 21 45
+21 1 2 2
+21 2 1 35
+21 2 37 19
+21 11 3 34
+21 16 4 27
+21 18 1 32
+21 18 21 45
+21 18 53 18
+21 18 104 21
+21 21 4 29
+21 104 21 4
+20 4 31
+20 19 12
+20 37 27
+20 1 38 8
+20 8 46 18
+20 19 12 1
+20 19 18 30
+20 21 4 31
+20 21 45 1
+20 38 2 29
+20 38 8 46
+20 45 1 53
+20 46 18 21
+20 53 54 21
+20 54 21 4
+20 54 21 18
+19 55 1
+19 1 2 1
+19 3 19 12
+19 11 18 15
+19 18 15 11
+19 37 21 1
+18 3 27
+18 12 3
+18 2 21 1
+18 3 37 29
+18 12 38 1
+18 15 1 2
+18 18 37 29
+18 18 37 30
+18 53 18 55
+18 54 18 21
+17 4 11
+17 8 2
+17 8 8
+17 8 31
+17 38 3
+17 46 12
+17 46 21
+17 1 2 35
+17 1 21 46
+17 1 38 12
+17 3 37 18
+17 9 46 12
+17 21 1 12
+17 21 1 18
+17 21 46 21
+17 37 1 1
+17 38 1 9
+17 46 12 21
+17 46 21 18
+16 1 104
+16 2 104
+16 20 18
+16 2 2 3
+16 3 18 26
+16 3 18 27
+16 3 21 35
+16 4 12 12
+16 4 37 4
+16 12 2 1
+16 12 12 37
+16 21 37 18
+16 37 4 12
+16 38 3 36
+15 1 4 12
+15 4 11 11
+15 4 12 1
+15 18 18 4
+15 18 53 55
+15 18 55 18
+15 20 21 21
+15 37 18 28
+15 104 44 21
+14 18 20
+14 21 9
+14 37 55
+14 46 35
+14 104 46
+14 1 8 46
+14 1 104 44
+14 2 104 46
+14 3 2 18
+14 4 8 8
+14 8 1 104
+14 8 8 37
+14 8 37 55
+14 8 46 4
+14 12 1 8
+14 20 18 18
+14 21 9 104
+14 21 21 9
+14 37 18 8
+14 37 55 1
+14 38 12 1
+14 44 21 21
+14 55 1 31
+14 104 46 35
+13 3 12
+13 1 4 37
+13 2 2 21
+13 3 2 36
+13 8 2 29
+13 15 2 2
+13 18 2 38
+13 21 21 15
+12 4 1
+12 16 32
+12 16 104
+12 18 9
+12 37 28
+12 104 20
+12 1 12 1
+12 1 37 1
+12 1 37 2
+12 9 104 21
+12 11 21 38
+12 16 104 20
+12 18 1 2
+12 18 9 104
+12 18 11 21
+12 19 1 2
+12 21 1 34
+12 21 21 32
+12 37 21 3
+12 38 2 32
+12 104 20 18
+12 104 21 35
+11 21 20
+11 92 92
+11 94 94
+11 2 1 2
+11 2 18 3
+11 3 12 21
+11 3 18 2
+11 4 1 35
+11 11 2 29
+11 18 2 32
+11 18 4 1
+11 18 21 32
+11 21 3 12
+11 21 21 20
+10 6 21
+10 9 28
+10 11 45
+10 17 18
+10 44 11
+10 1 1 11
+10 1 2 30
+10 1 12 3
+10 1 37 36
+10 2 2 32
+10 3 1 37
+10 6 21 18
+10 11 11 45
+10 11 45 1
+10 12 3 3
+10 18 38 28
+10 21 3 35
+10 21 6 21
+10 21 12 21
+10 37 1 21
+10 38 9 28
+10 44 11 32
+10 45 1 32
+10 92 92 92
+10 94 94 94
+9 2 88
+9 21 8
+9 1 11 2
+9 2 1 18
+9 2 3 21
+9 2 18 26
+9 2 18 37
+9 3 2 21
+9 3 18 37
+9 12 1 35
+9 12 1 36
+9 15 1 37
+9 18 15 18
+9 21 2 88
+9 21 3 34
+9 21 15 2
+8 2 54
+8 4 4
+8 4 15
+8 4 35
+8 11 19
+8 54 30
+8 54 54
+8 104 11
+8 1 4 29
+8 1 11 21
+8 1 21 8
+8 1 37 4
+8 1 37 21
+8 2 1 30
+8 2 2 19
+8 2 2 35
+8 3 1 4
+8 3 2 31
+8 3 3 38
+8 3 21 31
+8 8 54 54
+8 11 19 3
+8 12 1 12
+8 15 2 3
+8 17 18 15
+8 18 2 26
+8 18 2 36
+8 18 18 20
+8 18 18 32
+8 18 20 21
+8 19 18 2
+8 21 8 1
+8 21 18 53
+8 21 21 54
+8 21 38 8
+8 37 1 3
+8 37 4 15
+8 37 104 11
+8 38 8 54
+8 54 21 12
+8 54 54 30
+8 55 18 18
+8 55 18 31
+8 104 11 19
+7 2 4
+7 16 21
+7 1 11 31
+7 1 38 35
+7 1 38 37
+7 2 2 37
+7 3 1 38
+7 8 11 11
+7 11 38 28
+7 12 3 1
+7 13 37 3
+7 19 18 1
+7 21 2 19
+7 21 2 32
+7 21 12 2
+7 21 18 30
+7 21 19 18
+7 38 37 30
+7 55 18 1
+6 2 28
+6 4 32
+6 4 104
+6 8 38
+6 9 31
+6 11 30
+6 15 28
+6 17 11
+6 38 34
+6 1 21 15
+6 1 21 37
+6 2 3 28
+6 2 19 1
+6 2 37 21
+6 3 11 11
+6 3 37 15
+6 4 15 28
+6 8 11 3
+6 18 2 27
+6 18 21 19
+6 18 21 27
+6 18 21 35
+6 19 15 2
+6 20 21 6
+6 21 2 34
+6 21 11 21
+6 21 15 3
+6 21 20 21
+6 37 3 36
+6 37 18 31
+6 37 18 36
+6 37 21 2
+6 53 4 3
+6 53 55 21
+5 2 106
+5 3 54
+5 11 28
+5 18 16
+5 21 44
+5 38 32
+5 54 12
+5 104 4
+5 1 2 37
+5 1 8 1
+5 1 9 31
+5 1 15 2
+5 1 21 28
+5 1 21 44
+5 1 38 27
+5 2 4 104
+5 2 19 35
+5 2 38 9
+5 3 11 30
+5 3 37 35
+5 3 38 30
+5 3 54 35
+5 4 4 28
+5 4 104 21
+5 8 1 37
+5 11 11 28
+5 11 37 11
+5 12 38 21
+5 15 2 25
+5 15 18 3
+5 15 41 37
+5 16 21 11
+5 17 11 32
+5 18 1 8
+5 18 2 4
+5 18 3 36
+5 18 4 4
+5 18 8 11
+5 18 16 21
+5 18 37 32
+5 18 38 1
+5 18 38 30
+5 18 38 31
+5 21 1 9
+5 21 2 35
+5 21 4 11
+5 21 18 8
+5 21 37 27
+5 21 44 21
+5 21 104 26
+5 37 1 34
+5 37 2 32
+5 37 18 34
+5 37 19 26
+5 38 1 3
+5 38 1 27
+5 41 37 1
+5 44 21 37
+5 53 1 15
+5 104 4 35
+4 1 6
+4 11 25
+4 12 15
+4 12 20
+4 13 1
+4 20 1
+4 20 20
+4 37 41
+4 104 31
+4 1 18 1
+4 1 18 37
+4 2 1 3
+4 2 1 27
+4 2 1 37
+4 2 2 29
+4 2 19 34
+4 2 37 37
+4 2 54 21
+4 4 3 28
+4 11 38 29
+4 12 12 21
+4 12 15 2
+4 12 20 1
+4 15 2 32
+4 15 19 1
+4 15 37 21
+4 18 2 37
+4 18 11 18
+4 18 15 37
+4 18 18 30
+4 18 20 18
+4 18 21 36
+4 19 18 12
+4 20 1 18
+4 20 20 21
+4 21 4 3
+4 21 12 18
+4 21 21 4
+4 21 37 1
+4 37 21 31
+4 37 37 31
+3 1 28
+3 3 48
+3 6 19
+3 15 34
+3 15 104
+3 19 11
+3 20 19
+3 37 10
+3 37 106
+3 44 18
+3 48 29
+3 50 1
+3 53 3
+3 54 36
+3 104 53
+3 1 1 18
+3 1 1 29
+3 1 2 32
+3 1 4 35
+3 1 8 2
+3 1 11 25
+3 1 19 2
+3 1 21 32
+3 2 12 12
+3 2 15 31
+3 2 18 27
+3 2 19 21
+3 2 37 106
+3 2 54 36
+3 3 3 27
+3 3 18 36
+3 3 48 29
+3 3 53 3
+3 3 55 21
+3 4 4 32
+3 8 2 54
+3 8 8 38
+3 8 38 11
+3 11 21 32
+3 11 104 3
+3 12 1 29
+3 12 2 12
+3 12 2 21
+3 12 12 2
+3 12 21 3
+3 15 3 32
+3 15 104 31
+3 18 2 18
+3 18 3 32
+3 18 11 37
+3 18 15 104
+3 18 18 55
+3 18 37 10
+3 18 37 12
+3 18 54 12
+3 18 55 1
+3 18 55 21
+3 19 1 36
+3 19 3 48
+3 19 11 32
+3 21 1 8
+3 21 2 36
+3 21 2 106
+3 21 19 11
+3 21 20 19
+3 37 10 21
+3 37 11 104
+3 37 12 12
+3 37 15 3
+3 37 15 19
+3 38 11 32
+3 38 12 8
+3 44 18 20
+3 50 1 37
+3 53 3 55
+3 54 12 21
+3 55 1 18
+3 55 21 2
+3 55 21 31
+3 55 21 36
+3 104 53 4
+2 1 41
+2 1 44
+2 1 105
+2 2 50
+2 3 17
+2 3 106
+2 6 3
+2 6 6
+2 6 38
+2 11 20
+2 11 44
+2 17 1
+2 17 17
+2 17 19
+2 17 20
+2 18 44
+2 18 90
+2 20 35
+2 20 44
+2 21 58
+2 37 88
+2 38 26
+2 41 2
+2 41 3
+2 44 3
+2 44 4
+2 58 21
+2 90 34
+2 104 37
+2 1 1 6
+2 1 2 31
+2 1 3 19
+2 1 6 6
+2 1 15 1
+2 1 18 15
+2 1 18 32
+2 1 21 58
+2 1 37 41
+2 1 41 3
+2 1 44 4
+2 1 55 1
+2 1 104 45
+2 2 2 50
+2 2 3 106
+2 2 4 44
+2 2 18 36
+2 2 19 19
+2 2 37 88
+2 2 50 1
+2 3 1 15
+2 3 2 54
+2 3 3 15
+2 3 3 37
+2 3 15 26
+2 3 17 19
+2 3 37 32
+2 3 38 36
+2 3 53 1
+2 4 11 44
+2 4 15 4
+2 4 44 18
+2 4 44 32
+2 4 44 37
+2 4 44 44
+2 6 3 1
+2 6 6 18
+2 6 18 38
+2 6 19 34
+2 6 38 11
+2 8 38 32
+2 11 3 2
+2 11 11 20
+2 11 11 32
+2 11 18 1
+2 11 18 18
+2 11 18 21
+2 11 18 32
+2 11 20 44
+2 11 37 31
+2 11 38 34
+2 11 44 21
+2 12 1 34
+2 12 1 104
+2 12 1 105
+2 12 2 2
+2 12 2 3
+2 12 18 21
+2 15 1 12
+2 15 1 44
+2 15 2 1
+2 15 3 1
+2 15 3 17
+2 15 4 28
+2 15 15 18
+2 15 18 11
+2 15 38 21
+2 16 21 21
+2 17 1 18
+2 17 17 1
+2 17 18 18
+2 17 19 18
+2 17 20 35
+2 18 2 15
+2 18 2 54
+2 18 4 3
+2 18 4 44
+2 18 6 3
+2 18 6 38
+2 18 8 38
+2 18 12 2
+2 18 15 31
+2 18 18 28
+2 18 20 20
+2 18 21 6
+2 18 38 3
+2 18 90 34
+2 18 104 37
+2 19 1 1
+2 19 18 20
+2 19 21 19
+2 20 18 21
+2 20 19 21
+2 20 21 19
+2 20 44 11
+2 21 2 27
+2 21 6 19
+2 21 18 36
+2 21 19 3
+2 21 19 31
+2 21 20 20
+2 21 58 21
+2 37 1 36
+2 37 1 37
+2 37 2 18
+2 37 15 18
+2 37 21 32
+2 37 37 41
+2 37 41 2
+2 37 41 37
+2 38 11 18
+2 38 21 1
+2 38 37 18
+2 41 2 3
+2 41 3 3
+2 41 37 37
+2 42 2 4
+2 44 3 20
+2 44 4 44
+2 44 37 21
+2 44 44 3
+2 46 18 1
+2 54 12 18
+2 55 1 21
+2 55 21 18
+2 58 21 18
+2 104 37 21
+2 104 45 32
+1 1 13
+1 1 90
+1 2 45
+1 2 46
+1 3 107
+1 4 18
+1 4 21
+1 5 3
+1 6 4
+1 6 58
+1 7 11
+1 8 21
+1 8 32
+1 10 1
+1 10 2
+1 10 18
+1 10 57
+1 12 29
+1 12 36
+1 15 10
+1 16 3
+1 16 11
+1 16 18
+1 16 31
+1 18 7
+1 18 46
+1 18 58
+1 18 59
+1 18 92
+1 19 25
+1 19 27
+1 20 11
+1 21 48
+1 21 94
+1 37 6
+1 37 40
+1 40 5
+1 41 44
+1 44 31
+1 45 12
+1 48 15
+1 57 35
+1 58 3
+1 58 20
+1 59 1
+1 90 104
+1 92 1
+1 94 1
+1 104 32
+1 104 35
+1 1 1 13
+1 1 1 38
+1 1 1 53
+1 1 3 12
+1 1 3 18
+1 1 3 107
+1 1 4 3
+1 1 6 4
+1 1 6 19
+1 1 11 11
+1 1 11 30
+1 1 12 2
+1 1 12 12
+1 1 12 36
+1 1 13 1
+1 1 15 32
+1 1 18 2
+1 1 18 20
+1 1 18 29
+1 1 19 1
+1 1 19 18
+1 1 19 25
+1 1 19 36
+1 1 21 27
+1 1 21 31
+1 1 21 34
+1 1 37 30
+1 1 37 34
+1 1 38 2
+1 1 38 18
+1 1 38 41
+1 1 90 104
+1 2 1 12
+1 2 1 19
+1 2 1 28
+1 2 1 31
+1 2 1 46
+1 2 1 90
+1 2 2 11
+1 2 2 25
+1 2 2 30
+1 2 2 34
+1 2 2 54
+1 2 2 106
+1 2 3 32
+1 2 3 34
+1 2 15 3
+1 2 19 12
+1 2 19 27
+1 2 21 32
+1 2 21 34
+1 2 21 35
+1 2 37 1
+1 2 37 2
+1 2 37 36
+1 2 37 104
+1 2 38 21
+1 2 45 12
+1 2 46 18
+1 2 54 18
+1 2 104 31
+1 2 104 32
+1 3 2 32
+1 3 2 104
+1 3 3 10
+1 3 10 2
+1 3 11 2
+1 3 12 1
+1 3 12 37
+1 3 15 2
+1 3 18 12
+1 3 21 11
+1 3 21 15
+1 4 1 21
+1 4 3 3
+1 4 3 18
+1 4 8 3
+1 4 18 18
+1 4 21 31
+1 4 104 1
+1 5 3 32
+1 6 4 18
+1 6 19 1
+1 6 58 3
+1 7 11 1
+1 8 2 30
+1 8 3 3
+1 8 21 34
+1 8 38 21
+1 9 104 44
+1 10 1 35
+1 10 2 34
+1 10 18 21
+1 10 21 35
+1 10 57 35
+1 11 1 21
+1 11 1 34
+1 11 2 25
+1 11 3 31
+1 11 10 57
+1 11 11 10
+1 11 18 2
+1 11 18 26
+1 11 37 15
+1 11 37 35
+1 11 38 6
+1 11 104 21
+1 12 1 15
+1 12 1 30
+1 12 2 45
+1 12 3 2
+1 12 8 38
+1 12 18 1
+1 12 21 34
+1 12 37 6
+1 12 37 18
+1 13 1 1
+1 13 1 31
+1 13 1 36
+1 13 1 38
+1 15 1 34
+1 15 2 19
+1 15 3 2
+1 15 10 1
+1 15 11 38
+1 15 21 21
+1 15 21 31
+1 16 3 36
+1 16 11 31
+1 16 18 35
+1 17 11 11
+1 18 1 11
+1 18 1 28
+1 18 2 25
+1 18 2 30
+1 18 2 35
+1 18 2 46
+1 18 2 104
+1 18 3 25
+1 18 4 11
+1 18 7 11
+1 18 8 21
+1 18 12 8
+1 18 18 59
+1 18 18 92
+1 18 19 18
+1 18 21 10
+1 18 37 31
+1 18 38 37
+1 18 44 31
+1 18 44 35
+1 18 46 37
+1 18 58 20
+1 18 59 1
+1 18 92 92
+1 19 2 2
+1 19 2 15
+1 19 2 31
+1 19 3 3
+1 19 3 18
+1 19 15 18
+1 19 18 15
+1 19 19 1
+1 19 19 15
+1 20 11 104
+1 20 19 36
+1 20 21 32
+1 21 1 19
+1 21 1 30
+1 21 3 11
+1 21 3 15
+1 21 3 27
+1 21 8 11
+1 21 10 37
+1 21 11 11
+1 21 12 3
+1 21 12 29
+1 21 15 1
+1 21 15 32
+1 21 15 36
+1 21 18 10
+1 21 18 35
+1 21 18 37
+1 21 18 46
+1 21 21 8
+1 21 21 29
+1 21 21 94
+1 21 37 31
+1 21 38 3
+1 21 38 21
+1 21 45 31
+1 21 48 15
+1 21 94 94
+1 21 104 35
+1 37 1 2
+1 37 2 1
+1 37 2 3
+1 37 2 21
+1 37 3 1
+1 37 3 2
+1 37 3 18
+1 37 6 58
+1 37 18 44
+1 37 19 34
+1 37 21 11
+1 37 21 15
+1 37 21 37
+1 37 21 48
+1 37 37 3
+1 37 37 32
+1 37 38 4
+1 37 40 5
+1 38 1 36
+1 38 2 36
+1 38 3 28
+1 38 4 8
+1 38 6 31
+1 38 9 31
+1 38 12 38
+1 38 18 25
+1 38 18 36
+1 38 21 12
+1 38 21 31
+1 38 41 44
+1 40 5 3
+1 41 1 19
+1 41 38 12
+1 41 44 37
+1 44 21 3
+1 44 21 12
+1 44 21 35
+1 44 37 18
+1 45 12 37
+1 46 4 21
+1 46 18 18
+1 46 37 21
+1 48 15 21
+1 58 3 3
+1 58 20 11
+1 59 1 34
+1 90 104 1
+1 92 1 37
+1 92 92 1
+1 94 1 1
+1 94 94 1
+1 104 1 12
+1 104 1 32
+1 104 21 1
+# libriscv bytecode sequences: count bytecode...
+# config: RISCV_64I RISCV_EXT_COMPRESSED RISCV_EXT_VECTOR
+108994 23 23
+108889 24 24
+72439 24 24 24
+47345 4 44
+47345 15 4
+47343 15 4 44
+45013 23 1
+43415 23 23 23
+35751 3 3
+35628 11 2
+34628 2 3
+32583 1 24
+31562 44 15
+31562 4 44 15
+31562 44 15 4
+29346 54 18
+28826 1 34
+28713 23 23 1
+26295 23 1 34
+23974 24 23
+22165 23 24
+21299 1 24 24
+19968 1 35
+18798 12 1
+18764 24 23 23
+17947 2 32
+17884 18 3
+17658 24 2
+17630 3 29
+17542 3 32
+17362 24 24 2
+17277 3 34
+17254 23 23 24
+17246 44 60
+17152 3 37
+16930 23 24 23
+16844 24 2 3
+16805 2 3 29
+16531 55 23
+16246 2 3 3
+16139 15 15
+16096 3 1
+15912 3 36
+15896 11 2 3
+15887 3 3 32
+15851 1 54
+15851 1 54 18
+15851 12 1 54
+15837 37 56
+15837 56 28
+15837 37 56 28
+15834 18 3 34
+15834 54 18 3
+15833 11 2 32
+15800 60 35
+15781 4 44 60
+15781 15 15 4
+15781 44 60 35
+15740 3 37 56
+14919 1 11
+14119 1 36
+13739 23 55
+13735 23 55 23
+13416 2 31
+13014 18 60
+12960 60 21
+12912 18 60 21
+12703 23 8
+12181 8 3
+12181 60 27
+12138 55 1
+12115 54 18 60
+12082 11 54
+12082 11 55
+12082 43 11
+12082 1 11 55
+12082 3 1 11
+12082 8 3 1
+12082 11 54 18
+12082 11 55 1
+12082 23 8 3
+12082 43 11 54
+12082 55 1 36
+12082 55 23 8
+9980 24 3
+8976 3 23
+8773 1 32
+8012 2 2
+7952 23 60
+7325 23 3
+7202 21 23
+6946 64 35
+6906 23 41
+6905 23 23 60
+6905 60 21 23
+6904 41 64
+6904 60 43
+6904 21 23 41
+6904 23 41 64
+6904 23 60 43
+6904 41 64 35
+6904 60 43 11
+6801 3 3 36
+6786 1 1
+6482 23 31
+6270 24 26
+6197 3 24
+5861 1 23
+5852 3 3 3
+5826 1 3
+5584 24 24 3
+5515 2 29
+5452 15 1
+5345 23 104
+5277 104 60
+5255 24 1
+5237 60 24
+5235 104 23
+5234 64 104
+5234 64 104 23
+5234 104 60 24
+5178 1 43
+5178 21 64
+5178 1 43 11
+5178 21 64 104
+5178 23 1 43
+5178 23 104 60
+5178 60 21 64
+5178 60 24 26
+5178 104 23 104
+5095 1 37
+5029 11 31
+4631 23 23 3
+4343 3 23 1
+4168 24 3 3
+4081 1 3 3
+4048 24 37
+3942 104 1
+3937 24 36
+3886 11 2 31
+3758 23 1 24
+3755 1 31
+3717 60 2
+3711 60 2 29
+3619 1 24 23
+3522 2 2 31
+3505 18 31
+3499 1 26
+3479 23 45
+3456 67 1
+3456 67 1 37
+3452 61 104
+3452 1 23 45
+3452 61 104 1
+3452 104 1 23
+3407 1 38
+3403 23 3 23
+3339 24 24 1
+3280 24 35
+3227 3 31
+3177 37 3
+3062 37 24
+2942 55 23 31
+2936 11 3
+2903 19 19
+2838 23 24 24
+2824 3 35
+2821 15 1 11
+2819 10 24
+2774 23 35
+2769 1 24 3
+2760 1 2
+2717 3 3 24
+2693 23 25
+2662 23 15
+2571 4 1
+2501 19 19 19
+2479 23 11
+2460 3 24 36
+2394 37 15
+2386 23 12
+2348 23 4
+2318 37 23
+2302 2 1
+2280 15 19
+2276 1 4
+2235 38 31
+2227 4 37
+2220 24 24 37
+2193 24 37 24
+2154 1 1 3
+2135 19 23
+2123 23 29
+2122 3 2
+2100 11 11
+2056 23 3 3
+2050 1 4 1
+2028 11 37
+1990 37 23 1
+1966 23 2
+1955 3 23 35
+1924 37 19
+1922 19 1
+1920 11 1
+1898 37 24 24
+1884 10 24 24
+1874 18 11
+1827 2 15
+1825 37 1
+1819 55 24
+1813 24 10
+1809 37 35
+1804 1 30
+1791 24 23 24
+1790 23 1 31
+1787 11 3 1
+1786 24 24 10
+1781 45 25
+1778 3 1 3
+1770 24 10 24
+1767 23 37
+1761 18 32
+1738 1 37 3
+1737 23 1 30
+1736 2 2 15
+1736 18 3 31
+1734 24 55
+1734 24 55 24
+1733 1 37 35
+1732 18 11 31
+1728 37 3 35
+1727 45 31
+1726 1 24 55
+1726 1 38 31
+1726 11 1 1
+1726 23 45 25
+1726 23 45 31
+1726 55 24 35
+1664 23 32
+1664 24 24 23
+1611 3 24 24
+1584 4 55
+1576 15 2
+1574 11 26
+1559 1 19
+1555 19 26
+1550 1 19 26
+1547 21 1
+1536 4 1 4
+1536 4 55 23
+1536 23 4 55
+1527 2 2 2
+1521 53 4
+1506 3 2 1
+1504 24 34
+1501 23 19
+1493 2 11
+1492 23 1 1
+1483 24 19
+1471 37 18
+1467 1 24 1
+1462 11 39
+1462 39 44
+1462 56 27
+1462 60 56
+1462 1 11 39
+1462 11 39 44
+1462 39 44 60
+1462 44 60 56
+1462 60 56 27
+1456 53 4 37
+1436 23 23 55
+1419 2 15 1
+1417 37 19 23
+1415 3 1 24
+1414 24 3 23
+1406 4 37 18
+1402 1 53
+1390 18 34
+1389 54 18 34
+1375 12 24
+1370 3 3 2
+1369 24 23 19
+1359 24 3 36
+1356 24 1 26
+1352 18 29
+1352 22 54
+1352 22 54 18
+1352 37 18 29
+1346 12 24 24
+1338 38 27
+1331 1 53 4
+1324 23 38
+1316 24 23 12
+1308 2 1 53
+1308 23 12 24
+1306 19 23 23
+1264 1 11 26
+1232 1 29
+1223 24 1 29
+1215 23 15 1
+1201 15 31
+1201 15 1 1
+1177 19 34
+1151 24 11
+1139 2 24
+1139 15 32
+1139 15 1 24
+1135 19 1 24
+1135 23 19 1
+1124 23 23 31
+1117 23 1 35
+1082 38 24
+1075 8 55
+1068 24 104
+1068 24 24 104
+1062 24 3 1
+1061 60 25
+1056 38 24 24
+1051 1 38 24
+1047 2 24 24
+1044 1 2 3
+1036 23 11 11
+1033 1 12
+1029 37 32
+1020 11 11 31
+1018 11 37 32
+1013 23 12 1
+1000 23 1 23
+992 1 2 24
+992 23 24 3
+985 1 37 23
+984 12 1 37
+978 37 3 24
+977 11 37 23
+975 11 38
+974 24 1 2
+973 38 4
+970 23 1 12
+969 12 11
+969 104 3
+969 1 12 11
+969 1 23 11
+969 12 11 37
+966 24 11 37
+965 24 104 3
+965 104 3 36
+963 12 1 31
+960 11 11 38
+952 24 37 3
+947 11 38 27
+942 23 60 25
+940 15 37
+940 15 37 1
+940 37 1 19
+935 23 36
+933 24 24 36
+931 1 1 34
+928 10 24 37
+924 23 2 11
+922 2 11 11
+920 2 35
+913 15 38
+903 23 11 31
+898 3 24 19
+881 24 37 19
+866 19 36
+857 2 23
+855 37 24 35
+839 3 30
+835 24 21
+835 1 23 31
+832 23 37 15
+829 12 37
+828 12 37 1
+828 37 1 23
+827 19 35
+826 1 1 26
+825 23 3 1
+810 23 23 25
+808 3 23 24
+805 15 60
+786 37 36
+784 24 38
+780 38 6
+778 2 12
+778 2 2 12
+777 2 12 1
+773 24 19 36
+771 60 21 1
+770 15 19 34
+768 1 64
+768 64 26
+768 1 64 26
+768 21 1 64
+759 3 11
+733 11 3 32
+733 24 24 38
+726 1 3 24
+708 23 4 37
+689 15 23
+688 2 34
+674 11 32
+674 19 24
+661 2 30
+638 15 19 23
+615 1 1 19
+612 104 34
+612 2 3 31
+604 37 31
+604 19 23 31
+597 45 32
+592 23 23 15
+582 37 44
+578 53 55
+578 1 3 36
+564 60 11
+559 2 37
+558 3 23 23
+555 8 55 23
+550 12 1 4
+549 23 53
+535 38 29
+531 38 28
+527 3 3 34
+527 24 3 24
+525 15 11
+522 11 104
+521 23 23 53
+519 2 37 15
+517 20 36
+515 104 26
+514 3 20
+514 3 20 36
+514 11 104 34
+514 15 23 8
+514 23 8 55
+514 23 11 104
+514 55 23 11
+512 15 8
+512 15 45
+512 55 104
+512 1 1 24
+512 8 55 104
+512 15 2 37
+512 15 8 55
+512 15 38 28
+512 15 45 32
+512 23 15 2
+512 23 15 38
+512 23 23 36
+512 24 3 20
+512 37 15 45
+512 55 104 26
+510 53 55 23
+509 24 1 3
+507 23 53 55
+504 24 21 1
+502 37 15 11
+500 21 1 26
+498 15 11 31
+495 3 3 23
+493 23 23 35
+472 104 1 24
+460 44 24
+458 23 23 2
+451 3 24 3
+444 15 3
+443 4 3
+443 3 23 3
+441 37 104
+439 38 35
+437 3 3 29
+437 23 24 37
+436 44 44
+434 1 45
+434 44 25
+434 45 37
+434 1 45 37
+434 23 1 45
+434 23 2 1
+434 37 44 44
+434 44 44 25
+434 45 37 44
+432 23 18
+428 12 23
+426 11 29
+424 24 23 3
+423 23 23 37
+421 12 4
+418 19 3
+418 55 23 3
+417 23 1 3
+417 37 15 60
+412 1 1 36
+412 23 3 37
+411 23 10
+408 3 3 35
+406 1 2 23
+405 23 23 38
+404 2 1 24
+404 2 23 1
+404 4 1 2
+403 2 3 30
+401 3 24 37
+401 12 4 1
+401 15 38 31
+400 3 28
+400 4 13
+400 13 37
+400 3 3 30
+400 4 13 37
+400 19 19 34
+399 24 2 29
+398 38 30
+398 60 11 29
+396 58 1
+396 24 3 37
+394 37 34
+393 12 23 23
+393 13 37 34
+393 37 3 34
+393 38 4 13
+392 6 34
+392 23 23 29
+391 23 58
+391 15 19 35
+390 6 23
+390 15 3 23
+390 15 60 11
+389 60 38
+389 1 23 38
+389 3 23 36
+389 3 37 3
+389 15 19 3
+389 23 38 6
+389 24 19 1
+389 38 6 34
+388 1 24 26
+388 1 38 30
+388 2 11 31
+388 3 37 19
+388 6 23 23
+388 15 2 11
+388 19 3 24
+388 23 15 3
+388 23 58 1
+388 38 6 23
+388 58 1 38
+388 60 38 6
+387 24 9
+387 15 60 38
+387 19 1 3
+386 9 3
+386 9 35
+386 3 3 28
+386 3 37 36
+386 4 3 37
+386 4 37 104
+386 9 3 3
+386 23 38 4
+386 24 9 3
+386 24 24 9
+386 24 38 27
+386 37 104 1
+386 38 4 3
+385 23 37 36
+384 60 61
+384 19 1 26
+384 37 19 1
+381 11 3 3
+375 18 24
+372 18 1
+372 1 24 35
+367 21 24
+365 23 19 24
+359 3 1 34
+359 23 24 26
+348 38 1
+348 24 1 24
+346 1 1 1
+343 1 37 15
+341 1 25
+333 2 3 36
+332 23 37 24
+331 1 15
+327 15 2 31
+325 8 60
+325 8 60 61
+321 8 11
+319 24 24 19
+318 37 15 2
+318 38 1 34
+317 38 44
+317 104 38
+317 38 44 24
+317 44 24 34
+317 104 38 44
+316 2 15 32
+316 15 2 30
+313 15 26
+313 15 35
+313 38 38
+313 18 3 11
+311 3 11 1
+311 3 11 32
+310 10 8
+310 8 11 26
+310 10 8 11
+310 23 10 8
+306 4 23
+306 9 46
+299 24 31
+299 2 1 1
+295 4 23 23
+293 2 21
+289 24 38 38
+289 38 38 29
+287 2 2 1
+286 3 24 23
+285 1 27
+284 23 1 38
+281 21 23 23
+278 24 1 27
+274 3 2 2
+271 24 4
+268 21 1 1
+266 15 15 1
+265 2 23 23
+265 37 15 31
+263 1 9
+260 1 1 25
+259 15 41
+259 1 24 19
+258 15 21
+258 1 9 46
+256 21 15
+256 41 34
+256 60 36
+256 1 3 2
+256 1 24 36
+256 15 21 15
+256 15 41 34
+256 18 1 34
+256 21 15 41
+256 23 18 1
+255 23 2 3
+250 24 18
+248 23 3 24
+246 37 24 23
+245 19 24 36
+242 60 3
+242 4 37 23
+242 21 24 23
+241 46 3
+241 3 23 15
+241 4 1 9
+241 9 46 3
+241 23 38 29
+241 46 3 23
+236 15 24
+234 1 15 24
+234 15 24 23
+234 19 24 26
+234 23 1 15
+229 37 23 24
+225 60 4
+225 61 60
+225 60 61 60
+225 61 60 4
+219 24 18 24
+217 24 19 24
+215 2 19
+215 23 2 21
+214 1 21
+209 23 23 4
+208 24 21 23
+206 24 24 31
+205 2 21 24
+197 15 25
+194 37 15 1
+193 11 58
+193 24 53
+193 53 24
+193 58 30
+193 1 38 4
+193 3 3 37
+193 3 37 31
+193 11 58 30
+193 18 24 53
+193 23 24 18
+193 24 4 23
+193 24 53 24
+193 53 24 4
+190 24 24 35
+186 1 24 2
+183 4 35
+183 24 24 11
+180 1 46
+178 60 4 35
+177 1 1 2
+177 15 1 26
+176 4 1 38
+173 18 23
+171 24 1 31
+169 1 1 21
+168 21 26
+168 1 21 26
+168 23 23 18
+168 37 15 37
+167 24 12
+159 23 24 1
+158 38 23
+157 1 2 11
+155 11 36
+155 2 11 36
+149 9 1
+149 12 1 1
+148 37 29
+147 23 34
+147 45 60
+147 104 24
+147 23 3 31
+145 2 1 34
+142 18 11 32
+140 15 23 23
+139 60 31
+139 18 24 24
+135 19 23 24
+134 2 36
+133 18 2
+133 2 3 2
+132 11 1 31
+132 24 12 1
+132 24 24 21
+132 60 11 1
+131 2 60
+131 24 3 31
+130 11 24
+130 19 2
+130 104 104
+130 60 3 36
+129 55 23 37
+129 55 23 55
+128 19 2 34
+126 4 37 44
+126 37 44 24
+126 44 24 1
+125 3 3 31
+124 19 31
+120 23 18 24
+119 4 45
+119 4 45 60
+119 24 23 1
+119 45 60 25
+117 4 8
+117 19 24 24
+115 8 1
+115 12 1 24
+113 3 1 31
+112 8 37
+110 18 1 24
+106 1 24 12
+106 11 24 24
+103 23 104 1
+103 55 23 104
+102 4 8 1
+101 23 23 8
+100 23 30
+99 4 9
+99 19 55
+99 67 104
+99 1 4 23
+99 4 9 1
+99 23 1 4
+99 38 4 9
+98 3 8
+98 23 65
+98 65 67
+98 2 60 27
+98 3 2 60
+98 3 3 1
+98 3 8 3
+98 3 11 24
+98 3 23 34
+98 8 3 11
+98 8 37 29
+98 23 8 37
+98 23 65 67
+98 24 3 8
+98 55 23 23
+98 65 67 104
+98 67 104 60
+97 3 19
+96 1 23 23
+95 1 11 32
+94 10 21
+94 23 6
+94 23 38 23
+94 38 23 23
+93 60 23
+92 6 1
+92 6 1 34
+92 23 6 1
+92 23 23 6
+92 60 3 3
+91 15 36
+90 1 15 15
+90 15 15 36
+90 24 1 15
+90 60 23 38
+89 2 15 19
+89 15 19 36
+89 23 23 19
+89 24 2 15
+88 38 41
+87 61 23
+87 1 1 31
+87 24 24 26
+86 24 104 24
+86 60 61 23
+86 61 23 55
+86 104 24 24
+84 1 3 31
+83 24 1 37
+82 1 37 19
+82 3 1 2
+80 4 28
+80 15 1 31
+78 1 104
+78 4 12
+78 37 11
+78 3 19 24
+78 23 24 31
+78 24 3 2
+77 37 19 31
+76 3 38
+76 24 2 30
+75 37 2
+75 1 1 37
+75 23 23 12
+73 61 55
+73 60 61 55
+72 18 23 60
+72 19 24 23
+71 23 26
+71 104 44
+71 1 1 4
+71 1 53 55
+71 4 1 1
+71 23 1 37
+71 55 23 1
+70 3 25
+70 60 32
+68 1 37 11
+66 2 26
+66 23 27
+66 46 4
+66 60 30
+66 3 23 31
+66 3 38 31
+66 37 11 31
+65 12 38
+65 21 2
+65 24 46
+65 24 11 3
+65 46 4 8
+64 4 4
+64 12 12
+64 12 38 23
+64 23 12 38
+64 24 3 25
+64 37 2 19
+64 38 23 1
+61 3 60
+61 23 37 18
+60 46 37
+60 21 24 24
+59 3 46
+59 38 9
+59 55 35
+59 2 19 55
+59 3 46 37
+59 19 55 35
+59 23 3 46
+59 24 2 24
+59 24 2 31
+59 46 37 2
+58 4 29
+58 18 60 30
+58 24 1 1
+58 24 3 38
+58 24 21 24
+57 16 1
+57 21 3
+57 1 3 23
+57 16 1 24
+57 23 4 1
+56 24 29
+56 37 64
+56 38 2
+56 1 37 64
+56 1 104 34
+56 2 1 32
+56 2 23 32
+56 3 1 104
+56 3 2 23
+56 24 23 31
+56 37 64 104
+56 55 1 3
+56 60 24 3
+56 61 55 1
+56 104 23 35
+55 38 36
+55 42 37
+55 4 3 36
+55 18 2 31
+55 18 23 23
+54 18 25
+54 37 18 25
+53 21 31
+53 19 23 35
+53 24 1 35
+52 1 46 4
+52 23 38 35
+51 2 25
+51 24 15
+51 46 1
+51 58 24
+51 104 29
+51 1 46 1
+51 3 2 31
+51 8 1 46
+51 8 1 53
+51 9 1 46
+51 12 1 32
+51 46 1 24
+51 104 104 29
+50 12 9
+50 18 26
+50 46 29
+50 1 1 46
+50 1 46 29
+50 2 2 36
+50 4 12 9
+50 9 1 1
+50 12 9 1
+50 23 2 19
+50 23 23 10
+50 23 24 38
+50 24 11 31
+50 38 4 12
+49 1 42
+49 42 11
+49 44 45
+49 2 23 29
+49 23 37 23
+49 42 11 37
+49 104 44 45
+49 104 104 44
+48 19 67
+48 46 27
+48 46 30
+48 55 25
+48 55 31
+48 67 36
+48 1 4 8
+48 1 24 29
+48 2 19 23
+48 3 60 3
+48 4 55 31
+48 9 1 24
+48 9 46 30
+48 10 21 23
+48 15 3 36
+48 19 67 36
+48 23 3 19
+48 23 38 9
+48 23 38 36
+48 24 1 36
+48 24 3 60
+48 24 19 67
+48 24 24 46
+48 24 46 27
+48 38 9 46
+48 53 4 55
+48 53 55 25
+48 58 24 1
+48 60 21 24
+47 3 15
+47 3 1 23
+46 3 1 36
+45 11 21
+45 19 41
+45 38 19
+45 41 24
+45 41 38
+45 2 19 31
+45 3 15 32
+45 10 21 2
+45 11 11 21
+45 11 21 31
+45 19 41 24
+45 21 2 2
+45 23 3 35
+45 23 10 21
+45 23 38 41
+45 24 19 35
+45 24 23 38
+45 38 19 41
+45 38 41 38
+45 41 24 24
+45 41 38 19
+45 55 24 34
+44 21 36
+44 46 12
+44 1 2 2
+44 11 1 26
+44 18 2 3
+43 11 23
+43 19 15
+43 37 30
+42 1 18
+42 2 27
+42 3 104
+42 4 24
+42 37 37
+42 41 23
+42 1 3 1
+42 2 19 15
+42 3 3 104
+42 3 104 34
+42 24 23 11
+42 24 38 41
+42 38 41 23
+42 41 23 19
+42 104 60 3
+41 10 3
+41 37 8
+41 37 8 55
+41 38 4 1
+40 23 28
+40 24 32
+40 65 2
+40 1 2 36
+40 2 23 31
+40 10 3 24
+40 19 55 24
+40 23 4 28
+40 24 2 23
+40 24 10 3
+40 24 11 23
+40 37 19 55
+39 2 3 1
+39 23 53 4
+38 21 55
+38 1 4 24
+38 37 3 3
+38 60 21 55
+37 1 23 24
+37 4 24 1
+37 23 3 2
+37 24 38 31
+36 8 2
+36 3 2 35
+36 19 15 32
+36 23 60 21
+36 24 3 32
+35 104 45
+35 1 12 24
+35 2 1 36
+35 3 2 3
+35 12 1 2
+35 38 2 27
+35 55 23 32
+34 8 46
+34 60 34
+34 2 2 24
+34 2 24 36
+34 12 12 1
+34 23 1 32
+34 23 23 34
+34 23 37 3
+33 23 42
+33 1 1 30
+33 18 60 34
+33 23 42 37
+33 24 24 34
+33 37 23 23
+33 37 104 45
+33 42 37 104
+33 104 45 25
+32 3 1 30
+32 8 2 29
+32 21 55 23
+32 23 1 2
+32 23 23 26
+32 24 15 23
+32 37 1 1
+31 18 4
+31 2 60 61
+31 18 4 28
+31 23 2 2
+31 23 104 24
+31 24 4 29
+31 37 18 4
+31 104 24 4
+30 10 37
+30 18 104
+30 21 12
+30 1 1 35
+30 4 37 1
+30 10 37 24
+30 23 10 37
+30 23 104 104
+30 37 3 19
+30 37 18 32
+30 104 24 35
+30 104 104 24
+29 24 27
+29 41 1
+29 1 2 21
+29 4 4 4
+29 12 1 3
+29 60 4 37
+28 38 8
+28 2 21 12
+28 3 1 1
+28 11 11 29
+28 15 23 37
+28 23 24 15
+28 24 21 36
+28 45 60 32
+27 24 25
+27 38 104
+27 42 38
+27 1 42 38
+27 1 46 12
+27 2 21 3
+27 4 1 42
+27 4 1 46
+27 4 37 24
+27 11 37 24
+27 12 23 4
+27 15 60 32
+27 24 1 23
+27 38 104 104
+27 42 38 104
+27 44 45 32
+27 46 12 23
+26 24 41
+26 65 37
+26 1 4 4
+26 1 18 24
+26 2 3 11
+26 24 2 37
+26 24 11 32
+26 24 24 12
+26 24 24 41
+26 24 41 1
+26 37 24 10
+25 18 18
+25 37 38
+25 44 37
+25 1 23 1
+25 3 11 31
+25 3 23 11
+25 3 37 23
+25 11 11 37
+25 12 1 23
+25 18 24 18
+25 19 3 36
+25 23 10 24
+24 16 32
+24 37 21
+24 60 65
+24 104 30
+24 2 11 32
+24 3 1 25
+24 4 1 23
+24 15 1 2
+24 18 18 104
+24 18 104 30
+24 21 24 35
+24 23 18 18
+24 23 24 2
+24 23 37 38
+24 23 60 65
+24 37 21 24
+24 37 38 38
+24 38 24 26
+24 38 38 24
+24 60 65 37
+24 65 2 25
+24 65 37 21
+23 46 23
+23 3 2 36
+23 3 24 2
+23 3 24 21
+23 12 24 1
+23 15 11 32
+23 21 12 1
+23 23 1 53
+23 24 24 27
+23 37 24 3
+22 1 8
+22 4 11
+22 12 3
+22 13 23
+22 23 21
+22 37 4
+22 44 2
+22 44 32
+22 45 44
+22 1 21 24
+22 1 42 37
+22 13 23 23
+22 18 23 24
+22 23 1 42
+22 23 15 11
+22 23 23 45
+22 23 45 44
+22 37 23 31
+22 37 37 104
+22 37 44 32
+22 37 104 104
+22 42 37 37
+22 44 2 11
+22 44 37 44
+22 44 45 25
+22 45 44 37
+21 12 2
+21 2 1 35
+21 2 37 19
+21 3 2 29
+21 11 3 34
+21 24 2 2
+21 60 11 3
+20 3 27
+20 4 27
+20 4 31
+20 8 31
+20 16 4
+20 19 12
+20 24 28
+20 24 45
+20 45 1
+20 1 38 8
+20 4 4 37
+20 8 46 23
+20 11 23 31
+20 16 4 27
+20 19 12 1
+20 19 23 30
+20 23 1 36
+20 23 24 45
+20 24 4 31
+20 24 24 28
+20 24 38 2
+20 24 45 1
+20 38 2 29
+20 38 8 46
+20 41 1 21
+20 45 1 53
+20 46 23 24
+20 53 55 24
+20 55 24 4
+19 20 24
+19 21 19
+19 1 1 38
+19 1 23 4
+19 1 37 1
+19 3 19 12
+19 3 37 29
+19 4 1 24
+19 11 23 15
+19 21 3 1
+19 23 37 30
+19 23 60 3
+18 18 37
+18 24 60
+18 1 23 60
+18 3 24 1
+18 4 12 1
+18 18 37 24
+18 24 24 25
+18 60 3 32
+18 60 4 12
+17 4 38
+17 11 45
+17 21 27
+17 38 3
+17 46 24
+17 1 24 4
+17 1 24 46
+17 1 104 44
+17 2 24 12
+17 4 11 11
+17 4 38 1
+17 9 46 12
+17 11 1 37
+17 11 11 45
+17 11 45 60
+17 23 18 37
+17 23 37 29
+17 24 1 12
+17 24 4 38
+17 24 12 12
+17 24 46 24
+17 24 104 104
+17 38 1 9
+17 44 24 24
+17 46 12 1
+17 46 24 23
+17 61 55 23
+17 104 1 104
+17 104 44 24
+16 8 8
+16 24 65
+16 38 11
+16 60 1
+16 1 2 1
+16 3 23 26
+16 3 23 27
+16 3 24 35
+16 11 24 65
+16 12 2 1
+16 12 12 12
+16 23 11 24
+16 24 65 2
+16 38 3 36
+16 65 2 32
+15 2 46
+15 20 23
+15 1 24 21
+15 1 37 37
+15 2 2 3
+15 2 24 23
+15 23 21 23
+15 24 24 18
+15 24 37 23
+15 37 23 28
+15 55 24 23
+14 2 38
+14 46 35
+14 104 2
+14 1 8 46
+14 1 37 31
+14 1 38 11
+14 2 46 35
+14 3 2 24
+14 4 1 8
+14 4 1 37
+14 4 8 8
+14 8 8 37
+14 8 37 4
+14 8 46 4
+14 11 38 2
+14 21 24 3
+14 24 18 31
+14 37 4 1
+14 37 23 36
+14 37 37 29
+14 38 11 1
+14 104 2 46
+13 3 12
+13 18 27
+13 64 27
+13 1 21 36
+13 1 37 36
+13 2 21 23
+13 15 2 2
+13 20 23 23
+13 21 3 24
+13 23 2 38
+13 23 60 32
+13 24 24 15
+12 21 21
+12 23 20
+12 24 6
+12 44 21
+12 65 27
+12 21 24 1
+12 24 21 3
+12 24 23 2
+11 3 18
+11 16 104
+11 37 28
+11 92 92
+11 94 94
+11 104 20
+11 1 2 35
+11 1 12 1
+11 1 21 3
+11 2 2 23
+11 2 21 2
+11 3 1 4
+11 3 1 37
+11 3 12 24
+11 4 1 35
+11 4 23 37
+11 11 2 29
+11 16 104 20
+11 19 1 2
+11 20 24 24
+11 23 2 24
+11 23 2 32
+11 23 23 11
+11 23 24 32
+11 24 3 12
+11 24 24 32
+11 53 4 23
+11 104 20 23
+10 6 21
+10 9 28
+10 11 12
+10 18 10
+10 22 3
+10 1 2 30
+10 1 12 3
+10 1 23 3
+10 1 37 24
+10 2 1 2
+10 2 2 32
+10 4 12 4
+10 6 21 23
+10 11 12 4
+10 12 1 21
+10 12 3 3
+10 12 4 12
+10 12 4 37
+10 22 3 3
+10 23 3 11
+10 24 1 34
+10 24 6 21
+10 24 12 24
+10 38 9 28
+10 55 23 24
+10 92 92 92
+10 94 94 94
+9 17 11
+9 17 23
+9 21 35
+9 24 8
+9 24 20
+9 58 20
+9 1 2 37
+9 1 18 23
+9 1 37 2
+9 2 23 26
+9 2 23 37
+9 3 23 37
+9 12 1 35
+9 12 1 36
+9 18 24 23
+9 21 24 2
+9 23 3 38
+9 23 15 23
+9 24 15 2
+9 24 23 30
+9 24 24 20
+9 37 15 32
+9 60 1 26
+8 2 55
+8 2 88
+8 2 104
+8 2 106
+8 3 10
+8 4 15
+8 4 32
+8 10 58
+8 11 19
+8 20 28
+8 21 11
+8 21 32
+8 38 37
+8 55 30
+8 55 55
+8 104 37
+8 1 1 11
+8 1 4 29
+8 1 11 24
+8 1 24 8
+8 1 37 4
+8 2 2 19
+8 2 2 35
+8 2 3 24
+8 2 3 60
+8 2 23 3
+8 2 23 21
+8 2 24 60
+8 2 38 28
+8 3 3 38
+8 3 10 24
+8 3 18 2
+8 3 23 2
+8 3 24 31
+8 3 60 11
+8 8 1 24
+8 8 55 55
+8 10 58 20
+8 11 19 3
+8 15 2 3
+8 17 11 32
+8 17 23 15
+8 18 2 24
+8 18 2 26
+8 18 10 58
+8 18 24 3
+8 19 23 2
+8 21 3 3
+8 21 19 24
+8 23 2 36
+8 23 3 10
+8 23 20 24
+8 23 23 20
+8 23 23 32
+8 23 24 21
+8 23 24 25
+8 24 2 35
+8 24 2 88
+8 24 3 34
+8 24 3 35
+8 24 8 1
+8 24 21 19
+8 24 23 53
+8 24 24 55
+8 24 38 8
+8 24 60 30
+8 37 1 3
+8 37 4 15
+8 37 11 19
+8 38 8 55
+8 54 18 24
+8 55 24 12
+8 55 55 30
+8 58 20 28
+8 104 37 11
+7 2 18
+7 2 28
+7 9 31
+7 21 60
+7 24 58
+7 104 18
+7 1 24 15
+7 1 38 37
+7 3 1 38
+7 3 11 11
+7 12 3 1
+7 13 37 3
+7 18 23 11
+7 23 60 1
+7 24 2 19
+7 24 21 2
+7 24 23 21
+7 37 1 24
+7 37 1 37
+7 37 3 36
+7 38 37 30
+7 60 1 21
+7 60 11 2
+6 1 65
+6 11 30
+6 15 28
+6 18 45
+6 20 20
+6 60 29
+6 64 21
+6 65 28
+6 65 35
+6 1 24 18
+6 1 24 60
+6 1 65 35
+6 2 2 37
+6 2 3 28
+6 2 19 1
+6 3 37 15
+6 4 15 28
+6 8 11 3
+6 11 38 28
+6 12 12 24
+6 18 2 27
+6 18 2 104
+6 18 23 32
+6 18 45 60
+6 18 104 18
+6 19 15 2
+6 20 24 6
+6 21 3 2
+6 21 12 12
+6 21 23 24
+6 23 3 36
+6 23 11 32
+6 23 18 23
+6 23 24 27
+6 23 37 32
+6 23 60 31
+6 24 2 106
+6 24 15 3
+6 24 21 21
+6 24 60 21
+6 37 23 32
+6 41 1 24
+6 53 4 3
+6 60 21 32
+6 104 18 45
+5 2 8
+5 2 44
+5 3 22
+5 3 54
+5 16 21
+5 18 16
+5 18 38
+5 18 64
+5 18 65
+5 19 18
+5 21 28
+5 37 27
+5 38 32
+5 44 11
+5 53 1
+5 54 35
+5 55 12
+5 58 38
+5 60 37
+5 104 4
+5 1 8 1
+5 1 9 31
+5 1 11 31
+5 1 12 12
+5 1 15 2
+5 1 18 64
+5 1 24 37
+5 1 38 27
+5 2 8 11
+5 2 19 35
+5 2 24 1
+5 2 24 21
+5 2 37 32
+5 2 37 37
+5 2 38 9
+5 2 44 21
+5 2 104 44
+5 3 2 8
+5 3 11 30
+5 3 22 3
+5 3 37 35
+5 3 38 30
+5 3 38 36
+5 3 54 35
+5 3 60 29
+5 4 4 28
+5 4 11 3
+5 4 37 3
+5 8 1 37
+5 8 11 24
+5 11 3 28
+5 11 3 36
+5 11 24 18
+5 11 38 29
+5 12 1 12
+5 12 1 18
+5 12 23 1
+5 15 2 25
+5 15 23 3
+5 16 21 11
+5 18 2 44
+5 18 16 21
+5 18 23 45
+5 18 38 1
+5 18 60 11
+5 18 60 31
+5 18 64 21
+5 18 65 28
+5 19 18 60
+5 21 2 1
+5 21 2 21
+5 21 2 24
+5 21 3 32
+5 21 11 31
+5 21 19 18
+5 21 55 24
+5 21 60 21
+5 23 1 8
+5 23 3 60
+5 23 4 4
+5 23 8 11
+5 23 18 65
+5 23 24 35
+5 23 24 58
+5 23 38 28
+5 23 38 30
+5 23 38 31
+5 23 45 60
+5 24 1 9
+5 24 2 32
+5 24 4 11
+5 24 18 2
+5 24 18 38
+5 24 18 60
+5 24 20 24
+5 24 23 8
+5 24 37 27
+5 24 58 38
+5 37 19 26
+5 37 23 34
+5 37 37 31
+5 38 1 3
+5 38 1 27
+5 44 11 32
+5 44 21 24
+5 44 21 60
+5 53 1 15
+5 55 24 18
+5 58 38 24
+5 60 11 31
+5 60 21 19
+5 60 21 28
+5 64 21 3
+5 104 4 35
+5 104 44 21
+4 1 6
+4 8 38
+4 12 15
+4 12 20
+4 13 1
+4 16 3
+4 18 28
+4 20 1
+4 37 10
+4 58 3
+4 61 44
+4 65 34
+4 104 31
+4 104 53
+4 1 4 37
+4 1 23 36
+4 2 1 37
+4 2 2 18
+4 2 2 29
+4 2 3 32
+4 2 18 60
+4 2 19 34
+4 2 21 1
+4 2 55 24
+4 4 4 32
+4 4 37 2
+4 10 24 23
+4 11 3 31
+4 11 104 3
+4 12 12 2
+4 12 15 2
+4 12 20 1
+4 15 1 37
+4 15 2 32
+4 19 23 12
+4 19 24 21
+4 20 1 23
+4 20 20 20
+4 21 1 2
+4 21 23 1
+4 21 23 21
+4 23 3 34
+4 23 20 23
+4 23 21 19
+4 23 23 30
+4 23 24 12
+4 23 24 36
+4 23 37 10
+4 24 2 21
+4 24 12 23
+4 37 2 3
+4 37 10 24
+4 37 11 104
+4 37 24 2
+4 38 4 8
+4 104 3 3
+4 104 53 4
+3 1 58
+3 2 65
+3 3 4
+3 3 48
+3 4 2
+3 6 19
+3 10 23
+3 15 34
+3 16 35
+3 17 30
+3 18 21
+3 18 61
+3 19 11
+3 19 25
+3 20 19
+3 20 21
+3 37 12
+3 37 88
+3 37 106
+3 38 34
+3 41 37
+3 48 29
+3 50 1
+3 53 23
+3 55 36
+3 58 37
+3 64 24
+3 1 1 12
+3 1 1 23
+3 1 8 2
+3 1 11 1
+3 1 19 25
+3 1 24 32
+3 1 104 26
+3 2 1 3
+3 2 1 4
+3 2 15 31
+3 2 19 24
+3 2 23 27
+3 2 24 2
+3 2 24 4
+3 2 37 88
+3 2 37 106
+3 2 55 36
+3 3 1 21
+3 3 3 27
+3 3 4 1
+3 3 18 1
+3 3 48 29
+3 4 1 12
+3 4 1 104
+3 4 2 2
+3 4 4 1
+3 4 4 24
+3 4 24 24
+3 8 2 55
+3 10 23 24
+3 10 24 36
+3 11 24 32
+3 11 104 31
+3 12 3 4
+3 12 12 3
+3 12 24 3
+3 12 24 12
+3 15 11 104
+3 15 19 1
+3 15 41 37
+3 16 3 3
+3 18 1 2
+3 18 1 36
+3 19 1 36
+3 19 3 48
+3 19 11 32
+3 21 1 24
+3 21 1 34
+3 21 2 32
+3 21 3 36
+3 21 11 3
+3 21 21 11
+3 21 21 36
+3 21 24 21
+3 23 2 23
+3 23 3 32
+3 23 11 37
+3 23 23 58
+3 23 37 12
+3 23 38 1
+3 23 53 23
+3 23 55 12
+3 23 58 37
+3 24 1 8
+3 24 2 36
+3 24 4 2
+3 24 11 24
+3 24 12 2
+3 24 19 11
+3 24 20 19
+3 24 23 26
+3 24 24 29
+3 37 1 34
+3 37 2 18
+3 37 12 12
+3 37 15 19
+3 37 23 3
+3 37 24 31
+3 38 1 35
+3 41 37 1
+3 44 60 1
+3 50 1 37
+3 53 23 23
+3 55 12 24
+3 58 1 4
+3 58 1 29
+3 58 3 18
+3 58 37 24
+3 60 2 32
+3 60 23 23
+3 60 24 24
+2 1 28
+2 1 41
+2 1 44
+2 1 60
+2 1 105
+2 2 4
+2 2 50
+2 3 17
+2 3 106
+2 6 3
+2 6 6
+2 11 20
+2 11 44
+2 15 64
+2 16 24
+2 17 17
+2 17 18
+2 17 19
+2 17 20
+2 18 44
+2 19 21
+2 20 35
+2 20 44
+2 21 18
+2 21 34
+2 23 44
+2 23 90
+2 24 67
+2 41 3
+2 44 1
+2 44 3
+2 44 20
+2 44 61
+2 52 62
+2 58 21
+2 60 60
+2 61 11
+2 62 11
+2 90 34
+2 1 1 6
+2 1 1 32
+2 1 2 31
+2 1 4 44
+2 1 6 6
+2 1 18 1
+2 1 19 2
+2 1 23 2
+2 1 24 58
+2 1 41 3
+2 1 44 61
+2 1 58 24
+2 1 104 45
+2 2 1 21
+2 2 1 23
+2 2 1 27
+2 2 2 50
+2 2 2 60
+2 2 3 106
+2 2 4 1
+2 2 11 3
+2 2 11 37
+2 2 19 19
+2 2 21 19
+2 2 23 15
+2 2 23 24
+2 2 23 36
+2 2 50 1
+2 2 65 37
+2 3 2 55
+2 3 11 2
+2 3 17 19
+2 4 3 28
+2 4 15 4
+2 4 44 37
+2 6 3 1
+2 6 6 23
+2 6 19 34
+2 6 23 38
+2 8 8 38
+2 8 38 11
+2 8 38 32
+2 11 11 20
+2 11 11 32
+2 11 20 44
+2 11 37 11
+2 11 37 31
+2 11 38 34
+2 11 44 21
+2 12 1 104
+2 12 1 105
+2 12 2 2
+2 12 2 3
+2 12 23 24
+2 15 1 4
+2 15 1 44
+2 15 2 1
+2 15 3 17
+2 15 3 32
+2 15 4 28
+2 15 15 23
+2 15 21 31
+2 15 23 2
+2 15 64 24
+2 16 24 24
+2 17 17 18
+2 17 18 23
+2 17 19 23
+2 17 20 35
+2 18 10 21
+2 18 23 41
+2 18 61 44
+2 19 1 1
+2 19 21 21
+2 19 23 1
+2 19 23 20
+2 19 24 19
+2 20 19 24
+2 20 20 21
+2 20 21 21
+2 20 23 24
+2 20 24 19
+2 20 44 11
+2 21 3 35
+2 21 19 1
+2 21 19 3
+2 21 19 36
+2 21 21 1
+2 21 21 23
+2 21 21 24
+2 21 23 31
+2 21 60 2
+2 23 2 15
+2 23 2 31
+2 23 2 55
+2 23 4 23
+2 23 6 3
+2 23 8 38
+2 23 15 31
+2 23 15 64
+2 23 18 28
+2 23 18 61
+2 23 23 44
+2 23 24 6
+2 23 24 19
+2 23 24 60
+2 23 38 3
+2 23 41 1
+2 23 44 1
+2 23 90 34
+2 24 2 1
+2 24 2 4
+2 24 4 3
+2 24 6 19
+2 24 10 23
+2 24 19 3
+2 24 19 21
+2 24 19 23
+2 24 19 31
+2 24 21 60
+2 24 23 36
+2 24 24 4
+2 24 58 21
+2 24 60 24
+2 24 60 37
+2 24 67 1
+2 37 2 23
+2 37 15 3
+2 37 15 21
+2 37 15 23
+2 37 18 24
+2 37 24 1
+2 38 11 32
+2 41 1 34
+2 41 3 3
+2 44 1 34
+2 44 3 20
+2 44 20 20
+2 44 37 24
+2 44 44 3
+2 44 61 44
+2 46 23 23
+2 52 62 11
+2 55 12 23
+2 58 24 24
+2 60 2 1
+2 60 37 15
+2 60 37 24
+2 61 11 44
+2 61 44 20
+2 61 44 44
+2 62 11 11
+2 64 24 31
+2 65 37 15
+2 104 45 32
+1 1 13
+1 1 55
+1 1 90
+1 2 45
+1 3 21
+1 4 58
+1 4 104
+1 6 4
+1 6 31
+1 6 58
+1 6 61
+1 7 11
+1 8 21
+1 10 57
+1 10 64
+1 11 10
+1 11 25
+1 12 29
+1 12 36
+1 16 11
+1 16 23
+1 16 31
+1 18 12
+1 18 58
+1 20 11
+1 21 45
+1 23 7
+1 23 46
+1 23 59
+1 23 62
+1 23 92
+1 24 48
+1 24 94
+1 37 17
+1 38 60
+1 41 44
+1 44 23
+1 44 31
+1 44 35
+1 45 12
+1 48 15
+1 55 2
+1 55 32
+1 57 35
+1 58 4
+1 59 1
+1 62 32
+1 64 37
+1 65 21
+1 65 23
+1 65 26
+1 65 31
+1 90 104
+1 92 1
+1 94 1
+1 104 21
+1 104 32
+1 104 64
+1 1 1 13
+1 1 3 12
+1 1 3 35
+1 1 4 3
+1 1 6 4
+1 1 6 19
+1 1 12 2
+1 1 12 23
+1 1 12 36
+1 1 13 1
+1 1 15 1
+1 1 15 32
+1 1 19 1
+1 1 19 23
+1 1 19 24
+1 1 19 36
+1 1 23 20
+1 1 23 29
+1 1 23 30
+1 1 23 32
+1 1 23 37
+1 1 24 34
+1 1 24 38
+1 1 37 30
+1 1 37 34
+1 1 38 2
+1 1 38 9
+1 1 38 36
+1 1 55 23
+1 1 58 4
+1 1 60 3
+1 1 60 60
+1 1 90 104
+1 2 1 6
+1 2 1 12
+1 2 1 19
+1 2 1 28
+1 2 1 31
+1 2 1 46
+1 2 1 60
+1 2 1 90
+1 2 2 11
+1 2 2 25
+1 2 2 26
+1 2 2 30
+1 2 2 34
+1 2 2 55
+1 2 2 104
+1 2 2 106
+1 2 3 21
+1 2 3 23
+1 2 3 34
+1 2 12 23
+1 2 18 23
+1 2 18 31
+1 2 18 32
+1 2 19 12
+1 2 21 21
+1 2 21 34
+1 2 21 35
+1 2 24 32
+1 2 24 34
+1 2 37 2
+1 2 37 24
+1 2 37 36
+1 2 38 24
+1 2 45 12
+1 2 46 23
+1 2 55 23
+1 2 60 3
+1 2 60 36
+1 2 65 21
+1 2 104 31
+1 2 104 32
+1 2 104 37
+1 3 1 15
+1 3 1 60
+1 3 2 32
+1 3 3 11
+1 3 3 15
+1 3 12 1
+1 3 12 37
+1 3 15 2
+1 3 15 26
+1 3 21 21
+1 3 23 53
+1 3 24 11
+1 3 24 15
+1 3 37 18
+1 4 1 58
+1 4 8 3
+1 4 24 12
+1 4 24 31
+1 4 37 17
+1 4 58 1
+1 4 104 1
+1 6 4 23
+1 6 19 1
+1 6 58 3
+1 6 61 23
+1 7 11 1
+1 8 2 38
+1 8 3 3
+1 8 21 34
+1 10 3 3
+1 10 21 35
+1 10 57 35
+1 10 64 21
+1 11 1 34
+1 11 2 25
+1 11 2 34
+1 11 10 57
+1 11 11 10
+1 11 23 2
+1 11 23 23
+1 11 23 26
+1 11 23 32
+1 11 37 15
+1 11 37 35
+1 11 38 6
+1 11 104 21
+1 12 1 15
+1 12 1 30
+1 12 1 34
+1 12 1 55
+1 12 2 45
+1 12 3 2
+1 12 3 36
+1 12 12 23
+1 12 23 36
+1 12 37 23
+1 12 38 6
+1 13 1 1
+1 13 1 31
+1 13 1 36
+1 13 1 38
+1 15 1 12
+1 15 1 34
+1 15 2 19
+1 15 3 1
+1 15 3 2
+1 15 11 38
+1 15 24 31
+1 15 24 32
+1 15 60 24
+1 16 3 36
+1 16 11 31
+1 16 23 35
+1 17 11 11
+1 17 23 23
+1 18 2 2
+1 18 3 25
+1 18 12 2
+1 18 18 2
+1 18 21 2
+1 18 21 35
+1 18 21 45
+1 18 23 2
+1 18 23 3
+1 18 23 28
+1 18 23 59
+1 18 24 10
+1 18 44 31
+1 18 44 35
+1 18 58 20
+1 18 60 27
+1 18 61 11
+1 19 2 2
+1 19 2 31
+1 19 3 3
+1 19 3 23
+1 19 15 23
+1 19 19 1
+1 19 19 15
+1 19 23 15
+1 20 11 104
+1 20 19 36
+1 20 21 32
+1 21 1 3
+1 21 2 27
+1 21 2 65
+1 21 3 11
+1 21 12 29
+1 21 18 1
+1 21 18 60
+1 21 23 37
+1 21 24 25
+1 21 24 36
+1 21 24 37
+1 21 45 31
+1 21 55 2
+1 23 1 11
+1 23 2 25
+1 23 2 30
+1 23 2 37
+1 23 2 46
+1 23 2 104
+1 23 7 11
+1 23 8 2
+1 23 8 21
+1 23 10 3
+1 23 11 23
+1 23 12 2
+1 23 19 23
+1 23 21 1
+1 23 21 24
+1 23 21 31
+1 23 23 92
+1 23 23 104
+1 23 37 31
+1 23 38 37
+1 23 46 37
+1 23 55 24
+1 23 59 1
+1 23 60 38
+1 23 62 32
+1 23 92 92
+1 23 104 18
+1 23 104 23
+1 23 104 64
+1 24 1 19
+1 24 1 30
+1 24 3 15
+1 24 3 27
+1 24 8 11
+1 24 9 31
+1 24 10 64
+1 24 11 11
+1 24 12 3
+1 24 15 1
+1 24 15 24
+1 24 15 32
+1 24 15 36
+1 24 18 10
+1 24 18 23
+1 24 20 21
+1 24 21 12
+1 24 21 32
+1 24 23 35
+1 24 23 46
+1 24 24 8
+1 24 24 60
+1 24 24 94
+1 24 37 18
+1 24 37 31
+1 24 38 3
+1 24 38 24
+1 24 48 15
+1 24 94 94
+1 37 2 2
+1 37 2 30
+1 37 3 2
+1 37 3 23
+1 37 3 32
+1 37 17 30
+1 37 18 11
+1 37 18 44
+1 37 19 34
+1 37 23 8
+1 37 24 11
+1 37 24 15
+1 37 24 37
+1 37 24 48
+1 37 24 60
+1 37 37 36
+1 37 38 4
+1 38 2 36
+1 38 3 28
+1 38 6 31
+1 38 6 58
+1 38 6 61
+1 38 9 31
+1 38 24 9
+1 38 24 23
+1 38 37 23
+1 38 41 44
+1 38 60 37
+1 41 1 19
+1 41 44 37
+1 44 21 3
+1 44 21 12
+1 44 23 20
+1 44 37 23
+1 45 12 38
+1 46 4 24
+1 46 23 60
+1 46 37 24
+1 48 15 24
+1 55 2 24
+1 58 1 1
+1 58 1 37
+1 58 3 3
+1 58 4 58
+1 58 20 11
+1 58 21 18
+1 58 21 23
+1 58 24 23
+1 59 1 34
+1 60 2 35
+1 60 3 2
+1 60 3 37
+1 60 11 30
+1 60 21 2
+1 60 21 3
+1 60 21 27
+1 60 21 31
+1 60 37 18
+1 60 38 41
+1 60 60 29
+1 60 60 60
+1 61 23 10
+1 64 21 24
+1 64 24 32
+1 64 37 3
+1 65 21 31
+1 65 23 25
+1 67 104 53
+1 90 104 60
+1 92 1 37
+1 92 92 1
+1 94 1 1
+1 94 94 1
+1 104 1 12
+1 104 18 34
+1 104 21 1
+1 104 23 1
+1 104 60 32
+1 104 64 24
+# libriscv bytecode sequences: count bytecode...
+# config: RISCV_64I RISCV_EXT_COMPRESSED RISCV_EXT_VECTOR
+963 81 81
+619 81 81 81
+609 80 80
+470 80 80 80
+193 70 26
+191 70 81
+191 81 70
+176 72 72
+151 81 81 70
+143 80 70
+140 70 77
+130 81 70 26
+118 70 70
+116 87 1
+116 80 70 77
+101 12 1
+101 70 81 81
+91 15 75
+89 1 70
+87 15 74
+86 87 87
+83 81 87
+80 80 80 70
+79 1 81
+77 84 87
+74 23 1
+74 23 31
+74 81 72
+73 13 34
+72 1 26
+72 73 84
+71 87 74
+70 73 82
+66 73 84 87
+65 1 24
+64 24 24
+64 70 72
+62 72 72 72
+61 80 72
+60 72 70
+60 78 1
+60 87 70
+60 78 1 26
+60 81 81 72
+59 13 1
+59 24 70
+58 12 23
+58 72 80
+57 1 73
+53 87 1 24
+52 81 1
+49 37 15
+48 80 72 80
+47 70 74
+47 1 73 84
+47 1 81 87
+46 72 75
+46 23 1 81
+46 37 15 74
+46 81 87 1
+44 104 75
+43 80 80 72
+41 60 60
+39 15 70
+39 24 24 24
+39 72 72 75
+38 70 1
+38 70 37
+38 72 1
+38 72 74
+37 60 26
+37 81 2
+37 60 60 26
+35 1 1
+35 15 15
+35 23 81
+35 23 87
+35 70 13
+35 72 80 70
+34 2 81
+34 15 72
+34 23 32
+34 70 29
+33 87 32
+33 70 13 34
+32 1 37
+32 70 87
+32 81 12
+32 24 70 26
+30 4 87
+30 81 2 81
+29 81 23
+29 87 81
+28 24 23
+28 70 37 15
+28 70 70 70
+27 82 1
+27 15 72 72
+27 70 72 72
+27 73 82 1
+27 82 1 73
+27 84 87 32
+26 1 84
+26 23 23
+26 72 76
+26 1 24 23
+26 24 23 1
+25 70 76
+25 87 12
+25 87 29
+25 23 81 81
+25 81 72 72
+24 1 13
+24 1 87
+24 61 86
+24 87 77
+24 13 1 13
+24 84 87 77
+24 87 12 1
+23 23 72
+23 104 26
+22 1 31
+22 7 87
+22 1 70 70
+22 72 80 80
+22 81 12 23
+22 87 87 87
+21 1 72
+21 4 84
+21 12 12
+21 61 104
+21 70 61
+21 86 61
+21 12 1 1
+21 15 15 70
+21 15 70 61
+21 61 86 61
+21 61 104 26
+21 70 61 86
+21 70 70 26
+21 70 81 12
+21 81 81 1
+21 86 61 104
+20 1 30
+20 23 74
+20 80 23
+19 72 36
+19 72 81
+19 81 13
+19 72 72 70
+19 80 23 32
+18 1 36
+18 1 74
+18 2 72
+18 21 70
+18 72 31
+18 81 74
+18 82 70
+18 84 23
+18 87 23
+18 2 81 2
+18 12 23 81
+18 87 81 81
+18 87 87 74
+17 11 75
+17 37 7
+17 70 31
+17 70 73
+17 70 104
+17 81 76
+17 82 84
+17 1 24 70
+17 1 37 7
+17 7 87 87
+17 12 1 73
+17 37 7 87
+17 87 1 37
+16 12 81
+16 23 70
+16 70 36
+16 78 70
+16 87 26
+16 87 31
+16 87 73
+16 90 104
+16 104 78
+16 4 87 73
+16 21 70 70
+16 73 82 84
+16 81 13 1
+16 90 104 78
+15 2 70
+15 11 84
+15 24 76
+15 24 80
+15 70 84
+15 72 13
+15 72 29
+15 72 87
+15 73 37
+15 81 24
+15 1 1 70
+15 12 1 72
+15 12 12 1
+15 81 70 81
+15 81 81 23
+15 82 70 73
+14 2 30
+14 70 24
+14 70 75
+14 72 23
+14 72 30
+14 73 76
+14 82 4
+14 87 83
+14 1 87 70
+14 4 87 12
+14 24 70 72
+14 70 72 1
+14 70 73 76
+14 70 87 29
+14 72 1 74
+14 73 37 15
+14 73 82 4
+14 82 4 87
+14 84 87 70
+14 87 70 87
+14 87 73 37
+14 104 78 70
+13 8 70
+13 11 74
+13 18 81
+13 24 31
+13 24 81
+13 37 87
+13 70 2
+13 70 32
+13 70 60
+13 81 36
+13 84 84
+13 87 24
+13 87 75
+13 87 78
+13 1 13 34
+13 1 24 76
+13 1 70 1
+13 2 81 81
+13 70 70 29
+13 70 81 70
+13 72 70 36
+13 81 81 74
+12 12 24
+12 12 72
+12 18 75
+12 37 81
+12 70 80
+12 72 37
+12 84 70
+12 104 32
+12 1 72 70
+12 1 84 84
+12 70 104 75
+12 72 13 34
+12 72 70 77
+12 72 81 81
+12 80 72 70
+12 81 1 26
+12 81 23 81
+12 81 70 72
+12 81 81 13
+12 81 81 87
+11 1 76
+11 1 104
+11 4 44
+11 8 60
+11 23 12
+11 23 29
+11 37 12
+11 45 12
+11 60 70
+11 60 81
+11 73 73
+11 81 77
+11 83 29
+11 83 74
+11 84 17
+11 84 24
+11 87 72
+11 1 70 74
+11 4 84 17
+11 12 1 81
+11 15 15 15
+11 23 87 87
+11 24 80 80
+11 37 81 87
+11 37 87 74
+11 70 72 37
+11 72 37 87
+11 72 72 29
+11 72 72 30
+11 73 73 82
+11 81 87 31
+11 87 1 84
+11 87 23 87
+11 87 87 1
+10 1 8
+10 1 77
+10 8 81
+10 10 81
+10 12 87
+10 19 19
+10 23 11
+10 23 41
+10 24 87
+10 38 45
+10 60 62
+10 61 1
+10 61 73
+10 62 61
+10 62 84
+10 70 27
+10 70 62
+10 72 27
+10 73 87
+10 81 27
+10 84 73
+10 84 77
+10 84 104
+10 87 11
+10 104 29
+10 1 8 70
+10 1 37 81
+10 1 70 62
+10 1 70 72
+10 1 73 73
+10 1 81 81
+10 8 70 74
+10 10 81 1
+10 12 87 12
+10 23 1 8
+10 23 1 31
+10 23 23 87
+10 23 87 1
+10 23 87 83
+10 60 62 61
+10 61 1 73
+10 61 73 82
+10 62 61 1
+10 62 84 104
+10 70 1 37
+10 70 60 62
+10 70 62 84
+10 70 70 13
+10 70 81 87
+10 73 82 70
+10 73 87 1
+10 80 70 60
+10 81 81 27
+10 82 84 73
+10 84 23 1
+10 84 73 87
+10 84 84 77
+10 84 104 29
+10 87 1 70
+10 87 83 29
+9 1 25
+9 4 82
+9 10 18
+9 17 74
+9 18 70
+9 23 62
+9 24 36
+9 41 38
+9 60 8
+9 62 30
+9 62 62
+9 70 8
+9 72 2
+9 78 32
+9 81 10
+9 81 60
+9 83 31
+9 83 70
+9 86 10
+9 87 104
+9 94 94
+9 8 60 8
+9 8 81 60
+9 10 18 81
+9 12 23 41
+9 12 72 1
+9 12 81 1
+9 18 81 10
+9 23 11 75
+9 23 41 38
+9 23 62 62
+9 37 12 81
+9 38 45 12
+9 41 38 45
+9 45 12 87
+9 60 8 81
+9 60 81 2
+9 62 62 30
+9 70 70 81
+9 70 81 72
+9 72 1 36
+9 72 23 23
+9 81 1 25
+9 81 1 87
+9 81 10 81
+9 81 23 1
+9 81 60 81
+9 81 72 27
+9 81 81 24
+9 81 87 87
+9 84 17 74
+9 86 10 18
+9 87 70 31
+8 2 76
+8 8 76
+8 11 12
+8 11 29
+8 11 72
+8 12 73
+8 38 74
+8 45 70
+8 60 11
+8 70 19
+8 73 1
+8 78 87
+8 80 24
+8 80 74
+8 80 81
+8 84 11
+8 87 4
+8 1 13 1
+8 1 84 87
+8 1 104 75
+8 12 23 29
+8 12 73 1
+8 13 1 70
+8 15 70 37
+8 19 19 19
+8 60 11 29
+8 70 8 76
+8 70 80 80
+8 70 81 23
+8 72 70 74
+8 73 1 84
+8 81 72 81
+8 81 72 87
+8 81 81 2
+8 81 87 81
+8 83 70 8
+8 87 70 70
+8 87 70 75
+8 87 87 81
+8 94 94 94
+7 1 2
+7 1 23
+7 2 106
+7 8 72
+7 11 8
+7 12 70
+7 13 23
+7 15 61
+7 19 26
+7 23 24
+7 24 12
+7 24 72
+7 37 19
+7 38 83
+7 44 61
+7 61 72
+7 61 87
+7 70 90
+7 70 106
+7 72 104
+7 78 75
+7 80 87
+7 81 11
+7 83 38
+7 104 1
+7 2 70 81
+7 2 72 70
+7 4 44 61
+7 4 82 70
+7 8 72 72
+7 11 8 72
+7 11 12 73
+7 11 84 11
+7 11 84 70
+7 12 1 70
+7 15 61 87
+7 15 72 74
+7 23 72 1
+7 37 19 26
+7 38 83 38
+7 44 61 72
+7 61 72 104
+7 61 87 104
+7 70 37 19
+7 70 70 84
+7 70 81 1
+7 72 104 1
+7 81 70 13
+7 81 72 74
+7 83 38 74
+7 84 11 84
+7 84 70 72
+7 87 1 77
+7 87 104 32
+7 104 1 70
+6 11 32
+6 12 18
+6 15 60
+6 21 36
+6 24 1
+6 42 87
+6 60 61
+6 60 74
+6 60 87
+6 70 28
+6 70 30
+6 70 79
+6 72 79
+6 72 84
+6 73 86
+6 78 4
+6 80 21
+6 81 18
+6 84 81
+6 13 1 81
+6 13 1 87
+6 23 70 70
+6 60 61 73
+6 70 1 104
+6 70 84 24
+6 72 1 76
+6 72 72 36
+6 78 70 27
+6 78 70 28
+6 81 70 70
+6 82 84 23
+6 84 23 31
+6 87 1 31
+5 1 80
+5 2 29
+5 2 87
+5 6 41
+5 15 81
+5 19 70
+5 21 31
+5 23 4
+5 23 80
+5 24 75
+5 41 7
+5 60 2
+5 70 21
+5 70 23
+5 72 6
+5 80 12
+5 81 80
+5 84 30
+5 87 10
+5 87 44
+5 1 81 70
+5 2 72 31
+5 6 41 7
+5 7 87 74
+5 12 1 23
+5 12 1 87
+5 12 23 12
+5 23 23 70
+5 23 72 31
+5 24 12 24
+5 24 81 70
+5 41 7 87
+5 70 81 36
+5 72 6 41
+5 72 72 1
+5 72 72 81
+5 72 87 87
+5 78 4 82
+5 80 70 13
+5 81 23 12
+5 81 24 24
+5 81 72 6
+5 81 80 80
+5 81 81 11
+5 81 81 12
+5 87 11 75
+5 87 70 81
+5 87 78 87
+4 1 12
+4 1 21
+4 1 29
+4 1 42
+4 1 75
+4 1 90
+4 4 1
+4 10 70
+4 12 21
+4 18 1
+4 18 23
+4 18 74
+4 21 80
+4 23 30
+4 23 60
+4 24 2
+4 24 29
+4 24 45
+4 24 90
+4 37 37
+4 37 85
+4 42 37
+4 44 31
+4 60 75
+4 70 15
+4 70 35
+4 70 45
+4 70 78
+4 72 32
+4 78 26
+4 80 75
+4 81 32
+4 85 42
+4 86 73
+4 86 78
+4 87 76
+4 87 80
+4 87 84
+4 104 70
+4 1 1 1
+4 1 42 37
+4 1 70 13
+4 1 90 104
+4 12 24 31
+4 12 81 23
+4 18 1 70
+4 18 70 81
+4 23 24 70
+4 23 80 80
+4 24 24 70
+4 24 45 70
+4 24 70 70
+4 24 87 87
+4 24 90 104
+4 37 37 85
+4 37 85 42
+4 42 37 37
+4 42 87 44
+4 45 70 74
+4 45 70 75
+4 60 87 72
+4 70 1 70
+4 70 2 87
+4 70 45 70
+4 70 70 1
+4 70 81 13
+4 70 81 32
+4 70 84 70
+4 70 87 70
+4 70 87 81
+4 70 90 104
+4 72 2 106
+4 72 23 72
+4 72 70 106
+4 72 72 13
+4 72 72 79
+4 72 84 81
+4 80 12 1
+4 80 24 80
+4 80 81 81
+4 81 1 81
+4 81 2 72
+4 81 24 81
+4 81 72 36
+4 81 81 76
+4 84 24 45
+4 85 42 87
+4 86 73 86
+4 87 1 42
+4 87 4 87
+4 87 10 70
+4 87 44 31
+4 87 70 13
+4 87 78 26
+4 87 80 80
+3 1 38
+3 2 2
+3 2 32
+3 4 72
+3 10 87
+3 11 11
+3 11 37
+3 11 81
+3 11 86
+3 15 11
+3 18 28
+3 21 24
+3 21 75
+3 21 76
+3 21 87
+3 23 18
+3 23 37
+3 24 74
+3 37 36
+3 37 41
+3 37 72
+3 38 70
+3 38 81
+3 41 74
+3 70 38
+3 72 12
+3 72 77
+3 73 15
+3 78 60
+3 78 74
+3 78 76
+3 80 2
+3 80 13
+3 80 78
+3 80 79
+3 81 8
+3 81 21
+3 81 31
+3 81 75
+3 82 12
+3 83 60
+3 84 18
+3 84 38
+3 84 74
+3 84 80
+3 87 2
+3 87 18
+3 87 19
+3 87 30
+3 87 36
+3 87 60
+3 87 90
+3 1 1 24
+3 1 1 38
+3 1 2 32
+3 1 2 70
+3 1 13 23
+3 1 21 36
+3 1 23 1
+3 1 37 72
+3 1 70 2
+3 1 70 87
+3 1 70 104
+3 1 81 36
+3 1 87 1
+3 4 72 84
+3 4 84 24
+3 11 72 75
+3 11 81 81
+3 12 1 21
+3 12 1 24
+3 12 1 74
+3 12 12 12
+3 12 23 1
+3 12 24 24
+3 12 70 70
+3 15 11 74
+3 15 60 11
+3 15 60 70
+3 15 70 29
+3 15 70 72
+3 15 81 81
+3 18 81 81
+3 21 87 74
+3 23 1 24
+3 23 12 1
+3 23 12 12
+3 23 37 15
+3 23 72 74
+3 24 1 104
+3 24 24 36
+3 24 24 80
+3 24 24 81
+3 24 80 74
+3 24 81 81
+3 24 87 70
+3 37 15 81
+3 37 41 74
+3 37 72 72
+3 60 2 29
+3 60 60 60
+3 60 70 30
+3 60 70 32
+3 60 70 60
+3 61 86 78
+3 70 1 73
+3 70 1 81
+3 70 2 72
+3 70 15 75
+3 70 21 87
+3 70 24 24
+3 70 24 80
+3 70 60 11
+3 70 70 2
+3 70 70 15
+3 70 72 13
+3 72 1 2
+3 72 13 1
+3 72 70 1
+3 72 70 70
+3 72 70 79
+3 72 72 74
+3 73 86 73
+3 78 60 70
+3 78 87 87
+3 80 2 70
+3 80 21 76
+3 80 21 80
+3 80 80 24
+3 80 80 81
+3 81 1 36
+3 81 1 70
+3 81 11 72
+3 81 11 81
+3 81 18 81
+3 81 70 19
+3 81 70 74
+3 81 70 80
+3 81 70 84
+3 81 70 87
+3 81 81 18
+3 81 81 36
+3 81 81 80
+3 81 87 75
+3 83 60 75
+3 84 70 32
+3 84 81 81
+3 84 87 74
+3 84 87 81
+3 86 78 60
+3 87 1 1
+3 87 1 2
+3 87 18 70
+3 87 24 75
+3 87 60 87
+3 87 70 90
+3 87 72 72
+3 87 72 74
+3 87 83 60
+3 87 87 23
+3 87 87 24
+3 87 87 30
+3 87 87 32
+3 104 70 32
+2 1 6
+2 1 11
+2 1 14
+2 1 48
+2 1 82
+2 2 1
+2 2 24
+2 2 36
+2 4 11
+2 4 24
+2 4 27
+2 4 86
+2 6 6
+2 6 80
+2 6 86
+2 8 8
+2 8 11
+2 8 31
+2 10 24
+2 11 4
+2 11 31
+2 11 70
+2 12 2
+2 14 74
+2 15 19
+2 15 44
+2 17 23
+2 18 18
+2 18 24
+2 18 60
+2 18 77
+2 19 1
+2 19 80
+2 20 76
+2 21 12
+2 21 74
+2 23 13
+2 23 76
+2 23 79
+2 23 84
+2 24 4
+2 24 10
+2 24 60
+2 24 77
+2 37 74
+2 37 84
+2 38 1
+2 38 84
+2 44 4
+2 44 73
+2 45 87
+2 60 21
+2 70 11
+2 70 39
+2 70 42
+2 70 85
+2 70 88
+2 72 4
+2 72 26
+2 72 90
+2 78 6
+2 78 13
+2 78 77
+2 78 81
+2 78 90
+2 80 1
+2 80 84
+2 81 9
+2 81 20
+2 81 29
+2 81 30
+2 81 38
+2 81 78
+2 81 79
+2 82 30
+2 82 104
+2 84 8
+2 84 21
+2 84 45
+2 84 83
+2 85 87
+2 86 4
+2 86 31
+2 86 70
+2 86 74
+2 87 13
+2 87 15
+2 87 79
+2 90 1
+2 90 31
+2 90 32
+2 104 11
+2 104 31
+2 1 1 36
+2 1 6 80
+2 1 11 75
+2 1 12 1
+2 1 14 74
+2 1 23 18
+2 1 24 24
+2 1 24 36
+2 1 24 81
+2 1 70 29
+2 1 70 90
+2 1 72 13
+2 1 72 81
+2 1 80 80
+2 1 81 13
+2 1 81 76
+2 1 81 77
+2 1 82 30
+2 1 87 31
+2 1 87 74
+2 1 104 70
+2 2 70 13
+2 2 72 36
+2 2 87 11
+2 2 87 36
+2 4 1 84
+2 4 11 86
+2 4 44 4
+2 4 84 8
+2 4 86 4
+2 6 6 86
+2 6 80 87
+2 6 86 74
+2 8 11 31
+2 10 70 42
+2 10 70 85
+2 10 87 26
+2 11 4 44
+2 11 11 37
+2 11 37 74
+2 11 70 81
+2 11 72 32
+2 11 72 72
+2 11 86 31
+2 12 1 12
+2 12 1 31
+2 12 1 36
+2 12 12 81
+2 12 18 74
+2 12 21 12
+2 12 23 31
+2 12 23 74
+2 12 24 12
+2 12 70 1
+2 12 81 81
+2 13 1 14
+2 13 1 23
+2 13 1 72
+2 13 1 75
+2 13 1 77
+2 13 23 72
+2 13 23 79
+2 15 15 19
+2 15 19 19
+2 15 44 73
+2 15 70 70
+2 17 23 29
+2 18 23 60
+2 18 70 78
+2 19 1 81
+2 19 70 81
+2 21 24 24
+2 23 1 11
+2 23 1 82
+2 23 4 87
+2 23 12 81
+2 23 13 1
+2 23 23 23
+2 23 23 72
+2 23 24 74
+2 23 60 70
+2 23 70 24
+2 23 70 81
+2 23 81 11
+2 23 81 12
+2 23 81 70
+2 23 81 72
+2 23 87 70
+2 24 1 81
+2 24 2 70
+2 24 2 72
+2 24 4 27
+2 24 24 1
+2 24 24 77
+2 24 24 87
+2 24 60 87
+2 24 70 1
+2 24 70 24
+2 24 72 90
+2 24 87 75
+2 37 87 70
+2 38 70 13
+2 38 81 29
+2 42 87 78
+2 44 4 86
+2 44 73 15
+2 60 70 39
+2 60 87 74
+2 70 1 1
+2 70 1 90
+2 70 2 70
+2 70 13 1
+2 70 19 70
+2 70 24 70
+2 70 38 70
+2 70 42 87
+2 70 70 27
+2 70 70 35
+2 70 70 38
+2 70 70 72
+2 70 70 74
+2 70 70 76
+2 70 70 77
+2 70 70 79
+2 70 70 106
+2 70 72 29
+2 70 72 30
+2 70 72 80
+2 70 78 87
+2 70 78 90
+2 70 80 79
+2 70 85 87
+2 70 87 4
+2 70 87 72
+2 70 90 31
+2 70 104 31
+2 72 1 70
+2 72 1 90
+2 72 2 81
+2 72 70 45
+2 72 70 88
+2 72 72 87
+2 72 87 23
+2 72 87 90
+2 72 90 104
+2 73 15 44
+2 73 82 12
+2 73 84 18
+2 73 84 30
+2 78 6 6
+2 78 13 34
+2 78 70 70
+2 78 81 81
+2 78 87 76
+2 78 90 104
+2 80 13 1
+2 80 70 70
+2 80 70 76
+2 80 70 81
+2 80 78 6
+2 80 80 12
+2 80 80 13
+2 80 80 87
+2 80 81 70
+2 80 84 80
+2 80 87 19
+2 81 1 6
+2 81 1 29
+2 81 1 80
+2 81 2 70
+2 81 12 12
+2 81 12 81
+2 81 13 23
+2 81 20 76
+2 81 24 36
+2 81 38 81
+2 81 70 24
+2 81 72 2
+2 81 72 70
+2 81 78 81
+2 81 81 9
+2 81 81 20
+2 81 81 38
+2 81 87 26
+2 82 12 1
+2 82 70 1
+2 84 8 11
+2 84 17 23
+2 84 18 77
+2 84 24 75
+2 84 24 87
+2 84 80 70
+2 85 87 78
+2 86 4 11
+2 87 1 87
+2 87 4 84
+2 87 11 32
+2 87 13 34
+2 87 19 70
+2 87 23 70
+2 87 24 60
+2 87 24 72
+2 87 24 80
+2 87 70 77
+2 87 70 78
+2 87 72 75
+2 87 73 84
+2 87 81 12
+2 87 81 78
+2 87 81 87
+2 87 84 23
+2 87 87 70
+2 87 87 78
+2 87 87 79
+2 87 87 80
+2 87 87 104
+2 87 90 1
+2 87 104 11
+2 90 1 1
+2 104 11 70
+1 1 19
+1 1 20
+1 1 27
+1 1 32
+1 1 35
+1 1 45
+1 1 79
+1 1 106
+1 2 12
+1 2 13
+1 2 44
+1 2 60
+1 2 73
+1 2 88
+1 2 104
+1 4 2
+1 4 8
+1 4 30
+1 4 36
+1 4 38
+1 4 70
+1 6 73
+1 8 24
+1 8 30
+1 9 31
+1 9 72
+1 9 74
+1 9 82
+1 10 21
+1 11 13
+1 11 26
+1 11 60
+1 11 87
+1 12 4
+1 12 36
+1 12 38
+1 12 45
+1 12 60
+1 12 75
+1 12 84
+1 15 2
+1 15 12
+1 15 25
+1 15 73
+1 15 83
+1 15 86
+1 18 10
+1 18 15
+1 18 21
+1 18 25
+1 18 32
+1 18 72
+1 18 76
+1 18 78
+1 18 83
+1 18 86
+1 19 18
+1 19 23
+1 19 24
+1 19 31
+1 19 72
+1 19 73
+1 19 75
+1 19 76
+1 19 81
+1 19 87
+1 20 24
+1 20 74
+1 21 1
+1 21 21
+1 21 25
+1 21 26
+1 21 27
+1 21 32
+1 21 81
+1 23 2
+1 23 15
+1 23 21
+1 23 26
+1 23 36
+1 23 83
+1 24 11
+1 24 13
+1 24 18
+1 24 19
+1 24 20
+1 24 21
+1 24 25
+1 24 26
+1 24 27
+1 24 32
+1 24 46
+1 24 78
+1 24 79
+1 24 84
+1 37 11
+1 37 24
+1 37 27
+1 37 29
+1 37 30
+1 37 31
+1 37 60
+1 38 9
+1 38 24
+1 38 31
+1 38 37
+1 38 38
+1 38 72
+1 38 77
+1 38 87
+1 39 1
+1 39 21
+1 39 80
+1 41 45
+1 41 80
+1 44 23
+1 44 70
+1 44 72
+1 44 78
+1 45 23
+1 45 27
+1 45 31
+1 46 24
+1 46 72
+1 46 80
+1 48 4
+1 48 70
+1 48 80
+1 48 84
+1 60 13
+1 60 24
+1 60 29
+1 60 39
+1 60 76
+1 60 80
+1 61 70
+1 65 21
+1 65 73
+1 66 81
+1 70 4
+1 70 12
+1 70 25
+1 70 65
+1 70 82
+1 72 11
+1 72 24
+1 72 60
+1 72 78
+1 72 106
+1 73 8
+1 73 81
+1 78 10
+1 78 21
+1 78 24
+1 78 27
+1 78 28
+1 78 29
+1 78 30
+1 78 31
+1 78 61
+1 78 72
+1 78 73
+1 78 80
+1 80 36
+1 80 37
+1 80 46
+1 80 73
+1 81 4
+1 81 15
+1 81 19
+1 81 45
+1 81 66
+1 81 83
+1 81 86
+1 81 90
+1 82 82
+1 83 19
+1 83 24
+1 83 32
+1 83 72
+1 83 84
+1 84 1
+1 84 4
+1 84 12
+1 84 19
+1 84 36
+1 84 37
+1 84 46
+1 84 48
+1 84 72
+1 84 76
+1 86 11
+1 86 81
+1 86 87
+1 87 6
+1 87 9
+1 87 21
+1 87 37
+1 87 38
+1 87 61
+1 87 94
+1 87 106
+1 90 15
+1 94 35
+1 104 4
+1 104 12
+1 104 37
+1 104 81
+1 1 1 20
+1 1 1 30
+1 1 1 31
+1 1 1 45
+1 1 1 72
+1 1 1 81
+1 1 1 84
+1 1 1 87
+1 1 2 81
+1 1 12 2
+1 1 12 23
+1 1 19 70
+1 1 20 24
+1 1 21 1
+1 1 23 72
+1 1 23 74
+1 1 24 2
+1 1 24 12
+1 1 24 87
+1 1 37 12
+1 1 37 24
+1 1 38 9
+1 1 38 70
+1 1 38 81
+1 1 45 23
+1 1 48 4
+1 1 48 84
+1 1 70 8
+1 1 70 23
+1 1 70 24
+1 1 70 76
+1 1 70 77
+1 1 70 81
+1 1 72 2
+1 1 72 26
+1 1 72 36
+1 1 72 84
+1 1 72 87
+1 1 80 70
+1 1 80 72
+1 1 80 73
+1 1 81 12
+1 1 81 18
+1 1 81 23
+1 1 81 24
+1 1 81 74
+1 1 81 80
+1 1 81 86
+1 1 81 90
+1 1 84 18
+1 1 84 23
+1 1 84 38
+1 1 84 45
+1 1 84 70
+1 1 84 83
+1 1 87 9
+1 1 87 75
+1 1 87 81
+1 1 104 81
+1 2 1 70
+1 2 1 72
+1 2 2 1
+1 2 2 70
+1 2 2 72
+1 2 12 1
+1 2 13 34
+1 2 24 1
+1 2 24 36
+1 2 44 72
+1 2 60 29
+1 2 70 1
+1 2 70 2
+1 2 70 15
+1 2 70 70
+1 2 70 72
+1 2 70 82
+1 2 72 4
+1 2 72 72
+1 2 72 81
+1 2 72 106
+1 2 73 82
+1 2 81 1
+1 2 81 70
+1 2 81 72
+1 2 87 15
+1 2 104 70
+1 4 1 48
+1 4 1 70
+1 4 2 70
+1 4 8 70
+1 4 24 81
+1 4 24 84
+1 4 38 72
+1 4 44 23
+1 4 44 70
+1 4 70 84
+1 4 82 12
+1 4 82 104
+1 4 84 4
+1 4 84 11
+1 4 84 12
+1 4 84 30
+1 4 84 74
+1 6 73 86
+1 8 8 60
+1 8 8 70
+1 8 24 81
+1 8 60 60
+1 8 60 81
+1 8 70 2
+1 8 70 26
+1 8 70 81
+1 8 81 8
+1 9 72 72
+1 9 82 84
+1 10 21 26
+1 10 24 10
+1 10 24 24
+1 10 87 2
+1 11 11 75
+1 11 12 24
+1 11 13 1
+1 11 37 31
+1 11 60 74
+1 11 72 70
+1 11 84 74
+1 11 86 78
+1 11 87 74
+1 12 1 27
+1 12 1 35
+1 12 1 37
+1 12 1 75
+1 12 1 76
+1 12 2 12
+1 12 2 87
+1 12 4 1
+1 12 12 70
+1 12 18 32
+1 12 18 60
+1 12 18 81
+1 12 18 86
+1 12 21 31
+1 12 21 36
+1 12 23 4
+1 12 23 15
+1 12 23 18
+1 12 23 23
+1 12 23 26
+1 12 23 30
+1 12 23 60
+1 12 23 70
+1 12 23 76
+1 12 23 80
+1 12 23 87
+1 12 24 23
+1 12 24 80
+1 12 24 87
+1 12 38 1
+1 12 45 12
+1 12 60 81
+1 12 70 24
+1 12 70 31
+1 12 72 12
+1 12 72 72
+1 12 72 78
+1 12 81 18
+1 12 84 87
+1 13 1 24
+1 13 1 76
+1 13 1 79
+1 13 1 80
+1 13 1 104
+1 13 23 13
+1 13 23 31
+1 13 23 70
+1 15 2 72
+1 15 12 1
+1 15 15 73
+1 15 70 31
+1 15 70 81
+1 15 73 15
+1 15 81 70
+1 15 81 75
+1 15 83 19
+1 15 86 73
+1 18 10 21
+1 18 15 15
+1 18 18 21
+1 18 18 23
+1 18 21 25
+1 18 23 21
+1 18 23 81
+1 18 24 27
+1 18 24 81
+1 18 60 21
+1 18 60 75
+1 18 70 11
+1 18 70 65
+1 18 70 70
+1 18 72 70
+1 18 78 21
+1 18 81 12
+1 18 83 32
+1 18 86 87
+1 19 18 18
+1 19 19 18
+1 19 19 80
+1 19 23 81
+1 19 24 80
+1 19 70 1
+1 19 70 21
+1 19 70 24
+1 19 72 70
+1 19 73 8
+1 19 80 12
+1 19 80 80
+1 19 81 70
+1 19 87 87
+1 20 24 24
+1 21 1 81
+1 21 12 1
+1 21 12 24
+1 21 21 31
+1 21 24 12
+1 21 70 76
+1 21 70 81
+1 21 80 21
+1 21 80 70
+1 21 80 74
+1 21 80 80
+1 21 81 70
+1 23 1 1
+1 23 2 72
+1 23 4 24
+1 23 4 44
+1 23 4 84
+1 23 11 37
+1 23 12 21
+1 23 12 70
+1 23 12 72
+1 23 15 15
+1 23 18 15
+1 23 18 24
+1 23 18 72
+1 23 21 21
+1 23 23 11
+1 23 23 24
+1 23 23 41
+1 23 23 74
+1 23 23 80
+1 23 23 81
+1 23 23 84
+1 23 24 78
+1 23 41 45
+1 23 60 21
+1 23 60 87
+1 23 70 1
+1 23 70 21
+1 23 70 32
+1 23 70 77
+1 23 70 84
+1 23 70 104
+1 23 72 12
+1 23 72 13
+1 23 72 30
+1 23 72 37
+1 23 72 72
+1 23 72 79
+1 23 72 81
+1 23 72 84
+1 23 80 12
+1 23 81 1
+1 23 81 77
+1 23 83 29
+1 23 84 24
+1 23 84 38
+1 23 87 78
+1 23 87 81
+1 24 1 80
+1 24 10 24
+1 24 10 81
+1 24 11 87
+1 24 12 12
+1 24 12 21
+1 24 13 1
+1 24 18 23
+1 24 19 24
+1 24 20 74
+1 24 21 70
+1 24 23 23
+1 24 23 83
+1 24 24 2
+1 24 24 12
+1 24 24 20
+1 24 24 25
+1 24 24 31
+1 24 24 72
+1 24 46 24
+1 24 70 32
+1 24 70 76
+1 24 70 81
+1 24 70 84
+1 24 70 104
+1 24 72 1
+1 24 72 31
+1 24 72 32
+1 24 72 74
+1 24 72 79
+1 24 78 87
+1 24 80 70
+1 24 81 1
+1 24 81 4
+1 24 81 21
+1 24 81 24
+1 24 81 74
+1 24 84 21
+1 24 87 31
+1 37 11 26
+1 37 12 1
+1 37 12 38
+1 37 24 2
+1 37 60 39
+1 37 81 23
+1 37 84 45
+1 37 84 83
+1 38 1 1
+1 38 1 29
+1 38 9 31
+1 38 24 31
+1 38 37 30
+1 38 38 37
+1 38 45 27
+1 38 70 76
+1 38 72 72
+1 38 81 81
+1 38 84 24
+1 38 84 81
+1 38 87 81
+1 39 1 31
+1 39 21 24
+1 39 80 87
+1 41 45 31
+1 41 80 80
+1 44 23 4
+1 44 70 87
+1 44 72 36
+1 44 78 10
+1 45 12 1
+1 45 12 70
+1 45 23 23
+1 45 87 32
+1 45 87 37
+1 46 24 36
+1 46 72 23
+1 46 80 37
+1 48 4 84
+1 48 70 24
+1 48 80 80
+1 48 84 46
+1 60 2 60
+1 60 2 81
+1 60 13 1
+1 60 21 31
+1 60 21 74
+1 60 24 70
+1 60 39 21
+1 60 60 2
+1 60 80 23
+1 60 81 8
+1 60 81 66
+1 61 70 87
+1 65 21 70
+1 65 73 37
+1 66 81 18
+1 70 1 12
+1 70 1 19
+1 70 1 29
+1 70 1 30
+1 70 1 36
+1 70 1 72
+1 70 1 76
+1 70 1 84
+1 70 2 1
+1 70 2 13
+1 70 2 73
+1 70 2 76
+1 70 4 8
+1 70 8 70
+1 70 11 13
+1 70 11 74
+1 70 12 81
+1 70 15 60
+1 70 19 1
+1 70 19 23
+1 70 19 73
+1 70 19 80
+1 70 19 81
+1 70 19 87
+1 70 21 24
+1 70 21 32
+1 70 23 23
+1 70 23 24
+1 70 23 30
+1 70 23 31
+1 70 23 70
+1 70 24 1
+1 70 24 12
+1 70 24 31
+1 70 24 46
+1 70 24 72
+1 70 24 79
+1 70 37 11
+1 70 37 12
+1 70 37 81
+1 70 38 24
+1 70 39 1
+1 70 39 80
+1 70 65 73
+1 70 70 24
+1 70 70 36
+1 70 72 36
+1 70 72 70
+1 70 72 75
+1 70 73 81
+1 70 73 84
+1 70 73 86
+1 70 80 70
+1 70 80 87
+1 70 81 2
+1 70 81 8
+1 70 81 15
+1 70 81 24
+1 70 81 30
+1 70 81 31
+1 70 81 75
+1 70 81 76
+1 70 81 79
+1 70 82 70
+1 70 84 1
+1 70 84 30
+1 70 84 48
+1 70 84 80
+1 70 84 81
+1 70 87 1
+1 70 87 11
+1 70 87 36
+1 70 87 75
+1 70 87 83
+1 70 87 87
+1 70 90 32
+1 70 104 4
+1 70 104 12
+1 70 104 37
+1 72 1 1
+1 72 1 84
+1 72 2 2
+1 72 2 24
+1 72 2 88
+1 72 4 1
+1 72 4 2
+1 72 11 84
+1 72 12 12
+1 72 12 23
+1 72 12 70
+1 72 23 81
+1 72 24 24
+1 72 37 29
+1 72 60 13
+1 72 70 27
+1 72 70 29
+1 72 70 31
+1 72 70 35
+1 72 70 72
+1 72 70 73
+1 72 70 75
+1 72 70 81
+1 72 70 87
+1 72 70 104
+1 72 72 4
+1 72 72 12
+1 72 72 31
+1 72 72 80
+1 72 72 84
+1 72 78 70
+1 72 80 46
+1 72 81 1
+1 72 81 13
+1 72 81 24
+1 72 81 36
+1 72 81 70
+1 72 81 72
+1 72 81 79
+1 72 84 37
+1 72 84 76
+1 72 87 4
+1 72 87 13
+1 72 87 26
+1 72 87 74
+1 72 87 81
+1 72 87 106
+1 73 8 24
+1 73 15 86
+1 73 37 87
+1 73 81 70
+1 73 82 82
+1 73 84 21
+1 73 84 74
+1 73 86 11
+1 73 86 70
+1 73 86 81
+1 78 4 44
+1 78 10 87
+1 78 21 75
+1 78 24 87
+1 78 61 73
+1 78 70 2
+1 78 70 30
+1 78 72 13
+1 78 73 73
+1 78 80 80
+1 78 87 24
+1 78 87 75
+1 78 87 81
+1 80 1 80
+1 80 1 84
+1 80 12 24
+1 80 13 34
+1 80 23 70
+1 80 24 2
+1 80 24 24
+1 80 24 26
+1 80 24 70
+1 80 37 84
+1 80 46 80
+1 80 70 1
+1 80 70 11
+1 80 70 31
+1 80 70 35
+1 80 70 73
+1 80 70 80
+1 80 72 31
+1 80 73 84
+1 80 78 61
+1 80 80 1
+1 80 80 23
+1 80 80 36
+1 80 80 79
+1 80 81 21
+1 80 81 80
+1 80 87 6
+1 80 87 78
+1 80 87 80
+1 80 87 81
+1 80 87 87
+1 81 1 21
+1 81 1 24
+1 81 1 37
+1 81 1 74
+1 81 1 84
+1 81 1 106
+1 81 2 36
+1 81 4 1
+1 81 8 8
+1 81 8 30
+1 81 8 81
+1 81 9 72
+1 81 9 74
+1 81 11 32
+1 81 12 1
+1 81 12 18
+1 81 12 24
+1 81 12 36
+1 81 12 72
+1 81 12 84
+1 81 13 34
+1 81 15 81
+1 81 18 23
+1 81 18 75
+1 81 18 78
+1 81 19 75
+1 81 21 36
+1 81 21 80
+1 81 21 81
+1 81 23 31
+1 81 23 70
+1 81 23 72
+1 81 24 4
+1 81 24 13
+1 81 24 19
+1 81 24 80
+1 81 45 87
+1 81 66 81
+1 81 70 1
+1 81 70 23
+1 81 70 32
+1 81 70 37
+1 81 72 23
+1 81 72 32
+1 81 72 60
+1 81 72 75
+1 81 81 19
+1 81 81 30
+1 81 81 75
+1 81 81 83
+1 81 83 72
+1 81 86 70
+1 81 87 13
+1 81 87 15
+1 81 87 23
+1 81 87 78
+1 81 90 15
+1 82 12 4
+1 82 70 106
+1 82 82 104
+1 82 84 87
+1 82 104 32
+1 82 104 75
+1 83 19 31
+1 83 24 12
+1 83 70 84
+1 83 72 72
+1 83 84 38
+1 84 1 87
+1 84 4 36
+1 84 11 11
+1 84 12 73
+1 84 18 70
+1 84 19 1
+1 84 21 24
+1 84 21 36
+1 84 23 30
+1 84 23 84
+1 84 24 10
+1 84 24 24
+1 84 24 31
+1 84 37 84
+1 84 38 74
+1 84 38 84
+1 84 38 87
+1 84 45 12
+1 84 45 87
+1 84 46 72
+1 84 48 70
+1 84 70 87
+1 84 70 104
+1 84 72 13
+1 84 80 72
+1 84 81 45
+1 84 81 70
+1 84 81 74
+1 84 83 24
+1 84 83 84
+1 84 84 30
+1 84 84 36
+1 84 84 84
+1 84 87 1
+1 84 87 2
+1 84 87 11
+1 84 87 31
+1 84 87 76
+1 84 87 87
+1 86 11 12
+1 86 70 81
+1 86 70 87
+1 86 78 4
+1 86 81 2
+1 86 87 21
+1 87 2 2
+1 87 2 36
+1 87 2 72
+1 87 4 30
+1 87 4 70
+1 87 6 73
+1 87 9 82
+1 87 10 87
+1 87 11 60
+1 87 11 74
+1 87 11 86
+1 87 12 24
+1 87 15 70
+1 87 15 83
+1 87 19 72
+1 87 21 74
+1 87 23 24
+1 87 23 30
+1 87 23 32
+1 87 23 60
+1 87 23 72
+1 87 24 4
+1 87 24 24
+1 87 24 74
+1 87 24 87
+1 87 37 27
+1 87 38 38
+1 87 44 78
+1 87 61 70
+1 87 70 1
+1 87 70 23
+1 87 70 38
+1 87 70 79
+1 87 70 84
+1 87 72 29
+1 87 72 81
+1 87 72 87
+1 87 78 24
+1 87 78 30
+1 87 78 31
+1 87 78 74
+1 87 81 24
+1 87 81 31
+1 87 81 36
+1 87 81 70
+1 87 81 72
+1 87 83 70
+1 87 84 19
+1 87 84 72
+1 87 87 2
+1 87 87 4
+1 87 87 60
+1 87 87 72
+1 87 87 94
+1 87 90 32
+1 87 94 94
+1 90 15 81
+1 94 94 35
+1 104 4 24
+1 104 12 60
+1 104 37 60
+1 104 70 104
+1 104 78 27
+1 104 78 28
+1 104 81 77
+# libriscv bytecode sequences: count bytecode...
+# config: RISCV_64I RISCV_EXT_COMPRESSED RISCV_EXT_VECTOR
+12894 1 30
+8727 19 1
+8212 19 1 30
+4236 23 23
+4129 4 37
+3532 90 8
+3477 19 90
+3429 24 1
+3419 19 90 8
+3233 8 1
+3216 90 8 1
+3164 1 1
+3029 37 22
+2941 4 37 22
+2901 1 1 30
+2871 38 45
+2865 24 24
+2798 6 38
+2784 6 38 45
+2593 39 6
+2593 39 6 38
+2554 23 24
+2404 23 1
+2335 13 1
+2217 24 23
+2099 2 32
+2075 1 35
+2017 45 44
+2017 38 45 44
+2003 12 60
+1978 15 39
+1968 15 39 6
+1954 1 34
+1920 23 1 34
+1866 4 8
+1826 37 23
+1821 3 28
+1783 24 36
+1765 44 90
+1762 45 44 90
+1757 90 2
+1743 8 1 35
+1713 23 31
+1657 22 30
+1646 44 90 2
+1646 90 2 32
+1601 22 1
+1507 37 22 1
+1496 23 29
+1455 22 1 30
+1455 37 22 30
+1413 60 45
+1413 12 60 45
+1309 1 24
+1276 3 3
+1270 8 1 1
+1246 23 23 23
+1184 1 23
+1164 1 2
+1076 1 37
+1076 37 24
+1050 13 23
+1029 24 24 24
+981 23 90
+957 1 3
+957 24 23 1
+950 24 1 23
+945 13 1 37
+902 24 23 24
+891 4 37 23
+888 8 12
+860 23 24 23
+806 13 15
+773 3 23
+768 8 12 60
+759 12 37
+759 45 8
+732 60 45 8
+730 23 37
+726 23 23 31
+717 24 13
+705 2 30
+704 45 8 12
+674 90 1
+672 41 26
+662 15 31
+641 23 2
+639 1 41
+639 1 41 26
+636 24 1 41
+635 2 35
+628 13 1 24
+623 1 29
+599 2 46
+584 2 39
+582 8 2
+564 1 3 3
+556 11 4
+548 8 31
+547 1 13
+546 23 23 37
+543 4 13
+542 23 32
+538 12 37 23
+537 3 2
+528 11 4 8
+523 24 24 23
+500 15 26
+497 24 24 36
+487 21 23
+482 2 23
+480 23 37 24
+477 23 24 24
+476 1 4
+476 24 2
+467 1 24 36
+457 2 27
+440 3 3 3
+437 11 10
+436 1 11
+435 23 45
+421 10 1
+421 11 10 1
+416 1 23 23
+408 24 1 2
+406 4 13 1
+401 23 4
+399 23 18
+394 8 32
+394 4 8 32
+386 2 29
+384 1 2 27
+383 2 28
+379 1 90
+372 24 22
+372 13 15 31
+371 23 30
+369 2 19
+369 23 23 24
+364 45 31
+364 24 1 24
+361 23 45 31
+360 13 22
+358 60 37
+358 12 60 37
+355 45 26
+352 3 3 28
+351 23 38
+345 46 13
+343 2 46 13
+343 23 24 36
+343 46 13 1
+342 3 35
+339 22 23
+336 23 13
+336 4 8 2
+336 37 23 24
+332 37 29
+328 37 2
+326 45 32
+326 24 13 1
+324 21 24
+324 39 45
+324 13 15 26
+322 1 21
+322 2 39 45
+316 3 29
+313 45 39
+311 4 44
+311 45 39 6
+309 37 1
+309 37 23 45
+308 3 2 39
+308 38 45 32
+308 39 45 26
+308 60 45 39
+305 19 1 90
+304 1 90 1
+299 4 8 31
+295 8 30
+295 23 104
+292 2 24
+289 90 90
+285 24 12
+282 104 37
+281 4 8 30
+274 23 90 1
+274 37 24 24
+268 90 12
+263 1 3 23
+262 2 2
+261 18 11
+261 23 12
+261 37 18
+261 1 37 18
+260 1 24 1
+256 2 19 1
+256 90 1 29
+255 23 3
+255 18 11 4
+255 24 1 3
+254 1 104
+254 104 4
+254 1 4 37
+254 104 4 8
+252 3 24
+252 23 23 2
+250 1 23 90
+250 1 24 24
+248 1 37 23
+248 13 1 13
+245 11 2
+239 3 23 23
+238 46 37
+235 22 21
+234 1 22
+231 24 1 22
+230 2 21
+229 18 1
+227 8 25
+227 4 8 25
+224 90 23
+223 23 12 37
+221 1 13 1
+220 3 3 35
+219 24 19
+218 11 32
+218 24 21
+217 10 1 30
+216 18 1 21
+215 22 31
+213 1 31
+212 44 1
+212 45 4
+212 45 44 1
+210 24 90
+210 21 23 23
+209 22 32
+208 1 13 23
+206 13 24
+206 23 35
+204 15 4
+204 2 39 6
+204 10 1 29
+204 44 1 35
+204 90 8 31
+203 18 3
+202 37 13
+202 38 21
+202 1 11 10
+202 8 1 11
+202 22 23 38
+202 23 38 21
+202 24 22 23
+202 37 24 22
+202 38 21 23
+201 1 2 23
+197 23 24 13
+196 44 24
+195 1 2 28
+195 2 46 37
+195 23 90 12
+195 37 18 11
+191 24 1 13
+191 24 24 19
+190 37 23 12
+189 12 30
+186 24 35
+186 23 4 13
+185 24 2 24
+182 37 15
+181 8 2 30
+180 23 13 1
+180 23 24 2
+179 3 27
+178 18 3 27
+177 23 104 4
+175 24 34
+174 11 2 30
+173 19 36
+173 3 23 18
+173 90 12 37
+168 15 4 44
+168 23 18 3
+168 60 37 2
+167 90 13
+167 2 23 104
+167 23 23 4
+165 1 9
+165 23 23 30
+164 8 11
+162 37 19
+161 2 88
+160 8 4
+157 90 4
+156 21 2
+156 13 1 3
+156 23 1 29
+155 24 13 23
+154 13 1 104
+153 37 19 1
+152 1 37 15
+152 24 12 60
+151 22 3
+151 1 11 32
+148 1 4 8
+148 37 13 1
+147 2 13
+147 44 15
+147 1 21 23
+146 8 13
+145 60 27
+145 4 37 13
+144 4 44 15
+144 44 15 4
+143 15 90
+143 2 24 36
+143 60 45 4
+140 3 24 23
+140 13 22 32
+139 1 8
+139 37 4
+138 19 1 2
+138 23 2 35
+138 24 13 24
+137 2 3
+137 2 104
+137 45 60
+137 4 13 23
+137 38 45 60
+136 2 31
+136 21 34
+136 13 23 13
+136 13 23 24
+136 24 24 21
+136 37 2 46
+136 46 37 19
+136 90 1 4
+135 90 11
+135 23 23 13
+133 21 1
+132 23 44
+132 37 12
+130 23 46
+129 46 8
+129 15 90 11
+129 23 44 24
+128 1 28
+128 23 15
+128 37 17
+128 1 37 17
+128 13 23 44
+128 13 24 1
+128 23 3 23
+128 24 1 28
+128 44 24 13
+127 23 8
+127 1 2 39
+127 37 24 36
+126 15 32
+126 45 1
+125 12 37 24
+124 19 24
+124 45 60 27
+123 21 36
+122 11 1
+121 1 22 3
+121 11 1 11
+121 90 11 1
+120 43 6
+120 3 3 23
+120 3 23 35
+120 22 3 24
+120 23 2 88
+120 43 6 38
+120 90 13 1
+118 8 12 30
+117 45 37
+116 4 37 24
+116 21 24 24
+116 37 23 31
+115 22 2
+115 24 15
+115 90 18
+115 8 2 35
+115 90 18 1
+114 90 37
+114 24 23 23
+114 37 1 3
+114 37 23 23
+114 44 90 37
+114 90 37 1
+113 23 90 90
+112 23 22
+111 23 24 1
+110 38 24
+110 23 13 23
+109 15 1
+109 13 23 46
+109 23 46 8
+108 9 2
+108 3 3 2
+108 9 2 30
+108 23 1 24
+108 45 4 44
+108 90 4 37
+107 45 24
+107 1 2 29
+107 37 23 32
+107 37 23 90
+106 19 23
+105 13 18
+104 37 24 23
+103 24 2 35
+102 12 29
+102 24 24 34
+101 8 37
+100 23 18 1
+98 15 19
+98 104 32
+98 1 24 2
+95 21 13
+95 23 27
+95 37 8
+95 13 15 32
+95 13 23 31
+95 23 37 23
+95 24 21 24
+95 24 22 21
+94 2 23 32
+93 1 27
+93 2 12
+93 3 2 28
+92 23 4 37
+91 24 3
+91 24 38
+91 13 23 2
+91 37 23 1
+91 37 23 30
+91 90 12 60
+90 7 45
+90 90 24
+90 1 23 4
+90 21 23 24
+86 13 22 31
+86 23 90 23
+86 24 12 37
+86 60 37 24
+86 90 1 1
+86 90 90 23
+85 3 23 90
+85 37 24 12
+84 38 1
+83 1 21 2
+83 1 23 31
+83 2 3 3
+83 19 23 1
+83 23 104 37
+82 21 2 23
+81 37 35
+81 2 2 3
+80 21 4
+80 1 24 23
+80 21 4 8
+80 21 23 18
+79 8 2 46
+78 12 2
+78 18 18
+78 2 2 35
+78 2 12 2
+78 12 2 2
+78 23 2 12
+78 37 12 60
+77 21 13 1
+77 46 37 24
+77 90 23 8
+76 11 37
+76 1 23 2
+76 8 2 32
+76 23 23 3
+76 23 24 22
+76 46 8 13
+75 23 28
+75 45 13
+75 2 104 32
+75 8 13 1
+75 22 21 23
+75 38 45 1
+75 45 13 23
+74 19 19
+74 23 23 38
+74 37 23 27
+73 104 26
+73 1 104 4
+73 8 11 37
+73 45 4 8
+72 18 4
+72 1 1 23
+72 24 24 12
+71 13 23 45
+71 18 4 8
+71 23 1 1
+71 24 2 19
+71 90 2 24
+70 17 23
+70 21 21
+70 1 23 32
+70 8 13 23
+70 21 24 1
+69 3 31
+69 15 3
+69 45 7
+69 45 23
+69 90 19
+69 38 45 7
+69 45 7 45
+68 17 21
+68 1 37 4
+68 17 21 1
+68 21 1 2
+68 37 4 13
+68 37 17 21
+67 8 26
+67 2 2 2
+67 2 13 1
+67 4 8 26
+67 11 2 39
+67 13 1 35
+67 24 23 90
+67 38 24 24
+66 3 32
+66 1 37 22
+66 1 104 37
+66 2 23 30
+66 2 24 13
+66 21 2 21
+66 23 90 18
+66 24 1 4
+66 24 24 2
+66 37 18 4
+65 12 45
+65 38 4
+65 45 12
+65 21 1 24
+65 21 24 36
+65 24 24 1
+65 38 45 13
+64 1 2 104
+64 3 24 24
+64 8 4 8
+64 23 2 27
+64 24 2 21
+64 44 24 23
+64 60 45 12
+63 8 2 29
+63 23 18 11
+62 4 1
+62 9 7
+62 23 23 32
+61 8 6
+61 39 4
+61 60 24
+61 1 9 7
+61 3 2 30
+61 4 8 6
+61 8 6 38
+61 24 13 22
+61 38 45 24
+61 39 4 8
+60 1 22 21
+60 1 23 24
+60 12 45 4
+60 12 60 24
+60 13 1 23
+60 22 21 1
+60 23 24 90
+60 24 38 24
+60 38 1 9
+59 1 21 4
+59 24 19 24
+58 2 21 13
+58 4 8 13
+58 22 1 4
+58 23 24 35
+58 24 22 1
+58 24 90 2
+58 37 24 38
+58 60 24 90
+58 90 24 36
+58 90 90 8
+57 43 45
+57 1 37 2
+57 2 39 4
+57 23 2 2
+57 37 24 1
+57 90 8 12
+56 1 15
+56 3 21
+56 4 9
+56 4 24
+56 23 17
+56 1 3 21
+56 1 3 35
+56 2 13 15
+56 3 21 24
+56 4 9 2
+56 22 2 13
+56 37 2 21
+56 38 4 8
+55 4 23
+55 45 29
+55 1 37 24
+55 22 21 24
+54 1 32
+54 9 8
+54 22 12
+54 24 4
+54 44 12
+54 1 13 22
+54 4 44 12
+54 4 44 24
+54 9 8 37
+54 13 23 90
+54 44 12 60
+54 45 12 60
+53 21 22
+53 37 11
+53 8 37 1
+52 21 35
+52 38 2
+52 1 9 2
+52 1 9 8
+52 1 11 2
+52 2 21 2
+52 2 23 31
+52 4 1 37
+52 21 22 21
+52 22 1 11
+52 23 8 12
+52 37 1 9
+52 90 23 24
+52 104 37 2
+51 37 3
+51 45 21
+51 90 15
+51 104 12
+51 104 90
+51 2 23 23
+51 7 45 21
+51 45 21 35
+50 23 43
+50 104 23
+50 37 11 4
+50 45 37 24
+49 11 12
+49 90 34
+49 23 1 23
+49 23 43 6
+49 24 19 19
+49 24 90 4
+49 37 4 37
+49 37 8 11
+49 37 15 1
+49 45 23 2
+49 90 4 13
+48 1 39
+48 37 30
+48 1 8 2
+48 2 3 23
+48 23 2 30
+48 23 23 90
+48 45 1 39
+48 90 1 30
+48 90 1 104
+47 19 24 24
+47 23 90 15
+47 45 37 8
+46 4 45
+46 7 4
+46 20 19
+46 24 31
+46 37 104
+46 4 45 37
+46 7 4 45
+46 9 7 4
+46 22 12 45
+46 24 19 36
+46 60 45 23
+46 90 1 2
+45 23 39
+45 1 8 11
+45 15 1 8
+45 23 23 18
+45 23 39 6
+45 23 45 29
+45 24 21 21
+44 12 32
+44 19 38
+44 23 11
+44 39 23
+44 45 43
+44 46 1
+44 1 4 13
+44 1 39 23
+44 2 46 1
+44 2 104 37
+44 19 38 1
+44 24 12 29
+44 24 19 38
+44 37 23 39
+44 37 23 43
+44 38 45 43
+44 39 23 45
+44 43 45 1
+44 45 1 24
+44 45 43 45
+44 46 1 37
+43 1 45
+43 11 26
+43 18 2
+43 2 21 23
+43 23 24 15
+43 24 15 19
+43 24 24 13
+43 60 37 104
+42 8 8
+42 15 2
+42 1 23 15
+42 2 19 36
+42 8 4 9
+42 21 21 24
+42 23 3 31
+42 23 90 8
+42 24 3 24
+42 90 19 90
+41 1 36
+41 90 38
+41 13 22 23
+41 21 23 90
+41 23 4 8
+41 23 38 45
+40 11 11
+40 15 35
+40 17 1
+40 12 37 4
+40 15 3 2
+40 24 1 30
+40 38 2 39
+40 45 24 23
+40 60 45 26
+40 90 90 13
+39 2 106
+39 8 23
+39 8 24
+39 21 90
+39 24 8
+39 1 1 104
+39 2 21 36
+39 4 8 4
+39 13 22 2
+39 15 19 36
+39 90 90 90
+38 2 26
+38 2 38
+38 37 32
+38 38 23
+38 1 90 24
+38 21 24 23
+38 37 2 23
+37 1 25
+37 22 22
+37 44 37
+37 1 104 90
+37 2 24 23
+37 23 2 31
+37 23 90 13
+37 24 1 36
+37 24 15 31
+37 104 12 60
+36 6 19
+36 11 43
+36 15 11
+36 23 42
+36 38 13
+36 1 1 90
+36 3 23 24
+36 11 43 6
+36 18 18 18
+36 37 2 104
+36 104 90 90
+35 1 38
+35 1 43
+35 6 32
+35 1 13 18
+35 8 11 12
+35 11 12 60
+35 23 18 18
+35 37 1 38
+35 37 23 3
+35 60 45 37
+34 2 66
+34 3 30
+34 8 29
+34 15 23
+34 23 21
+34 66 38
+34 90 22
+34 2 66 38
+34 8 2 66
+34 23 23 15
+34 23 90 22
+34 45 24 24
+34 46 8 2
+34 66 38 4
+34 90 13 22
+34 104 23 1
+33 13 14
+33 14 31
+33 18 27
+33 22 4
+33 37 6
+33 38 104
+33 1 2 35
+33 1 104 23
+33 2 24 24
+33 3 2 35
+33 13 14 31
+33 22 2 31
+33 22 4 8
+33 23 8 2
+33 37 6 32
+33 38 104 37
+33 90 22 32
+32 3 8
+32 1 8 4
+32 13 24 13
+32 19 24 12
+32 21 23 31
+32 21 90 18
+32 23 12 60
+32 24 4 37
+32 24 90 90
+32 104 37 11
+31 1 12
+31 44 11
+31 45 27
+31 60 39
+31 104 13
+31 12 60 39
+31 13 23 23
+31 13 23 28
+31 23 22 23
+31 23 23 1
+31 23 23 12
+31 38 45 27
+31 45 4 37
+31 60 39 6
+30 13 21
+30 60 28
+30 1 43 6
+30 11 37 2
+30 19 19 24
+30 19 24 15
+30 23 4 23
+30 23 21 90
+30 23 23 21
+30 23 37 1
+30 23 37 3
+30 24 21 36
+30 24 24 90
+30 37 2 28
+29 15 37
+29 18 23
+29 24 37
+29 60 30
+29 2 19 23
+29 19 19 36
+29 23 23 22
+29 23 23 104
+29 24 23 37
+29 37 15 37
+29 104 37 13
+29 104 37 24
+28 1 26
+28 4 15
+28 4 31
+28 15 8
+28 15 44
+28 19 13
+28 24 28
+28 38 12
+28 38 35
+28 41 35
+28 3 23 2
+28 4 15 44
+28 8 4 31
+28 8 11 32
+28 12 60 30
+28 13 23 42
+28 15 8 4
+28 17 23 31
+28 18 2 88
+28 22 21 22
+28 22 22 23
+28 23 1 8
+28 23 4 24
+28 23 15 31
+28 23 17 23
+28 23 22 22
+28 23 38 23
+28 24 13 15
+28 37 15 4
+28 37 24 28
+28 90 8 4
+28 90 15 3
+28 104 37 12
+28 104 37 30
+27 17 15
+27 17 90
+27 19 4
+27 45 11
+27 60 41
+27 104 46
+27 1 15 1
+27 1 37 32
+27 11 11 32
+27 12 60 41
+27 15 1 15
+27 15 1 25
+27 15 44 11
+27 17 15 31
+27 17 90 19
+27 19 1 4
+27 19 4 15
+27 20 19 1
+27 23 15 23
+27 24 3 23
+27 24 23 32
+27 37 12 29
+27 37 17 90
+27 38 12 60
+27 44 11 2
+27 60 41 35
+27 90 19 4
+26 1 20
+26 2 25
+26 3 12
+26 3 15
+26 6 35
+26 8 35
+26 20 23
+26 24 17
+26 37 31
+26 38 37
+26 1 20 23
+26 1 22 23
+26 4 23 37
+26 17 1 20
+26 24 17 1
+26 24 23 31
+26 37 15 35
+26 37 104 12
+25 23 34
+25 38 3
+25 45 45
+25 3 24 36
+25 8 8 31
+25 22 23 24
+25 23 23 35
+25 23 24 21
+25 23 37 12
+25 24 1 90
+25 37 15 2
+25 37 23 11
+25 37 24 3
+25 37 24 35
+25 90 1 24
+24 15 15
+24 23 6
+24 38 32
+24 4 8 8
+24 13 18 27
+24 15 15 4
+24 23 2 28
+24 23 6 35
+24 23 15 3
+24 24 1 15
+24 37 22 4
+24 90 38 45
+23 2 90
+23 18 21
+23 24 105
+23 90 3
+23 1 22 12
+23 1 24 105
+23 2 90 19
+23 3 3 32
+23 8 4 37
+23 13 23 29
+23 13 23 30
+23 15 11 11
+23 19 13 22
+23 23 11 43
+23 24 1 34
+23 37 23 8
+22 15 13
+22 23 26
+22 38 38
+22 60 29
+22 1 24 21
+22 12 37 22
+22 12 60 29
+22 13 23 32
+22 13 24 35
+22 22 23 35
+22 23 8 35
+22 23 13 18
+22 24 24 22
+22 37 24 13
+22 45 1 4
+21 1 60
+21 18 37
+21 19 31
+21 21 19
+21 46 23
+21 60 4
+21 1 23 104
+21 1 90 90
+21 13 1 31
+21 15 23 24
+21 18 23 23
+21 22 1 21
+21 37 3 35
+21 37 4 8
+21 37 13 22
+21 38 23 23
+21 46 23 37
+21 60 37 3
+21 104 37 1
+20 3 38
+20 15 24
+20 42 13
+20 45 41
+20 1 12 37
+20 1 24 13
+20 3 15 31
+20 4 8 12
+20 7 45 24
+20 13 22 1
+20 21 21 36
+20 21 23 1
+20 22 23 23
+20 23 3 38
+20 23 18 2
+20 23 37 6
+20 23 90 24
+20 24 23 4
+20 24 90 13
+20 37 3 23
+20 37 23 2
+20 42 13 23
+20 60 4 37
+20 90 23 4
+19 8 38
+19 24 20
+19 41 4
+19 1 1 2
+19 1 38 104
+19 2 23 29
+19 2 23 90
+19 3 2 2
+19 3 23 1
+19 4 24 15
+19 4 44 37
+19 8 38 3
+19 15 24 31
+19 18 18 2
+19 19 90 23
+19 20 19 24
+19 23 1 43
+19 23 24 20
+19 23 38 13
+19 23 90 19
+19 24 2 90
+19 24 15 24
+19 24 20 19
+19 24 90 1
+19 37 8 38
+19 37 12 30
+19 38 3 2
+19 38 13 1
+19 38 37 8
+19 41 4 44
+19 44 37 12
+19 45 41 4
+19 60 45 41
+19 90 23 90
+19 104 37 35
+18 18 13
+18 46 24
+18 1 60 4
+18 1 104 12
+18 2 21 21
+18 22 23 32
+18 23 2 32
+18 23 13 24
+18 23 23 28
+18 24 24 35
+18 24 37 24
+18 37 8 37
+18 45 44 37
+18 104 13 1
+17 3 36
+17 4 38
+17 19 2
+17 23 41
+17 37 27
+17 1 1 24
+17 1 15 3
+17 1 23 1
+17 1 24 90
+17 13 23 104
+17 23 3 30
+17 23 22 32
+17 37 1 4
+17 90 38 35
+16 1 92
+16 10 2
+16 11 39
+16 20 13
+16 23 7
+16 23 20
+16 23 36
+16 92 104
+16 1 1 8
+16 1 2 13
+16 3 23 22
+16 3 23 30
+16 8 2 28
+16 9 7 45
+16 10 2 29
+16 11 10 2
+16 11 37 35
+16 15 37 35
+16 19 1 1
+16 19 90 1
+16 20 23 23
+16 23 23 46
+16 23 46 37
+16 24 4 13
+16 24 15 11
+16 24 19 23
+16 24 24 15
+16 24 24 17
+16 37 2 30
+16 37 23 13
+16 37 24 2
+16 37 24 34
+16 38 45 23
+16 92 104 32
+15 3 37
+15 11 8
+15 11 104
+15 19 15
+15 21 3
+15 39 11
+15 44 45
+15 1 1 35
+15 1 4 44
+15 4 24 23
+15 4 44 45
+15 8 24 36
+15 11 37 11
+15 13 1 1
+15 13 18 13
+15 21 24 13
+15 23 2 23
+15 23 11 2
+15 23 23 36
+15 23 24 12
+15 23 24 19
+15 23 37 29
+15 23 38 32
+15 24 38 1
+15 37 1 1
+15 37 1 60
+15 37 13 15
+15 37 22 21
+15 38 38 2
+15 39 11 104
+15 44 45 8
+15 45 8 29
+15 60 37 23
+15 90 90 1
+14 4 22
+14 4 39
+14 7 90
+14 8 46
+14 11 6
+14 11 21
+14 17 3
+14 17 20
+14 17 24
+14 17 38
+14 18 38
+14 19 8
+14 19 11
+14 19 32
+14 19 34
+14 20 46
+14 21 6
+14 22 46
+14 22 104
+14 24 6
+14 24 11
+14 24 46
+14 37 36
+14 42 104
+14 44 7
+14 46 4
+14 48 24
+14 60 46
+14 1 2 30
+14 1 4 23
+14 1 21 13
+14 1 23 3
+14 1 23 20
+14 1 24 8
+14 1 24 46
+14 1 92 104
+14 2 13 23
+14 2 38 4
+14 2 46 24
+14 2 104 13
+14 3 8 4
+14 3 8 11
+14 3 23 3
+14 3 37 1
+14 3 38 1
+14 4 8 11
+14 4 8 23
+14 4 8 29
+14 4 22 46
+14 4 23 29
+14 4 24 24
+14 4 38 24
+14 4 39 11
+14 4 44 7
+14 6 19 23
+14 6 19 32
+14 6 38 2
+14 7 90 24
+14 8 1 2
+14 8 11 6
+14 8 11 21
+14 8 23 29
+14 8 23 32
+14 8 46 23
+14 11 4 39
+14 11 6 38
+14 11 8 24
+14 11 12 37
+14 11 21 4
+14 11 37 23
+14 11 104 23
+14 12 37 8
+14 13 1 92
+14 13 15 19
+14 13 18 37
+14 13 18 38
+14 15 3 8
+14 15 4 13
+14 15 4 24
+14 15 19 1
+14 15 19 8
+14 15 19 31
+14 15 90 1
+14 17 1 23
+14 17 3 32
+14 17 20 13
+14 17 23 4
+14 17 23 23
+14 17 23 32
+14 17 24 31
+14 17 38 104
+14 18 2 106
+14 18 37 1
+14 19 1 24
+14 19 8 11
+14 19 90 2
+14 20 13 1
+14 20 46 37
+14 21 6 19
+14 21 19 13
+14 21 24 2
+14 22 3 32
+14 22 23 1
+14 22 23 2
+14 22 23 37
+14 22 46 8
+14 22 104 90
+14 23 3 8
+14 23 4 22
+14 23 15 8
+14 23 17 1
+14 23 17 38
+14 23 20 46
+14 23 23 11
+14 23 23 17
+14 23 24 8
+14 23 37 15
+14 23 42 13
+14 23 90 38
+14 24 1 11
+14 24 2 46
+14 24 6 19
+14 24 8 11
+14 24 8 23
+14 24 11 8
+14 24 21 22
+14 24 23 22
+14 24 24 6
+14 24 46 4
+14 37 2 32
+14 37 15 15
+14 37 17 20
+14 37 17 24
+14 37 22 104
+14 37 23 17
+14 37 23 104
+14 37 24 21
+14 38 1 4
+14 38 13 18
+14 38 24 36
+14 39 45 11
+14 42 104 46
+14 44 7 90
+14 45 11 12
+14 45 23 37
+14 45 24 1
+14 46 4 38
+14 46 8 46
+14 46 24 37
+14 46 37 4
+14 48 24 4
+14 60 37 35
+14 90 1 12
+14 90 2 3
+14 90 2 23
+14 90 8 11
+14 90 15 8
+14 90 23 23
+14 90 24 34
+14 104 12 45
+14 104 23 90
+14 104 37 31
+14 104 37 36
+14 104 90 2
+13 4 4
+13 15 17
+13 41 6
+13 104 1
+13 1 13 15
+13 1 24 38
+13 7 45 37
+13 12 60 27
+13 12 60 46
+13 15 17 15
+13 23 15 17
+13 23 38 24
+13 23 41 6
+13 23 104 46
+13 37 1 24
+13 37 23 26
+13 38 45 45
+13 44 37 2
+13 60 46 37
+12 24 18
+12 60 12
+12 60 15
+12 90 35
+12 104 31
+12 1 24 3
+12 2 19 19
+12 4 8 37
+12 8 37 8
+12 11 39 6
+12 12 60 15
+12 15 2 31
+12 18 18 23
+12 19 1 26
+12 19 23 24
+12 23 2 46
+12 23 45 45
+12 24 90 18
+12 37 13 23
+12 37 23 7
+12 45 45 37
+12 45 60 12
+12 60 12 60
+12 60 15 39
+12 90 23 38
+12 90 90 24
+12 104 13 23
+11 1 19
+11 22 13
+11 24 32
+11 24 45
+11 37 60
+11 38 60
+11 60 60
+11 2 19 2
+11 8 24 8
+11 13 1 32
+11 15 37 1
+11 18 21 36
+11 23 8 30
+11 23 24 3
+11 23 45 24
+11 23 90 3
+11 24 8 31
+11 37 1 90
+11 45 37 1
+11 60 60 28
+11 90 8 24
+10 3 6
+10 12 38
+10 37 38
+10 39 3
+10 90 36
+10 1 1 4
+10 1 1 31
+10 1 2 88
+10 1 3 2
+10 1 37 1
+10 1 45 13
+10 2 2 24
+10 2 12 29
+10 2 21 22
+10 2 38 35
+10 3 2 38
+10 3 6 38
+10 3 12 60
+10 3 23 34
+10 3 24 90
+10 4 1 45
+10 4 23 4
+10 4 37 4
+10 11 4 24
+10 12 37 32
+10 12 38 2
+10 13 22 13
+10 13 23 1
+10 13 23 38
+10 15 2 39
+10 15 3 37
+10 15 13 23
+10 15 19 23
+10 15 39 3
+10 18 13 23
+10 19 19 19
+10 20 23 32
+10 22 13 23
+10 23 1 25
+10 23 3 24
+10 23 4 4
+10 23 24 17
+10 23 24 18
+10 23 24 38
+10 23 42 104
+10 24 1 12
+10 24 18 21
+10 24 21 2
+10 24 23 45
+10 37 1 8
+10 37 1 23
+10 37 1 32
+10 37 3 24
+10 37 15 13
+10 37 23 28
+10 38 2 35
+10 38 24 34
+10 39 3 6
+10 45 8 24
+10 45 12 38
+10 45 44 24
+10 90 2 35
+10 90 3 23
+10 90 23 2
+10 90 24 23
+10 90 90 12
+10 90 90 38
+9 1 18
+9 3 13
+9 4 2
+9 11 24
+9 12 23
+9 22 37
+9 24 30
+9 38 6
+9 1 45 4
+9 1 45 32
+9 2 38 23
+9 3 12 30
+9 4 4 8
+9 4 37 35
+9 8 2 38
+9 8 8 8
+9 8 24 12
+9 11 24 23
+9 12 37 19
+9 13 21 13
+9 22 1 45
+9 22 2 32
+9 22 3 31
+9 22 37 24
+9 23 18 27
+9 24 13 18
+9 24 22 37
+9 24 24 3
+9 24 24 38
+9 37 104 13
+9 38 1 24
+9 38 23 29
+9 45 8 2
+9 45 8 8
+9 60 45 29
+9 90 3 24
+8 1 14
+8 7 25
+8 13 19
+8 14 19
+8 23 60
+8 24 41
+8 37 21
+8 37 37
+8 38 30
+8 42 23
+8 42 24
+8 44 13
+8 44 35
+8 45 2
+8 45 35
+8 46 42
+8 1 1 14
+8 1 11 26
+8 1 13 24
+8 1 14 19
+8 1 38 45
+8 2 2 32
+8 2 19 24
+8 6 19 36
+8 12 23 29
+8 13 1 34
+8 13 22 21
+8 15 2 29
+8 15 4 8
+8 19 2 19
+8 21 13 23
+8 21 23 22
+8 22 12 60
+8 22 23 22
+8 23 1 3
+8 23 2 19
+8 23 2 106
+8 23 7 25
+8 23 15 4
+8 23 22 2
+8 23 22 3
+8 23 23 29
+8 23 24 31
+8 23 24 41
+8 23 38 1
+8 23 42 23
+8 24 1 1
+8 24 21 23
+8 24 23 2
+8 24 23 15
+8 24 37 12
+8 24 38 6
+8 24 38 32
+8 24 41 26
+8 37 24 90
+8 37 60 28
+8 38 6 19
+8 42 24 34
+8 44 1 11
+8 45 37 38
+8 90 11 39
+8 104 37 60
+8 104 46 42
+7 11 38
+7 12 24
+7 18 22
+7 21 37
+7 22 15
+7 22 24
+7 22 35
+7 23 25
+7 41 32
+7 46 2
+7 46 41
+7 60 2
+7 60 66
+7 66 4
+7 1 8 31
+7 1 12 23
+7 1 13 21
+7 1 21 37
+7 1 23 28
+7 1 24 15
+7 1 38 24
+7 1 90 13
+7 1 90 23
+7 1 104 1
+7 2 2 104
+7 2 19 34
+7 3 13 24
+7 4 2 30
+7 8 23 2
+7 12 60 66
+7 13 18 1
+7 13 18 22
+7 13 22 22
+7 13 22 35
+7 15 2 32
+7 15 13 1
+7 18 1 13
+7 18 3 28
+7 18 18 37
+7 18 22 4
+7 18 38 13
+7 18 38 60
+7 19 15 19
+7 19 24 23
+7 21 19 36
+7 21 37 4
+7 22 2 29
+7 22 2 35
+7 22 15 13
+7 22 21 6
+7 22 22 32
+7 23 22 12
+7 23 23 34
+7 23 38 38
+7 23 90 35
+7 23 104 12
+7 24 3 32
+7 24 21 19
+7 24 23 13
+7 24 23 34
+7 24 23 38
+7 24 45 24
+7 24 90 23
+7 37 19 13
+7 37 22 31
+7 37 23 38
+7 37 104 31
+7 38 4 2
+7 38 24 45
+7 38 38 13
+7 38 45 2
+7 38 45 11
+7 38 60 60
+7 45 1 11
+7 45 2 39
+7 45 11 24
+7 45 24 37
+7 45 45 26
+7 46 41 32
+7 60 45 1
+7 60 66 4
+7 66 4 8
+7 90 1 3
+7 90 13 15
+7 90 90 2
+7 104 37 23
+7 104 46 41
+6 2 4
+6 3 18
+6 6 23
+6 6 42
+6 8 42
+6 11 44
+6 21 31
+6 22 8
+6 23 19
+6 24 43
+6 38 8
+6 42 32
+6 42 37
+6 44 19
+6 45 22
+6 46 21
+6 46 90
+6 48 46
+6 60 21
+6 90 42
+6 104 35
+6 1 1 3
+6 1 2 2
+6 1 11 4
+6 1 15 31
+6 1 19 15
+6 1 23 35
+6 1 23 41
+6 1 104 13
+6 2 4 8
+6 2 13 19
+6 2 24 2
+6 3 2 104
+6 3 3 24
+6 3 3 29
+6 3 12 37
+6 3 15 32
+6 3 18 3
+6 3 38 24
+6 4 37 1
+6 4 37 2
+6 4 44 13
+6 6 23 41
+6 6 42 32
+6 8 8 42
+6 8 37 11
+6 8 37 13
+6 8 37 23
+6 8 37 24
+6 8 42 37
+6 11 38 4
+6 12 60 2
+6 12 60 21
+6 13 18 18
+6 13 21 3
+6 13 21 36
+6 13 23 4
+6 13 23 37
+6 13 24 2
+6 14 19 11
+6 15 1 19
+6 15 11 4
+6 15 23 3
+6 18 3 18
+6 18 11 38
+6 18 37 13
+6 19 2 24
+6 19 11 26
+6 19 15 31
+6 21 3 28
+6 21 13 21
+6 22 8 2
+6 23 1 13
+6 23 1 31
+6 23 2 29
+6 23 3 15
+6 23 3 32
+6 23 15 15
+6 23 22 1
+6 23 23 27
+6 23 37 13
+6 23 37 31
+6 23 38 8
+6 23 45 8
+6 23 90 2
+6 23 90 11
+6 24 1 29
+6 24 3 3
+6 24 21 31
+6 24 23 3
+6 24 43 45
+6 24 90 24
+6 37 8 13
+6 37 12 37
+6 37 13 21
+6 37 21 4
+6 37 22 23
+6 37 23 37
+6 37 24 43
+6 37 38 30
+6 38 3 3
+6 38 8 23
+6 38 24 3
+6 38 45 35
+6 41 6 23
+6 41 6 42
+6 42 23 42
+6 42 37 21
+6 43 45 11
+6 44 13 23
+6 45 8 13
+6 45 8 37
+6 45 11 4
+6 45 22 8
+6 45 44 35
+6 45 45 32
+6 46 21 24
+6 46 37 12
+6 46 42 13
+6 46 90 90
+6 48 46 21
+6 60 37 12
+6 60 45 22
+6 90 11 2
+6 90 23 13
+6 90 42 24
+6 90 90 42
+6 104 46 90
+5 3 60
+5 4 12
+5 9 4
+5 12 21
+5 17 35
+5 18 60
+5 37 9
+5 38 43
+5 45 38
+5 60 13
+5 1 1 45
+5 1 3 24
+5 1 43 45
+5 1 45 23
+5 1 45 24
+5 2 2 23
+5 2 21 1
+5 2 23 18
+5 2 23 46
+5 2 38 2
+5 3 23 31
+5 3 23 38
+5 4 23 38
+5 8 2 31
+5 12 21 36
+5 13 18 3
+5 13 19 13
+5 13 23 41
+5 13 23 60
+5 13 24 4
+5 15 2 30
+5 15 3 31
+5 15 13 22
+5 15 19 15
+5 18 3 60
+5 18 21 21
+5 19 24 21
+5 19 90 35
+5 21 3 23
+5 21 21 2
+5 21 23 13
+5 22 1 32
+5 22 3 2
+5 22 21 3
+5 23 7 45
+5 23 11 32
+5 23 13 22
+5 23 46 23
+5 24 2 23
+5 24 2 38
+5 24 3 12
+5 24 24 4
+5 37 1 45
+5 37 17 35
+5 37 23 29
+5 37 37 23
+5 38 43 6
+5 38 45 37
+5 38 45 38
+5 43 45 37
+5 44 37 31
+5 45 24 4
+5 45 24 21
+5 45 38 45
+5 46 2 29
+5 46 8 37
+5 46 37 23
+5 90 15 13
+5 90 23 18
+5 90 23 43
+5 90 24 2
+4 1 94
+4 8 44
+4 10 13
+4 11 23
+4 11 35
+4 14 1
+4 21 12
+4 23 10
+4 24 42
+4 41 8
+4 42 19
+4 42 42
+4 44 4
+4 45 46
+4 60 32
+4 90 31
+4 104 3
+4 104 22
+4 104 104
+4 1 2 90
+4 1 11 11
+4 1 11 35
+4 1 11 39
+4 1 19 11
+4 1 23 8
+4 1 23 27
+4 1 39 6
+4 1 104 22
+4 2 19 15
+4 3 24 1
+4 3 24 2
+4 3 60 28
+4 4 4 13
+4 4 12 30
+4 4 24 34
+4 8 37 9
+4 8 37 15
+4 10 13 24
+4 11 11 11
+4 11 11 26
+4 11 11 39
+4 11 39 4
+4 13 23 10
+4 13 23 18
+4 14 1 19
+4 15 1 11
+4 19 11 11
+4 19 23 23
+4 21 2 35
+4 22 24 21
+4 23 1 2
+4 23 1 27
+4 23 2 39
+4 23 8 23
+4 23 10 13
+4 23 15 32
+4 23 19 23
+4 23 23 19
+4 23 23 25
+4 23 41 8
+4 23 42 42
+4 23 90 4
+4 24 4 24
+4 24 19 34
+4 24 42 19
+4 24 45 8
+4 37 24 45
+4 38 23 31
+4 38 45 46
+4 38 60 27
+4 41 8 35
+4 42 19 11
+4 42 42 104
+4 44 4 8
+4 44 11 11
+4 44 19 23
+4 45 1 45
+4 45 23 7
+4 45 44 11
+4 45 44 19
+4 45 46 8
+4 46 24 42
+4 60 21 36
+4 90 3 13
+4 90 13 23
+4 90 15 15
+4 90 90 31
+4 104 1 104
+4 104 46 24
+3 1 105
+3 3 4
+3 7 24
+3 8 3
+3 19 35
+3 22 38
+3 24 7
+3 24 60
+3 38 11
+3 44 10
+3 44 23
+3 60 9
+3 97 104
+3 104 2
+3 104 97
+3 1 1 41
+3 1 2 106
+3 1 8 29
+3 1 11 44
+3 1 12 21
+3 1 15 90
+3 1 18 3
+3 1 18 60
+3 1 21 24
+3 1 22 2
+3 1 24 7
+3 1 24 35
+3 1 104 104
+3 2 3 31
+3 2 12 30
+3 2 21 24
+3 3 8 3
+3 4 8 44
+3 7 24 36
+3 7 45 39
+3 8 2 39
+3 8 3 2
+3 8 4 4
+3 8 44 23
+3 9 4 38
+3 11 23 8
+3 11 44 15
+3 12 24 24
+3 12 45 24
+3 12 60 13
+3 12 60 32
+3 13 18 21
+3 13 21 23
+3 13 21 90
+3 13 24 23
+3 13 24 36
+3 15 11 23
+3 15 11 44
+3 15 23 2
+3 18 1 18
+3 18 3 30
+3 18 13 18
+3 18 13 21
+3 18 18 21
+3 18 21 23
+3 18 23 21
+3 18 60 60
+3 19 13 1
+3 19 19 2
+3 19 23 13
+3 21 12 60
+3 21 13 22
+3 21 90 13
+3 22 21 36
+3 22 24 23
+3 23 1 30
+3 23 1 105
+3 23 2 25
+3 23 3 35
+3 23 3 37
+3 23 12 45
+3 23 22 24
+3 23 23 44
+3 23 24 32
+3 23 38 37
+3 23 38 60
+3 23 44 4
+3 23 104 97
+3 24 1 18
+3 24 1 21
+3 24 7 24
+3 24 12 24
+3 24 21 90
+3 24 22 3
+3 24 22 24
+3 24 90 3
+3 24 90 12
+3 37 24 4
+3 38 24 23
+3 38 24 32
+3 38 37 24
+3 38 37 35
+3 44 15 2
+3 44 23 24
+3 44 90 1
+3 60 2 31
+3 60 2 35
+3 60 45 32
+3 90 1 23
+3 90 24 22
+3 97 104 31
+3 104 1 1
+3 104 3 23
+3 104 104 4
+2 1 44
+2 1 46
+2 1 93
+2 2 1
+2 3 1
+2 3 22
+2 3 34
+2 7 31
+2 7 32
+2 7 104
+2 11 31
+2 11 46
+2 12 13
+2 12 44
+2 17 32
+2 18 28
+2 18 44
+2 19 26
+2 21 14
+2 21 91
+2 23 14
+2 24 92
+2 38 27
+2 38 29
+2 38 31
+2 46 35
+2 48 1
+2 60 23
+2 90 104
+2 91 104
+2 104 7
+2 104 8
+2 104 11
+2 104 15
+2 104 21
+2 104 24
+2 1 3 29
+2 1 8 1
+2 1 15 39
+2 1 21 3
+2 1 21 12
+2 1 21 14
+2 1 21 90
+2 1 37 104
+2 1 45 8
+2 1 45 35
+2 1 46 23
+2 1 60 9
+2 1 104 3
+2 1 104 24
+2 2 2 13
+2 2 2 26
+2 2 3 2
+2 2 12 37
+2 2 13 21
+2 2 13 24
+2 2 23 19
+2 2 24 92
+2 2 104 11
+2 3 2 3
+2 3 2 13
+2 3 4 8
+2 3 13 23
+2 3 22 3
+2 3 23 14
+2 3 23 28
+2 3 23 32
+2 3 24 22
+2 4 24 36
+2 4 37 38
+2 4 44 35
+2 4 44 90
+2 7 45 23
+2 8 1 8
+2 8 1 24
+2 8 8 37
+2 8 23 23
+2 8 37 29
+2 9 4 8
+2 11 2 32
+2 11 2 104
+2 11 44 19
+2 11 46 2
+2 12 24 13
+2 12 44 24
+2 12 45 31
+2 13 1 2
+2 13 1 22
+2 13 1 36
+2 13 18 4
+2 13 18 28
+2 13 18 44
+2 13 18 60
+2 13 19 23
+2 13 21 24
+2 13 23 12
+2 14 19 26
+2 15 19 13
+2 15 23 60
+2 15 37 30
+2 18 1 23
+2 18 21 2
+2 18 21 13
+2 18 60 28
+2 19 1 13
+2 19 2 35
+2 19 11 2
+2 19 11 32
+2 19 15 1
+2 19 23 28
+2 19 23 31
+2 19 24 2
+2 19 90 13
+2 19 90 90
+2 20 13 22
+2 21 2 2
+2 21 3 31
+2 21 14 1
+2 21 21 3
+2 21 24 3
+2 21 24 32
+2 21 90 23
+2 21 90 90
+2 22 2 2
+2 22 3 23
+2 22 23 29
+2 22 38 4
+2 23 1 11
+2 23 1 12
+2 23 3 2
+2 23 3 22
+2 23 7 32
+2 23 8 1
+2 23 8 24
+2 23 12 30
+2 23 14 1
+2 23 15 2
+2 23 18 23
+2 23 19 1
+2 23 20 13
+2 23 21 13
+2 23 22 31
+2 23 23 8
+2 23 23 20
+2 23 23 42
+2 23 37 2
+2 23 37 8
+2 23 37 37
+2 23 38 4
+2 23 60 13
+2 23 60 23
+2 23 104 1
+2 23 104 8
+2 23 104 13
+2 24 1 35
+2 24 1 104
+2 24 2 28
+2 24 2 106
+2 24 3 34
+2 24 22 32
+2 24 23 8
+2 24 23 12
+2 24 24 30
+2 24 60 27
+2 37 2 35
+2 37 8 31
+2 37 9 4
+2 37 11 24
+2 37 12 45
+2 37 38 11
+2 38 2 28
+2 38 4 37
+2 38 11 37
+2 38 13 21
+2 38 23 30
+2 38 23 38
+2 42 23 31
+2 44 19 35
+2 44 24 1
+2 44 24 22
+2 44 90 15
+2 45 23 4
+2 45 24 2
+2 45 39 45
+2 46 2 39
+2 46 13 23
+2 46 42 24
+2 48 1 46
+2 60 9 4
+2 60 13 23
+2 60 13 24
+2 60 21 23
+2 60 24 2
+2 90 1 13
+2 90 1 90
+2 90 12 23
+2 90 23 32
+2 90 90 15
+2 91 104 32
+2 104 1 92
+2 104 2 32
+2 104 7 31
+2 104 11 46
+2 104 15 2
+2 104 22 4
+2 104 22 38
+2 104 46 13
+2 104 97 104
+1 1 6
+1 3 9
+1 3 90
+1 4 32
+1 6 1
+1 6 45
+1 7 1
+1 7 39
+1 8 28
+1 8 41
+1 8 45
+1 9 12
+1 9 21
+1 9 24
+1 10 4
+1 10 11
+1 10 19
+1 12 3
+1 12 27
+1 13 17
+1 15 25
+1 17 2
+1 18 12
+1 18 24
+1 18 35
+1 19 7
+1 21 18
+1 21 38
+1 22 18
+1 22 26
+1 22 42
+1 22 44
+1 24 49
+1 37 7
+1 37 25
+1 37 28
+1 37 34
+1 37 40
+1 37 41
+1 39 7
+1 40 27
+1 41 13
+1 41 43
+1 42 4
+1 44 21
+1 44 51
+1 45 3
+1 45 90
+1 46 12
+1 46 29
+1 47 24
+1 49 24
+1 51 9
+1 60 1
+1 60 3
+1 60 38
+1 60 47
+1 91 91
+1 92 24
+1 92 92
+1 92 97
+1 93 1
+1 93 104
+1 94 1
+1 94 13
+1 94 19
+1 94 36
+1 97 13
+1 97 23
+1 104 18
+1 104 30
+1 104 36
+1 104 38
+1 104 60
+1 1 1 1
+1 1 1 9
+1 1 1 13
+1 1 1 19
+1 1 1 29
+1 1 1 32
+1 1 1 36
+1 1 3 4
+1 1 4 2
+1 1 6 1
+1 1 8 12
+1 1 8 30
+1 1 11 37
+1 1 11 38
+1 1 12 60
+1 1 13 17
+1 1 15 32
+1 1 18 1
+1 1 18 13
+1 1 18 23
+1 1 19 1
+1 1 21 21
+1 1 22 22
+1 1 23 12
+1 1 23 18
+1 1 23 30
+1 1 23 45
+1 1 24 4
+1 1 24 12
+1 1 24 18
+1 1 24 19
+1 1 24 34
+1 1 24 60
+1 1 37 25
+1 1 37 31
+1 1 38 12
+1 1 44 24
+1 1 44 51
+1 1 45 37
+1 1 60 3
+1 1 90 8
+1 1 90 12
+1 1 92 24
+1 1 92 97
+1 1 93 1
+1 1 93 104
+1 1 94 1
+1 1 94 13
+1 1 94 19
+1 1 94 36
+1 1 104 31
+1 1 104 36
+1 1 104 38
+1 2 1 2
+1 2 1 35
+1 2 2 31
+1 2 2 106
+1 2 3 35
+1 2 21 12
+1 2 21 34
+1 2 23 27
+1 2 23 35
+1 2 24 12
+1 2 24 19
+1 2 24 32
+1 2 24 34
+1 2 24 90
+1 2 39 11
+1 2 46 8
+1 2 46 12
+1 2 46 29
+1 2 104 1
+1 2 104 21
+1 3 1 9
+1 3 1 24
+1 3 2 12
+1 3 2 23
+1 3 2 31
+1 3 3 4
+1 3 4 13
+1 3 8 23
+1 3 9 4
+1 3 12 3
+1 3 23 12
+1 3 24 3
+1 3 24 38
+1 3 24 60
+1 3 37 30
+1 3 60 27
+1 3 90 2
+1 4 2 29
+1 4 2 39
+1 4 8 24
+1 4 8 41
+1 4 8 45
+1 4 12 37
+1 4 24 13
+1 4 24 37
+1 4 37 8
+1 4 37 21
+1 4 37 104
+1 4 38 13
+1 4 38 35
+1 4 38 60
+1 4 44 10
+1 6 1 44
+1 6 45 31
+1 7 1 37
+1 7 39 7
+1 7 45 29
+1 7 104 15
+1 7 104 23
+1 8 2 26
+1 8 12 29
+1 8 12 37
+1 8 13 22
+1 8 23 12
+1 8 23 35
+1 8 24 2
+1 8 24 30
+1 8 24 31
+1 8 24 90
+1 8 37 35
+1 8 37 60
+1 8 41 13
+1 8 44 10
+1 8 45 2
+1 9 12 27
+1 9 21 13
+1 9 24 23
+1 10 4 8
+1 10 11 11
+1 10 19 35
+1 11 1 2
+1 11 4 2
+1 11 4 12
+1 11 4 23
+1 11 4 44
+1 11 8 44
+1 11 11 8
+1 11 23 39
+1 11 37 29
+1 11 38 23
+1 11 44 10
+1 11 104 15
+1 12 3 31
+1 12 13 1
+1 12 13 24
+1 12 23 28
+1 12 24 1
+1 12 24 2
+1 12 37 21
+1 12 60 47
+1 13 1 12
+1 13 1 94
+1 13 15 25
+1 13 17 2
+1 13 18 2
+1 13 18 23
+1 13 19 2
+1 13 21 38
+1 13 22 38
+1 13 22 44
+1 13 23 3
+1 13 23 35
+1 13 23 43
+1 13 24 12
+1 13 24 18
+1 13 24 24
+1 13 24 31
+1 13 24 32
+1 13 24 37
+1 13 24 90
+1 15 11 2
+1 15 23 23
+1 15 23 32
+1 15 24 24
+1 15 44 90
+1 17 2 32
+1 18 1 60
+1 18 2 28
+1 18 3 13
+1 18 3 23
+1 18 3 24
+1 18 3 35
+1 18 4 13
+1 18 12 13
+1 18 13 1
+1 18 13 24
+1 18 18 13
+1 18 23 13
+1 18 23 18
+1 18 23 24
+1 18 23 27
+1 18 23 60
+1 18 24 24
+1 18 37 60
+1 18 44 4
+1 18 44 13
+1 19 1 11
+1 19 2 2
+1 19 7 39
+1 19 13 15
+1 19 13 23
+1 19 19 1
+1 19 19 7
+1 19 24 3
+1 21 2 1
+1 21 2 104
+1 21 3 2
+1 21 3 13
+1 21 12 37
+1 21 13 24
+1 21 18 3
+1 21 21 22
+1 21 22 3
+1 21 23 12
+1 21 24 4
+1 21 24 35
+1 21 38 13
+1 21 91 91
+1 21 91 104
+1 22 1 1
+1 22 2 46
+1 22 3 1
+1 22 13 21
+1 22 18 3
+1 22 21 12
+1 22 21 90
+1 22 22 3
+1 22 22 42
+1 22 38 6
+1 22 42 4
+1 22 44 13
+1 23 1 4
+1 23 1 22
+1 23 1 32
+1 23 1 35
+1 23 1 45
+1 23 2 13
+1 23 3 9
+1 23 3 12
+1 23 7 1
+1 23 8 28
+1 23 11 1
+1 23 12 24
+1 23 13 21
+1 23 15 11
+1 23 15 24
+1 23 18 24
+1 23 18 35
+1 23 21 2
+1 23 21 36
+1 23 22 18
+1 23 22 21
+1 23 23 26
+1 23 24 30
+1 23 37 9
+1 23 37 27
+1 23 37 32
+1 23 38 11
+1 23 38 27
+1 23 38 30
+1 23 38 31
+1 23 43 45
+1 23 60 4
+1 23 60 28
+1 23 60 32
+1 23 60 38
+1 23 104 3
+1 23 104 18
+1 23 104 21
+1 23 104 32
+1 23 104 60
+1 23 104 104
+1 24 1 27
+1 24 1 45
+1 24 1 94
+1 24 2 2
+1 24 2 12
+1 24 2 13
+1 24 2 29
+1 24 2 32
+1 24 2 104
+1 24 3 8
+1 24 3 35
+1 24 4 8
+1 24 4 32
+1 24 18 1
+1 24 18 3
+1 24 19 2
+1 24 23 18
+1 24 23 21
+1 24 23 36
+1 24 23 104
+1 24 37 23
+1 24 37 28
+1 24 37 30
+1 24 49 24
+1 24 60 24
+1 24 90 104
+1 24 92 92
+1 24 92 104
+1 37 1 12
+1 37 1 27
+1 37 4 23
+1 37 7 104
+1 37 8 30
+1 37 9 8
+1 37 9 12
+1 37 9 24
+1 37 11 23
+1 37 15 11
+1 37 19 2
+1 37 19 90
+1 37 21 23
+1 37 21 35
+1 37 22 24
+1 37 23 25
+1 37 23 35
+1 37 23 44
+1 37 24 31
+1 37 24 37
+1 37 37 1
+1 37 37 29
+1 37 37 60
+1 37 38 27
+1 37 38 29
+1 37 40 27
+1 37 41 35
+1 37 60 1
+1 37 60 9
+1 37 60 46
+1 37 104 2
+1 37 104 4
+1 37 104 23
+1 37 104 30
+1 38 1 1
+1 38 6 35
+1 38 11 32
+1 38 12 37
+1 38 13 24
+1 38 37 30
+1 38 45 39
+1 39 7 104
+1 39 45 12
+1 39 45 39
+1 41 6 35
+1 41 13 19
+1 41 43 45
+1 42 4 8
+1 43 45 3
+1 43 45 41
+1 44 10 4
+1 44 10 11
+1 44 10 19
+1 44 13 1
+1 44 13 18
+1 44 21 2
+1 44 51 9
+1 45 1 44
+1 45 2 35
+1 45 3 3
+1 45 12 30
+1 45 37 23
+1 45 41 43
+1 45 44 21
+1 45 60 30
+1 45 90 8
+1 46 12 60
+1 47 24 49
+1 49 24 1
+1 51 9 8
+1 60 1 13
+1 60 2 28
+1 60 3 28
+1 60 4 8
+1 60 9 21
+1 60 13 21
+1 60 23 27
+1 60 23 28
+1 60 24 24
+1 60 37 1
+1 60 37 19
+1 60 37 29
+1 60 37 34
+1 60 37 40
+1 60 38 31
+1 60 45 90
+1 60 46 8
+1 60 47 24
+1 90 1 11
+1 90 2 13
+1 90 2 21
+1 90 8 2
+1 90 8 30
+1 90 12 13
+1 90 12 30
+1 90 13 21
+1 90 13 24
+1 90 22 1
+1 90 23 1
+1 90 23 104
+1 90 104 1
+1 90 104 31
+1 91 91 104
+1 92 24 1
+1 92 92 104
+1 92 97 13
+1 93 1 93
+1 93 104 1
+1 94 1 94
+1 94 13 22
+1 94 19 19
+1 97 13 23
+1 97 23 23
+1 104 1 23
+1 104 1 60
+1 104 1 93
+1 104 1 94
+1 104 2 46
+1 104 3 3
+1 104 8 24
+1 104 8 37
+1 104 13 15
+1 104 18 1
+1 104 21 18
+1 104 21 36
+1 104 23 23
+1 104 23 37
+1 104 24 2
+1 104 24 23
+1 104 37 41
+1 104 38 37
+1 104 60 27
+1 104 90 13
+1 104 97 23
+1 104 104 32
+# libriscv bytecode sequences: count bytecode...
+# config: RISCV_64I RISCV_EXT_COMPRESSED RISCV_EXT_VECTOR
+417 23 23
+308 70 70
+302 23 24
+184 14 19
+151 19 70
+151 70 75
+151 14 19 70
+151 19 70 70
+151 70 70 70
+151 70 70 75
+148 23 23 24
+146 23 23 23
+136 70 31
+134 70 32
+132 80 80
+130 24 72
+129 80 70
+118 24 76
+111 81 70
+103 24 24
+102 19 15
+101 15 70
+100 19 15 70
+99 24 19
+99 24 19 15
+97 70 81
+97 23 24 72
+96 15 70 32
+94 72 24
+89 81 81
+88 13 34
+87 70 81 81
+86 81 81 70
+83 1 6
+83 70 24
+83 70 77
+83 80 70 77
+83 80 80 70
+80 6 24
+80 1 6 24
+80 6 24 19
+79 24 72 24
+73 23 1
+73 23 24 76
+72 24 23
+72 24 29
+72 72 24 29
+67 24 30
+67 23 24 30
+66 23 84
+64 23 81
+63 24 87
+63 87 24
+63 23 1 6
+61 23 23 84
+60 19 76
+56 84 19
+56 23 84 19
+56 84 19 76
+53 24 24 24
+53 81 70 24
+48 72 23
+47 24 72 23
+46 80 70 31
+45 24 70
+43 73 84
+43 84 87
+41 80 73
+41 80 73 84
+40 73 84 87
+40 80 80 73
+36 72 23 24
+35 87 81
+34 24 87 24
+30 19 14
+29 14 19 14
+29 19 14 19
+28 70 72
+27 24 70 31
+26 81 76
+26 81 80
+26 82 24
+26 81 70 72
+25 23 70
+25 24 23 24
+24 24 23 81
+24 87 24 87
+22 23 24 23
+22 87 24 23
+21 24 13
+21 24 13 34
+21 70 24 24
+20 12 1
+20 83 70
+20 70 24 76
+19 23 80
+19 41 24
+19 72 11
+19 80 1
+19 23 80 80
+19 23 81 70
+19 23 81 76
+19 70 24 72
+19 80 1 6
+19 84 87 24
+18 81 23
+18 81 87
+18 41 24 19
+17 70 80
+17 70 80 80
+17 81 70 31
+17 81 80 70
+17 81 87 81
+17 84 87 81
+17 87 81 80
+17 87 81 87
+16 1 13
+16 1 24
+16 23 87
+16 1 13 34
+16 81 23 81
+15 4 82
+15 11 70
+15 72 4
+15 11 70 32
+15 23 81 23
+15 70 72 11
+15 72 4 82
+15 72 11 70
+14 84 24
+14 4 82 24
+14 23 24 24
+13 23 83
+13 23 83 70
+13 83 70 31
+12 23 82
+12 41 13
+12 70 13
+12 78 27
+12 87 78
+12 23 82 24
+12 24 87 78
+12 41 13 34
+12 70 13 34
+12 70 24 87
+12 82 24 76
+12 87 78 27
+11 1 1
+11 17 70
+11 23 12
+11 24 24 23
+11 24 24 70
+11 24 24 87
+11 24 70 24
+10 73 82
+10 80 81
+10 82 24 70
+9 72 72
+9 87 21
+9 23 23 87
+9 23 24 70
+8 2 46
+8 12 23
+8 23 2
+8 23 73
+8 23 106
+8 24 1
+8 24 12
+8 46 84
+8 70 41
+8 82 70
+8 1 24 76
+8 2 46 84
+8 17 70 32
+8 23 2 46
+8 23 23 2
+8 23 23 81
+8 23 70 31
+8 23 70 41
+8 23 87 24
+8 46 84 24
+8 70 24 13
+8 70 41 13
+8 70 72 72
+8 72 23 106
+8 73 82 70
+8 84 24 87
+8 87 24 70
+7 21 24
+7 23 78
+7 84 41
+7 1 1 13
+7 24 23 80
+7 24 87 21
+7 72 24 13
+7 82 70 31
+7 83 70 32
+7 84 41 24
+6 1 70
+6 1 87
+6 2 13
+6 12 24
+6 21 1
+6 23 13
+6 23 31
+6 78 70
+6 81 17
+6 87 84
+6 2 13 34
+6 12 1 87
+6 12 23 24
+6 23 13 34
+6 23 23 31
+6 23 23 70
+6 23 24 87
+6 23 78 70
+6 23 81 17
+6 23 84 41
+6 78 70 31
+6 81 17 70
+5 1 41
+5 11 2
+5 12 60
+5 18 21
+5 24 15
+5 24 41
+5 38 41
+5 60 2
+5 87 87
+5 1 41 24
+5 15 70 31
+5 23 12 1
+5 23 12 23
+5 23 23 12
+5 23 23 13
+5 24 23 23
+5 24 24 41
+5 38 41 24
+5 60 2 13
+5 81 80 80
+4 2 70
+4 11 24
+4 12 86
+4 15 83
+4 21 21
+4 22 12
+4 23 11
+4 23 29
+4 23 72
+4 24 2
+4 24 14
+4 24 22
+4 24 31
+4 24 38
+4 24 73
+4 60 21
+4 81 24
+4 86 24
+4 87 1
+4 87 70
+4 2 70 13
+4 11 2 70
+4 11 24 24
+4 12 1 24
+4 12 60 21
+4 12 86 24
+4 14 19 76
+4 15 83 70
+4 21 1 1
+4 21 21 24
+4 21 24 23
+4 22 12 86
+4 23 1 41
+4 23 11 2
+4 23 23 1
+4 23 23 11
+4 23 23 29
+4 23 24 13
+4 23 24 14
+4 23 24 15
+4 23 72 4
+4 23 73 82
+4 23 81 80
+4 23 84 24
+4 24 1 24
+4 24 12 60
+4 24 14 19
+4 24 15 83
+4 24 22 12
+4 24 23 84
+4 24 24 12
+4 24 24 72
+4 24 38 41
+4 24 41 13
+4 24 72 11
+4 24 87 1
+4 60 21 21
+4 70 70 24
+4 72 11 24
+4 72 24 38
+4 80 80 80
+4 81 70 32
+4 81 70 81
+4 82 24 31
+4 84 24 72
+4 84 87 70
+4 86 24 12
+4 87 21 1
+4 87 24 22
+4 87 70 31
+3 1 84
+3 2 24
+3 2 29
+3 6 81
+3 8 24
+3 20 24
+3 21 18
+3 70 20
+3 72 60
+3 73 8
+3 73 12
+3 81 19
+3 87 77
+3 87 80
+3 1 6 81
+3 1 24 70
+3 1 70 13
+3 1 84 87
+3 1 87 84
+3 2 24 1
+3 6 81 19
+3 8 24 2
+3 12 1 1
+3 12 1 84
+3 12 24 72
+3 17 70 31
+3 18 21 24
+3 20 24 23
+3 21 18 21
+3 21 24 24
+3 23 1 1
+3 23 70 20
+3 23 70 70
+3 23 73 12
+3 24 2 29
+3 24 12 24
+3 24 23 1
+3 24 24 76
+3 24 73 8
+3 70 20 24
+3 72 24 24
+3 72 24 70
+3 72 24 73
+3 72 60 2
+3 72 72 24
+3 72 72 60
+3 73 8 24
+3 73 12 1
+3 80 81 76
+3 81 19 15
+3 81 80 81
+3 84 87 77
+3 87 1 13
+3 87 21 18
+3 87 80 80
+2 1 81
+2 16 80
+2 20 17
+2 21 12
+2 24 83
+2 70 2
+2 70 11
+2 80 12
+2 80 13
+2 80 24
+2 81 12
+2 81 83
+2 83 32
+2 84 70
+2 84 81
+2 87 13
+2 87 60
+2 1 1 70
+2 1 24 24
+2 1 24 87
+2 1 81 24
+2 1 87 87
+2 12 1 81
+2 16 80 80
+2 18 21 1
+2 20 17 70
+2 21 1 13
+2 21 12 1
+2 23 24 1
+2 23 87 21
+2 23 87 84
+2 24 1 13
+2 24 23 70
+2 24 23 87
+2 24 70 32
+2 24 87 87
+2 70 2 24
+2 70 24 23
+2 70 72 24
+2 70 81 76
+2 70 81 80
+2 70 81 83
+2 72 24 72
+2 73 84 70
+2 80 12 24
+2 80 13 34
+2 80 80 13
+2 80 81 70
+2 80 81 80
+2 81 70 13
+2 81 81 81
+2 84 24 83
+2 84 70 81
+2 87 13 34
+2 87 21 12
+2 87 84 24
+1 1 12
+1 1 77
+1 2 81
+1 3 24
+1 3 81
+1 5 85
+1 6 13
+1 6 41
+1 7 13
+1 7 87
+1 11 13
+1 12 3
+1 14 13
+1 14 70
+1 15 31
+1 15 32
+1 19 74
+1 23 7
+1 23 18
+1 23 41
+1 23 88
+1 24 3
+1 24 80
+1 24 81
+1 38 5
+1 40 38
+1 41 7
+1 41 87
+1 60 29
+1 60 31
+1 60 41
+1 70 1
+1 70 14
+1 70 19
+1 70 40
+1 70 60
+1 70 74
+1 72 2
+1 72 12
+1 72 13
+1 72 70
+1 72 80
+1 72 81
+1 78 60
+1 80 19
+1 80 83
+1 81 72
+1 81 73
+1 82 6
+1 82 32
+1 82 81
+1 84 1
+1 84 80
+1 85 24
+1 87 6
+1 87 12
+1 87 29
+1 87 30
+1 87 38
+1 1 1 1
+1 1 1 24
+1 1 12 1
+1 1 24 2
+1 1 70 1
+1 1 70 14
+1 1 70 81
+1 1 87 24
+1 2 81 70
+1 3 24 24
+1 3 81 12
+1 4 82 81
+1 5 85 24
+1 6 13 34
+1 6 41 87
+1 7 13 34
+1 7 87 80
+1 11 2 81
+1 11 13 34
+1 12 1 12
+1 12 1 70
+1 12 3 24
+1 12 23 1
+1 12 23 87
+1 12 24 3
+1 12 24 13
+1 12 24 70
+1 12 60 31
+1 14 13 34
+1 14 70 19
+1 19 14 13
+1 19 15 31
+1 19 15 32
+1 23 1 13
+1 23 1 24
+1 23 1 77
+1 23 7 87
+1 23 12 3
+1 23 18 21
+1 23 23 7
+1 23 23 41
+1 23 23 73
+1 23 41 24
+1 23 70 13
+1 23 70 40
+1 23 70 81
+1 23 73 84
+1 23 78 60
+1 23 81 24
+1 23 87 38
+1 23 87 80
+1 23 87 81
+1 23 87 87
+1 24 1 41
+1 24 1 70
+1 24 2 13
+1 24 3 81
+1 24 12 1
+1 24 15 70
+1 24 24 1
+1 24 41 7
+1 24 70 2
+1 24 70 11
+1 24 70 13
+1 24 70 70
+1 24 70 81
+1 24 73 82
+1 24 80 81
+1 24 81 23
+1 24 83 32
+1 24 83 70
+1 24 87 6
+1 24 87 12
+1 24 87 13
+1 24 87 60
+1 38 5 85
+1 40 38 5
+1 41 7 13
+1 41 24 76
+1 41 87 13
+1 60 41 24
+1 70 1 13
+1 70 11 2
+1 70 11 13
+1 70 14 19
+1 70 19 74
+1 70 24 1
+1 70 40 38
+1 70 60 2
+1 70 70 72
+1 70 70 80
+1 70 72 12
+1 70 72 13
+1 70 72 80
+1 70 81 23
+1 70 81 70
+1 70 81 73
+1 70 81 87
+1 72 2 24
+1 72 12 24
+1 72 13 34
+1 72 23 78
+1 72 23 84
+1 72 23 87
+1 72 23 88
+1 72 70 72
+1 72 72 2
+1 72 72 70
+1 72 72 72
+1 72 80 80
+1 72 81 80
+1 73 82 6
+1 73 82 32
+1 73 84 81
+1 78 60 2
+1 80 19 14
+1 80 24 24
+1 80 24 80
+1 80 80 12
+1 80 80 24
+1 80 80 81
+1 80 81 12
+1 80 81 23
+1 80 81 72
+1 80 83 70
+1 81 12 1
+1 81 12 23
+1 81 23 12
+1 81 23 23
+1 81 24 13
+1 81 24 23
+1 81 24 24
+1 81 24 81
+1 81 70 2
+1 81 70 11
+1 81 70 60
+1 81 70 70
+1 81 70 74
+1 81 72 81
+1 81 73 84
+1 81 80 73
+1 81 81 76
+1 81 83 32
+1 81 83 70
+1 81 87 84
+1 82 6 13
+1 82 70 32
+1 82 81 70
+1 84 1 70
+1 84 80 80
+1 84 81 24
+1 84 81 76
+1 85 24 19
+1 87 1 6
+1 87 6 41
+1 87 12 60
+1 87 24 1
+1 87 24 15
+1 87 24 72
+1 87 24 73
+1 87 24 76
+1 87 38 41
+1 87 60 29
+1 87 60 41
+1 87 81 70
+1 87 84 1
+1 87 84 41
+1 87 84 80
+1 87 84 81
+1 87 87 24
+1 87 87 29
+1 87 87 30
+1 87 87 60
+1 87 87 80
+# libriscv bytecode sequences: count bytecode...
+# config: RISCV_64I RISCV_EXT_COMPRESSED RISCV_EXT_VECTOR
+200043 3 1
+200008 1 37
+200001 3 26
+200001 37 3
+200000 1 37 3
+200000 3 1 37
+200000 37 3 26
+217 24 24
+183 23 23
+141 24 24 24
+118 23 23 23
+81 3 3
+57 23 1
+50 15 1
+49 1 34
+48 1 1
+47 1 24
+39 23 1 34
+35 1 19
+35 1 60
+35 19 19
+35 19 26
+35 1 1 19
+35 1 19 26
+35 15 1 1
+34 23 23 1
+33 2 2
+33 2 31
+33 1 24 24
+32 23 3
+30 19 19 19
+26 3 36
+26 19 25
+26 48 30
+26 50 60
+26 60 19
+26 60 50
+26 1 60 50
+26 3 1 60
+26 50 60 19
+26 60 19 25
+26 60 50 60
+25 23 31
+25 24 21
+25 3 3 1
+23 24 3
+21 3 31
+21 15 26
+20 2 3
+20 3 24
+20 11 31
+19 1 25
+18 3 23
+17 24 24 3
+15 1 31
+15 2 29
+15 3 2
+15 2 2 2
+15 3 3 36
+14 3 30
+14 24 1
+13 1 26
+13 11 3
+13 11 32
+12 12 1
+12 21 24
+12 23 18
+12 23 24
+12 24 2
+12 24 11
+12 37 15
+12 60 60
+12 24 11 3
+12 24 24 11
+11 18 23
+11 24 3 3
+11 24 24 1
+11 37 15 1
+10 1 2
+10 2 35
+10 3 28
+10 23 37
+10 24 23
+10 3 3 3
+10 3 3 24
+10 3 3 31
+9 3 32
+9 16 1
+9 23 11
+9 1 60 60
+9 15 1 26
+9 16 1 24
+9 23 3 23
+9 23 23 3
+9 23 23 18
+9 24 24 21
+8 1 3
+8 1 29
+8 2 23
+8 18 31
+8 21 2
+8 21 36
+8 24 31
+8 3 23 23
+8 3 24 21
+8 11 3 3
+8 24 1 29
+8 24 21 36
+7 3 27
+7 3 35
+7 23 60
+7 24 35
+7 24 36
+7 37 32
+7 46 37
+7 65 2
+7 3 23 1
+7 24 24 23
+6 1 11
+6 1 35
+6 1 36
+6 2 46
+6 2 106
+6 11 11
+6 12 12
+6 18 24
+6 20 20
+6 21 23
+6 23 2
+6 37 38
+6 38 24
+6 60 29
+6 60 30
+6 1 11 31
+6 1 37 15
+6 2 46 37
+6 15 1 60
+6 18 23 60
+6 21 23 23
+6 23 3 1
+6 23 24 24
+6 46 37 15
+6 60 60 30
+5 1 12
+5 2 24
+5 2 30
+5 2 34
+5 3 34
+5 4 8
+5 4 13
+5 12 24
+5 13 37
+5 16 3
+5 17 11
+5 18 3
+5 18 18
+5 19 34
+5 21 21
+5 24 26
+5 37 21
+5 37 24
+5 38 4
+5 38 38
+5 60 1
+5 60 24
+5 60 35
+5 60 65
+5 64 24
+5 65 27
+5 65 37
+5 1 2 2
+5 2 3 36
+5 2 23 23
+5 3 1 25
+5 3 1 31
+5 3 2 2
+5 3 2 3
+5 3 3 32
+5 4 13 37
+5 11 11 31
+5 18 3 30
+5 18 18 3
+5 19 19 34
+5 21 24 35
+5 23 1 24
+5 23 3 2
+5 23 18 18
+5 23 18 24
+5 23 23 24
+5 23 37 38
+5 23 60 65
+5 24 21 2
+5 24 21 24
+5 24 24 2
+5 24 24 31
+5 37 21 24
+5 37 38 38
+5 38 24 26
+5 38 38 24
+5 60 24 24
+5 60 65 37
+5 65 2 31
+5 65 37 21
+4 1 38
+4 2 1
+4 2 27
+4 2 32
+4 4 37
+4 13 1
+4 16 32
+4 18 1
+4 24 37
+4 24 60
+4 24 65
+4 37 18
+4 37 30
+4 37 34
+4 44 20
+4 64 27
+4 2 3 30
+4 3 24 24
+4 3 24 36
+4 11 3 31
+4 13 37 34
+4 20 20 20
+4 23 3 31
+4 24 2 106
+4 24 3 24
+4 38 4 13
+4 60 1 26
+3 1 18
+3 1 23
+3 1 27
+3 2 36
+3 2 37
+3 2 60
+3 8 23
+3 8 24
+3 11 1
+3 11 2
+3 11 23
+3 11 37
+3 15 3
+3 15 64
+3 16 35
+3 17 30
+3 18 34
+3 20 21
+3 20 36
+3 21 1
+3 21 31
+3 23 12
+3 23 15
+3 23 36
+3 24 8
+3 24 10
+3 24 32
+3 37 23
+3 37 60
+3 44 60
+3 60 23
+3 1 1 34
+3 1 12 24
+3 1 24 8
+3 2 1 27
+3 2 2 24
+3 2 2 31
+3 2 2 35
+3 2 23 1
+3 2 24 24
+3 3 1 34
+3 3 2 31
+3 3 24 2
+3 4 8 23
+3 8 23 37
+3 8 24 24
+3 11 23 31
+3 12 1 1
+3 12 1 18
+3 12 12 1
+3 12 24 24
+3 15 64 24
+3 16 3 3
+3 17 11 32
+3 18 1 24
+3 18 24 37
+3 21 2 1
+3 21 21 1
+3 21 24 21
+3 23 1 1
+3 23 1 3
+3 23 1 35
+3 23 3 3
+3 23 3 34
+3 23 15 64
+3 23 23 31
+3 23 24 21
+3 23 37 18
+3 24 2 3
+3 24 3 1
+3 24 8 24
+3 24 21 21
+3 24 21 23
+3 24 37 60
+3 37 18 34
+3 37 60 24
+3 44 60 1
+3 60 23 23
+3 60 60 29
+3 60 60 60
+3 64 24 31
+2 1 15
+2 1 21
+2 1 30
+2 1 45
+2 2 15
+2 2 18
+2 2 19
+2 3 15
+2 3 106
+2 7 45
+2 9 31
+2 11 24
+2 11 26
+2 12 3
+2 12 11
+2 15 19
+2 15 23
+2 15 24
+2 16 11
+2 17 17
+2 17 18
+2 18 12
+2 18 27
+2 18 37
+2 18 44
+2 18 61
+2 19 1
+2 20 23
+2 20 28
+2 21 27
+2 23 21
+2 23 25
+2 23 30
+2 23 35
+2 23 42
+2 23 64
+2 24 12
+2 24 34
+2 37 7
+2 37 31
+2 37 106
+2 38 31
+2 42 37
+2 45 25
+2 45 45
+2 60 3
+2 60 26
+2 60 31
+2 61 44
+2 64 21
+2 65 3
+2 65 26
+2 1 1 1
+2 1 1 24
+2 1 1 30
+2 1 1 38
+2 1 2 24
+2 1 3 3
+2 1 3 15
+2 1 3 24
+2 1 3 36
+2 1 18 44
+2 1 23 11
+2 1 24 3
+2 1 24 12
+2 1 37 23
+2 2 2 3
+2 2 2 18
+2 2 3 1
+2 2 3 2
+2 2 3 31
+2 2 3 106
+2 2 15 19
+2 2 37 106
+2 3 2 30
+2 3 3 2
+2 3 3 35
+2 3 15 26
+2 3 23 64
+2 7 45 45
+2 11 1 31
+2 11 2 3
+2 11 24 65
+2 12 24 1
+2 15 3 28
+2 15 19 1
+2 15 23 31
+2 17 17 18
+2 17 18 23
+2 18 23 23
+2 18 24 24
+2 18 37 24
+2 18 44 20
+2 18 61 44
+2 19 1 2
+2 20 20 21
+2 20 21 21
+2 20 23 23
+2 21 1 36
+2 21 2 2
+2 21 2 27
+2 21 21 23
+2 21 24 24
+2 23 11 1
+2 23 11 2
+2 23 11 24
+2 23 18 61
+2 23 21 31
+2 23 23 11
+2 23 24 3
+2 23 37 32
+2 23 42 37
+2 23 64 24
+2 24 1 2
+2 24 1 21
+2 24 2 29
+2 24 3 32
+2 24 12 12
+2 24 23 1
+2 24 23 2
+2 24 23 23
+2 24 23 24
+2 24 24 34
+2 24 24 60
+2 24 24 65
+2 24 60 24
+2 24 60 26
+2 24 65 2
+2 24 65 3
+2 37 7 45
+2 37 23 1
+2 37 24 60
+2 42 37 7
+2 44 20 20
+2 44 20 28
+2 45 45 25
+2 60 3 3
+2 61 44 20
+2 64 24 32
+2 65 2 32
+2 65 3 35
+1 1 4
+1 1 13
+1 1 65
+1 1 104
+1 2 8
+1 2 16
+1 2 21
+1 2 25
+1 2 26
+1 2 28
+1 2 39
+1 2 65
+1 3 21
+1 3 29
+1 4 12
+1 4 27
+1 4 60
+1 6 2
+1 7 29
+1 8 2
+1 8 3
+1 8 31
+1 8 46
+1 8 60
+1 10 3
+1 10 20
+1 10 23
+1 10 24
+1 10 60
+1 10 61
+1 10 64
+1 11 4
+1 11 7
+1 11 10
+1 11 18
+1 11 29
+1 11 38
+1 12 23
+1 12 38
+1 12 44
+1 12 45
+1 12 61
+1 15 2
+1 15 11
+1 15 31
+1 15 38
+1 16 4
+1 16 20
+1 16 23
+1 16 31
+1 18 2
+1 18 21
+1 18 45
+1 18 60
+1 18 64
+1 18 104
+1 19 2
+1 19 23
+1 20 24
+1 21 3
+1 21 11
+1 21 32
+1 21 35
+1 21 37
+1 23 4
+1 23 16
+1 23 17
+1 23 20
+1 23 26
+1 23 28
+1 23 32
+1 23 104
+1 24 9
+1 24 15
+1 24 25
+1 24 29
+1 24 38
+1 37 1
+1 37 2
+1 37 4
+1 37 17
+1 37 28
+1 37 37
+1 37 44
+1 38 2
+1 38 6
+1 38 9
+1 38 29
+1 38 37
+1 38 60
+1 39 29
+1 44 12
+1 44 23
+1 44 25
+1 44 44
+1 45 12
+1 45 16
+1 45 20
+1 45 37
+1 45 60
+1 48 60
+1 50 2
+1 60 2
+1 60 4
+1 60 21
+1 60 27
+1 60 32
+1 60 37
+1 60 48
+1 60 61
+1 61 1
+1 61 60
+1 61 104
+1 65 21
+1 65 31
+1 65 35
+1 104 2
+1 104 11
+1 104 18
+1 104 35
+1 104 45
+1 1 1 12
+1 1 1 13
+1 1 2 3
+1 1 2 23
+1 1 2 36
+1 1 4 60
+1 1 12 3
+1 1 12 11
+1 1 13 1
+1 1 15 3
+1 1 15 24
+1 1 18 64
+1 1 21 2
+1 1 21 24
+1 1 23 23
+1 1 24 1
+1 1 24 2
+1 1 24 10
+1 1 24 15
+1 1 24 23
+1 1 24 35
+1 1 24 36
+1 1 38 2
+1 1 38 9
+1 1 38 24
+1 1 38 37
+1 1 45 16
+1 1 45 37
+1 1 65 35
+1 1 104 45
+1 2 1 3
+1 2 2 26
+1 2 2 32
+1 2 2 36
+1 2 2 60
+1 2 2 106
+1 2 3 21
+1 2 3 26
+1 2 3 29
+1 2 8 2
+1 2 16 11
+1 2 18 23
+1 2 18 60
+1 2 19 2
+1 2 19 23
+1 2 21 23
+1 2 24 21
+1 2 24 36
+1 2 37 37
+1 2 39 29
+1 2 60 2
+1 2 60 31
+1 2 60 48
+1 2 65 21
+1 3 1 2
+1 3 1 12
+1 3 1 15
+1 3 1 38
+1 3 3 23
+1 3 3 34
+1 3 21 2
+1 3 23 3
+1 3 24 3
+1 4 8 3
+1 4 8 46
+1 4 12 1
+1 4 37 2
+1 4 37 4
+1 4 37 23
+1 4 37 31
+1 4 60 21
+1 6 2 1
+1 8 2 32
+1 8 3 3
+1 8 46 37
+1 8 60 61
+1 10 3 24
+1 10 20 24
+1 10 23 24
+1 10 24 37
+1 10 60 35
+1 10 61 104
+1 10 64 21
+1 11 1 34
+1 11 2 25
+1 11 3 32
+1 11 4 37
+1 11 7 29
+1 11 10 61
+1 11 11 37
+1 11 18 31
+1 11 37 1
+1 11 37 24
+1 11 37 32
+1 11 38 29
+1 12 1 24
+1 12 1 31
+1 12 1 35
+1 12 1 36
+1 12 1 37
+1 12 1 45
+1 12 3 1
+1 12 3 24
+1 12 11 7
+1 12 11 37
+1 12 12 12
+1 12 12 24
+1 12 12 45
+1 12 23 12
+1 12 38 6
+1 12 44 12
+1 12 45 12
+1 12 61 1
+1 13 1 1
+1 13 1 31
+1 13 1 36
+1 13 1 38
+1 13 37 3
+1 15 2 31
+1 15 3 1
+1 15 11 26
+1 15 24 21
+1 15 24 32
+1 15 38 31
+1 16 3 27
+1 16 3 36
+1 16 4 27
+1 16 11 26
+1 16 11 31
+1 16 20 23
+1 16 23 35
+1 17 11 10
+1 17 11 31
+1 18 1 2
+1 18 2 27
+1 18 12 12
+1 18 12 44
+1 18 21 2
+1 18 23 28
+1 18 23 32
+1 18 23 104
+1 18 24 10
+1 18 45 60
+1 18 60 27
+1 18 64 21
+1 18 104 18
+1 19 2 31
+1 19 23 23
+1 20 21 11
+1 20 24 24
+1 21 1 2
+1 21 2 65
+1 21 3 32
+1 21 11 31
+1 21 24 2
+1 21 24 25
+1 21 37 24
+1 23 1 12
+1 23 1 31
+1 23 1 36
+1 23 1 45
+1 23 2 16
+1 23 2 21
+1 23 2 23
+1 23 2 31
+1 23 2 35
+1 23 2 37
+1 23 3 24
+1 23 3 36
+1 23 4 37
+1 23 11 18
+1 23 11 29
+1 23 11 31
+1 23 12 1
+1 23 12 12
+1 23 12 24
+1 23 16 4
+1 23 17 11
+1 23 20 23
+1 23 23 2
+1 23 23 4
+1 23 23 36
+1 23 24 23
+1 23 60 1
+1 23 60 31
+1 23 104 11
+1 24 1 1
+1 24 1 15
+1 24 2 28
+1 24 2 34
+1 24 2 37
+1 24 3 31
+1 24 3 35
+1 24 3 36
+1 24 9 31
+1 24 10 3
+1 24 10 20
+1 24 10 64
+1 24 15 24
+1 24 21 32
+1 24 23 3
+1 24 23 30
+1 24 24 9
+1 24 24 29
+1 24 24 36
+1 24 24 38
+1 24 37 24
+1 24 38 31
+1 37 1 23
+1 37 2 35
+1 37 3 34
+1 37 4 37
+1 37 15 11
+1 37 17 30
+1 37 18 24
+1 37 23 23
+1 37 24 2
+1 37 24 10
+1 37 24 24
+1 37 37 31
+1 37 38 4
+1 37 44 44
+1 38 2 36
+1 38 4 8
+1 38 6 2
+1 38 9 31
+1 38 24 24
+1 38 37 30
+1 38 60 37
+1 44 12 61
+1 44 23 20
+1 44 44 25
+1 45 12 38
+1 45 16 20
+1 45 20 21
+1 45 37 44
+1 45 60 32
+1 46 37 17
+1 48 60 29
+1 50 2 60
+1 60 1 34
+1 60 2 2
+1 60 4 12
+1 60 21 37
+1 60 37 18
+1 60 48 60
+1 60 61 60
+1 61 1 104
+1 61 60 4
+1 61 104 35
+1 64 21 3
+1 64 21 24
+1 65 21 31
+1 104 2 39
+1 104 11 1
+1 104 18 45
+1 104 45 20
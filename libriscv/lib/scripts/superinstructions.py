@@ -0,0 +1,271 @@
+#!/usr/bin/env python3
+#
+# Generate superinstructions for the threaded dispatcher from
+# bytecode sequence profiles, which are written by emulators built
+# with RISCV_RECORD_BYTECODES (eg. rvlinux --bytecodes file).
+#
+# The most profitable pairs and triples of bytecodes are turned into
+# fused handlers, made by joining the handlers in bytecode_impl.cpp:
+#   threaded_superinstructions.hpp:  the table (an X-macro)
+#   bytecode_superinstructions.cpp:  the fused handlers
+#
+import argparse
+import os
+import re
+
+CONTROL = re.compile(r'\b(NEXT_\w+|EXECUTE_\w+|PERFORM_\w+|OVERFLOW_\w+|UNCHECKED_JUMP|UNUSED_FUNCTION|goto|return)\b')
+STRAIGHT_END = re.compile(r'(NEXT_C?_?INSTR)\(\);\s*$')
+WIDE_BEGIN = re.compile(r'^if constexpr \(W >= 8\) \{')
+# These handlers modify the decoder cache, or end the block without branching
+EXCLUDED = {'RV32I_BC_LIVEPATCH', 'RV32I_BC_FUNCBLOCK'}
+MAX_BYTECODES = 256
+
+def matching_brace(text, begin):
+	depth = 0
+	for i in range(begin, len(text)):
+		if text[i] == '{':
+			depth += 1
+		elif text[i] == '}':
+			depth -= 1
+			if depth == 0:
+				return i
+	raise ValueError("Unbalanced braces")
+
+def parse_conditional(line, stack):
+	line = line.strip()
+	if line.startswith('#ifdef'):
+		stack.append(line.split()[1])
+	elif line.startswith('#ifndef') or line.startswith('#if'):
+		stack.append(None)
+	elif line.startswith('#else'):
+		stack[-1] = None
+	elif line.startswith('#endif'):
+		stack.pop()
+
+def parse_enum(path):
+	"Bytecode names in order, with the defines they depend on"
+	text = open(path).read()
+	begin = text.index('enum')
+	end = text.index('BYTECODES_MAX', begin)
+	bytecodes = []
+	stack = []
+	for line in text[begin:end].splitlines():
+		if line.strip().startswith('#'):
+			parse_conditional(line, stack)
+			continue
+		m = re.match(r'\s*(RV\w+)\s*(=\s*0)?\s*,', line)
+		if m:
+			bytecodes.append((m.group(1), tuple(stack)))
+	return bytecodes
+
+def parse_labels(path):
+	"Bytecode to label, from the computed goto table"
+	labels = {}
+	for m in re.finditer(r'\[(RV\w+)\]\s*=\s*&&(\w+)', open(path).read()):
+		labels[m.group(1)] = m.group(2)
+	return labels
+
+def parse_handlers(path):
+	"Label to handler body, from the shared bytecode implementations"
+	text = open(path).read()
+	handlers = {}
+	for m in re.finditer(r'^INSTRUCTION\((\w+),\s*(\w+)\)\s*', text, re.MULTILINE):
+		begin = text.index('{', m.end() - 1)
+		end = matching_brace(text, begin)
+		handlers[m.group(2)] = text[begin+1:end]
+	return handlers
+
+def dedent(body):
+	lines = [l.rstrip() for l in body.strip('\n').splitlines()]
+	lines = [l for l in lines if l.strip()]
+	if not lines:
+		return []
+	indent = min(len(l) - len(l.lstrip('\t')) for l in lines)
+	return [l[indent:] for l in lines]
+
+class Handler:
+	def __init__(self, name, body):
+		self.name = name
+		self.body = body
+		self.usable = '#' not in body
+		# The body without a W >= 8 wrapper, and its straight-line part
+		# which can continue into another handler
+		self.unwrapped = body
+		self.inner = None
+		self.step = None
+		self.wide = False
+		self.wide_only = False
+		if WIDE_BEGIN.match(body.strip()):
+			begin = body.index('{')
+			close = matching_brace(body, begin)
+			rest = body[close+1:].strip()
+			if rest == 'else UNUSED_FUNCTION();' or rest.startswith('else {'):
+				self.wide = True
+				self.wide_only = rest == 'else UNUSED_FUNCTION();'
+				# Skip the rest of the if-line, which may be a comment
+				self.unwrapped = body[begin+1:close].partition('\n')[2]
+		m = STRAIGHT_END.search(self.unwrapped)
+		if self.usable and m and len(CONTROL.findall(self.unwrapped)) == 1:
+			self.inner = self.unwrapped[:m.start()]
+			self.step = m.group(1)
+
+def load_profiles(paths, bytecodes):
+	"Sum the profiles, weighting each recording (config section) the same"
+	sections = []
+	for path in paths:
+		for line in open(path):
+			line = line.strip()
+			if line.startswith('# config:'):
+				enabled = set(line[len('# config:'):].split())
+				numbered = [name for name, guard in bytecodes
+					if all(g is None or g in enabled for g in guard)]
+				sections.append({})
+				continue
+			if not line or line.startswith('#'):
+				continue
+			if not sections:
+				raise ValueError("Profile " + path + " has no config line")
+			fields = [int(f) for f in line.split()]
+			if any(f >= len(numbered) for f in fields[1:]):
+				continue
+			seq = tuple(numbered[f] for f in fields[1:])
+			sections[-1][seq] = sections[-1].get(seq, 0) + fields[0]
+	counts = {}
+	for section in sections:
+		total = sum(count for seq, count in section.items() if len(seq) == 2)
+		for seq, count in section.items():
+			counts[seq] = counts.get(seq, 0) + count * 1000000 // max(total, 1)
+	return counts
+
+def overlaps(a, b):
+	"True when b can begin inside of a"
+	for i in range(1, len(a)):
+		n = min(len(a) - i, len(b))
+		if a[i:i+n] == b[:n]:
+			return True
+	return False
+
+def select(counts, handlers, labels, limit):
+	"Greedily pick the sequences that save the most dispatches"
+	def handler(name):
+		return handlers.get(labels.get(name))
+	candidates = []
+	for seq, count in counts.items():
+		hs = [handler(name) for name in seq]
+		if any(name in EXCLUDED for name in seq):
+			continue
+		if any(h is None or not h.usable for h in hs):
+			continue
+		if any(h.inner is None for h in hs[:-1]):
+			continue
+		candidates.append(seq)
+	chosen = []
+	while len(chosen) < limit:
+		best, best_score = None, 0
+		for seq in candidates:
+			if seq in chosen:
+				continue
+			# The decoder fuses from left to right, so a sequence that begins
+			# inside a chosen one (or the other way around) is mostly lost.
+			count = counts[seq]
+			count -= sum(min(counts[c], counts[seq]) for c in chosen
+				if c[:2] != seq[:2] and (overlaps(c, seq) or overlaps(seq, c)))
+			# A longer match is preferred by the decoder, so a pair only
+			# wins where none of the chosen triples beginning with it do.
+			if len(seq) == 2:
+				count -= sum(counts[c] for c in chosen if len(c) == 3 and c[:2] == seq)
+				score = count
+			else:
+				score = 2 * count - (count if seq[:2] in chosen else 0)
+			if score > best_score:
+				best, best_score = seq, score
+		if best is None:
+			break
+		chosen.append(best)
+	return chosen
+
+def short_name(name):
+	prefix, _, rest = name.partition('_BC_')
+	return ('C_' + rest) if prefix == 'RV32C' else rest
+
+def generate(chosen, bytecodes, handlers, labels, profiles):
+	guards = dict(bytecodes)
+	header = ("/**\n"
+		" * Generated by scripts/superinstructions.py from {}.\n"
+		" * Do not edit, regenerate with the generate_superinstructions target.\n"
+		"**/\n").format(', '.join(os.path.basename(p) for p in profiles))
+	table = [header,
+		"// SUPERINSTRUCTION(bytecode, label, length, op1, op2, op3, compressed_mask)\n"]
+	impl = [header]
+	for seq in chosen:
+		name = 'RV32I_BC_FUSED_' + '_'.join(short_name(s) for s in seq)
+		label = 'fused_' + '_'.join(short_name(s) for s in seq).lower()
+		hs = [handlers[labels[s]] for s in seq]
+		defines = sorted(set(g for s in seq for g in guards[s] if g is not None))
+		cond = ' && '.join('defined({})'.format(d) for d in defines)
+		# Bit N: element N steps one decoder entry
+		mask = sum(1 << n for n, h in enumerate(hs[:-1]) if h.step == 'NEXT_C_INSTR')
+		ops = list(seq) + ['RV32I_BC_INVALID'] * (3 - len(seq))
+
+		if cond:
+			table.append('#if {}\n'.format(cond))
+		table.append('SUPERINSTRUCTION({}, {}, {}, {}, 0x{:x})\n'.format(
+			name, label, len(seq), ', '.join(ops), mask))
+		if cond:
+			table.append('#endif\n')
+
+		wide = any(h.wide for h in hs[:-1]) or hs[-1].wide_only
+		indent = '\t\t' if wide else '\t'
+		lines = ['INSTRUCTION({}, {}) {{'.format(name, label)]
+		if wide:
+			lines.append('\tif constexpr (W >= 8) {')
+		for n, h in enumerate(hs):
+			last = n + 1 == len(hs)
+			if last:
+				body = h.unwrapped if h.wide_only else h.body
+			else:
+				body = h.inner
+			lines.append(indent + '{')
+			lines += [indent + '\t' + l for l in dedent(body)]
+			lines.append(indent + '}')
+			if not last:
+				step = 'NEXT_FUSED_C_INSTR' if h.step == 'NEXT_C_INSTR' else 'NEXT_FUSED_INSTR'
+				lines.append(indent + '{}({});'.format(step, seq[n+1]))
+		if wide:
+			lines.append('\t}')
+			lines.append('\telse UNUSED_FUNCTION();')
+		lines.append('}')
+		if cond:
+			impl.append('#if {}\n'.format(cond))
+		impl.append('\n'.join(lines) + '\n')
+		if cond:
+			impl.append('#endif\n')
+	return ''.join(table), ''.join(impl)
+
+def main():
+	parser = argparse.ArgumentParser(description="Generate superinstructions from bytecode profiles")
+	parser.add_argument('--profile', action='append', required=True, help="Bytecode sequence profile (repeatable)")
+	parser.add_argument('--count', type=int, default=24, help="Number of superinstructions")
+	parser.add_argument('--source', default=os.path.join(os.path.dirname(__file__), '..', 'libriscv'),
+		help="The libriscv source directory")
+	args = parser.parse_args()
+
+	src = args.source
+	bytecodes = parse_enum(os.path.join(src, 'threaded_bytecodes.hpp'))
+	labels = parse_labels(os.path.join(src, 'threaded_bytecode_array.hpp'))
+	handlers = {label: Handler(label, body) for label, body in
+		parse_handlers(os.path.join(src, 'bytecode_impl.cpp')).items()}
+	# Leave room for every bytecode in the largest configuration
+	limit = min(args.count, MAX_BYTECODES - len(bytecodes) - 1)
+
+	counts = load_profiles(args.profile, bytecodes)
+	chosen = select(counts, handlers, labels, limit)
+	table, impl = generate(chosen, bytecodes, handlers, labels, args.profile)
+	with open(os.path.join(src, 'threaded_superinstructions.hpp'), 'w') as f:
+		f.write(table)
+	with open(os.path.join(src, 'bytecode_superinstructions.cpp'), 'w') as f:
+		f.write(impl)
+	print("Generated {} superinstructions from {} sequences".format(len(chosen), len(counts)))
+
+if __name__ == '__main__':
+	main()
@@ -1,4 +1,5 @@
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <libriscv/common.hpp>
 #include <libriscv/native_heap.hpp>
 #include <vector>
@@ -152,3 +153,73 @@ TEST_CASE("Allocate too many chunks", "[Heap]")
 		arena.malloc(4);
 	}());
 }
+
+TEST_CASE("Small allocations use slabs", "[Heap]")
+{
+	riscv::Arena arena {BEGIN, END};
+	std::vector<Allocation> allocs;
+	for (int i = 0; i < 4000; i++) {
+		const size_t size = randInt(0, riscv::Arena::MAX_SLAB_OBJECT);
+		const uintptr_t addr = arena.malloc(size);
+		REQUIRE(IS_WITHIN(addr));
+		REQUIRE(addr % riscv::Arena::ALIGNMENT == 0);
+		REQUIRE(arena.size(addr) >= size);
+		allocs.push_back({addr, arena.size(addr)});
+	}
+	REQUIRE(arena.slabs_used() > 0);
+	// Each slab is a single chunk, instead of one chunk per allocation
+	REQUIRE(arena.chunks_used() <= arena.slabs_used() + 1);
+
+	// Double-free is detected
+	const auto victim = allocs.back();
+	allocs.pop_back();
+	REQUIRE(arena.free(victim.addr) == 0);
+	REQUIRE(arena.size(victim.addr) == 0);
+	REQUIRE(arena.free(victim.addr) == -1);
+
+	// Small objects are moved when grown past their size class
+	auto [grown, old_len] = arena.realloc(allocs.back().addr, 4000);
+	REQUIRE(grown != allocs.back().addr);
+	REQUIRE(old_len == allocs.back().size);
+	REQUIRE(arena.size(allocs.back().addr) == 0);
+	allocs.back() = {grown, arena.size(grown)};
+
+	// A copy of the arena has the same allocations
+	riscv::Arena copy { arena };
+	REQUIRE(copy.bytes_used() == arena.bytes_used());
+	for (auto entry : allocs) {
+		REQUIRE(copy.size(entry.addr) == entry.size);
+		REQUIRE(copy.free(entry.addr) == 0);
+	}
+	REQUIRE(copy.bytes_used() == 0);
+	REQUIRE(copy.bytes_free() == END - BEGIN);
+	// The original is unchanged
+	for (auto entry : allocs) {
+		REQUIRE(arena.size(entry.addr) == entry.size);
+	}
+}
+
+TEST_CASE("Heap benchmark", "[Heap][.benchmark]")
+{
+	// Replace random allocations in a working set, like a
+	// garbage-collected or allocation-heavy guest would
+	const auto churn = [] (riscv::Arena& arena, std::vector<uint64_t>& live, int max_size) {
+		for (int i = 0; i < 1000; i++) {
+			auto& addr = live.at(randUpto(live.size()));
+			REQUIRE(arena.free(addr) == 0);
+			addr = arena.malloc(randInt(0, max_size));
+		}
+	};
+	for (const int max_size : {256, 8000})
+	{
+		riscv::Arena arena {BEGIN, END};
+		std::vector<uint64_t> live;
+		for (int i = 0; i < 2000; i++)
+			live.push_back(arena.malloc(randInt(0, max_size)));
+
+		BENCHMARK("Working set up to " + std::to_string(max_size) + " bytes") {
+			churn(arena, live, max_size);
+			return arena.chunks_used();
+		};
+	}
+}
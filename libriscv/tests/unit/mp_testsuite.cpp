@@ -9,6 +9,7 @@ static const std::string cwd {SRCDIR};
 using namespace riscv;
 static uint64_t stack_base = 0x0;
 static uint64_t stack_size = 1ul << 20;
+static const unsigned MP_TASK_WORKERS = 4;
 
 static void install_multiprocessing_syscalls()
 {
@@ -32,6 +33,17 @@ static void install_multiprocessing_syscalls()
 			machine.stop();
 		}
 	});
+	Machine<RISCV64>::install_syscall_handler(11,
+	[] (Machine<RISCV64>& machine) {
+		auto [func, arg] = machine.sysargs <uint64_t, uint64_t> ();
+		machine.multiprocess_submit(func, {arg});
+	});
+	Machine<RISCV64>::install_syscall_handler(12,
+	[] (Machine<RISCV64>& machine) {
+		auto [counter] = machine.sysargs <uint64_t> ();
+		machine.set_result(machine.multiprocess_tasks(MP_TASK_WORKERS,
+			MAX_INSTRUCTIONS, stack_base, stack_size, counter));
+	});
 	Machine<RISCV64>::install_syscall_handler(10,
 	[] (Machine<RISCV64>& machine) {
 		auto buffer = machine.sysarg<std::string>(0);
@@ -158,3 +170,53 @@ TEST_CASE("Multiprocessing dot-product forever", "[Compute]")
 
 	REQUIRE(machine.return_value() == 0);
 }
+
+TEST_CASE("Multiprocessing work-stealing tasks", "[Compute]")
+{
+	const auto binary = build_and_load(R"M(
+	#include <cassert>
+	#include "mp_testsuite.hpp"
+	static long task_sum = 0;
+	static unsigned task_counter = 0;
+
+	// Tasks of very different sizes, where the small
+	// ones also submit a task from inside a worker
+	static void task(long n)
+	{
+		volatile long spin = n * 1000;
+		while (spin > 0) spin = spin - 1;
+		__sync_fetch_and_add(&task_sum, n);
+		if (n < 8)
+			multiprocess_submit(task, n + 1000);
+	}
+
+	int main()
+	{
+		for (long n = 0; n < 64; n++)
+			multiprocess_submit(task, n);
+		long result = multiprocess_tasks(&task_counter);
+		assert(result == 0);
+
+		// Verify results
+		assert(task_counter == 64 + 8);
+		assert(task_sum == 2016 + 8028);
+		return task_sum;
+	})M", "-O2 -static -I" + cwd, true);
+
+	Machine<RISCV64> machine { binary };
+	machine.setup_linux_syscalls();
+	install_multiprocessing_syscalls();
+	machine.setup_linux(
+		{"multiprocessing_tasks"},
+		{"LC_TYPE=C", "LC_ALL=C", "USER=groot"});
+
+	// Discover stack
+	stack_base = machine.memory.stack_initial() - stack_size;
+
+	// Run for at most X instructions before giving up
+	machine.simulate(MAX_INSTRUCTIONS);
+
+	REQUIRE(!machine.is_multiprocessing());
+
+	REQUIRE(machine.return_value<long>() == 10044);
+}
@@ -92,6 +92,25 @@ inline long multiprocess_wait()
 	asm volatile ("ecall" : "=r"(a0) : "r"(sid) : "memory");
 	return a0;
 }
+// Queue a call to func(arg) for multiprocess_tasks()
+inline void multiprocess_submit(void (*func)(long), long arg)
+{
+	register void (*a0)(long) asm("a0") = func;
+	register long      a1 asm("a1") = arg;
+	register int      sid asm("a7") = 11;
+
+	asm volatile ("ecall" : : "r"(a0), "r"(a1), "r"(sid) : "memory");
+}
+// Run every queued task, counting them in *counter
+inline long multiprocess_tasks(unsigned* counter)
+{
+	register unsigned* a0_in  asm("a0") = counter;
+	register long      a0_out asm("a0");
+	register int       sid    asm("a7") = 12;
+
+	asm volatile ("ecall" : "=r"(a0_out) : "r"(a0_in), "r"(sid) : "memory");
+	return a0_out;
+}
 inline long sys_write(const char* buf)
 {
 	register const char* a0_in  asm("a0") = buf;
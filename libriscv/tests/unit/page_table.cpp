@@ -0,0 +1,116 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <libriscv/machine.hpp>
+#include <libriscv/page_table.hpp>
+#include <map>
+#include <random>
+using namespace riscv;
+
+template <int W>
+static std::vector<address_type<W>> scattered_keys(size_t count, address_type<W> mask)
+{
+	std::mt19937_64 rng { 1234 };
+	std::vector<address_type<W>> keys;
+	for (size_t i = 0; i < count; i++)
+		keys.push_back(address_type<W>(rng()) & mask);
+	return keys;
+}
+
+TEST_CASE("Radix page table matches unordered_map", "[PageTable]")
+{
+	RadixPageTable<RISCV64> radix;
+	std::unordered_map<address_type<RISCV64>, Page> map;
+	// Include page numbers above 48-bit addresses, which overflow the tree
+	auto keys = scattered_keys<RISCV64>(4000, 0xFFFFFFFFF);
+	keys.push_back(1ull << 40);
+	keys.push_back(0xFFFFFFFFFFFFF);
+	keys.push_back(0);
+
+	for (auto key : keys) {
+		auto res1 = radix.try_emplace(key, PageAttributes{}, PageData::INITIALIZED);
+		auto res2 = map.try_emplace(key, PageAttributes{}, PageData::INITIALIZED);
+		REQUIRE(res1.second == res2.second);
+		REQUIRE(res1.first->first == key);
+		res1.first->second.page().buffer8[0] = uint8_t(key);
+	}
+	REQUIRE(radix.size() == map.size());
+
+	for (auto key : keys) {
+		auto it = radix.find(key);
+		REQUIRE(it != radix.end());
+		REQUIRE(it->second.page().buffer8[0] == uint8_t(key));
+	}
+	REQUIRE(radix.find(0x123456789) == radix.end());
+
+	// Tree pages are visited in ascending order, then the overflow pages
+	std::map<address_type<RISCV64>, bool> visited;
+	address_type<RISCV64> last = 0;
+	bool in_overflow = false;
+	for (auto& it : radix) {
+		const bool overflow = (it.first >> RadixPageTable<RISCV64>::TREE_BITS) != 0;
+		if (!overflow) {
+			REQUIRE(!in_overflow);
+			REQUIRE((visited.empty() || it.first > last));
+			last = it.first;
+		}
+		in_overflow = overflow;
+		REQUIRE(visited.emplace(it.first, true).second);
+	}
+	REQUIRE(visited.size() == map.size());
+
+	// Erase every other page
+	for (size_t i = 0; i < keys.size(); i += 2) {
+		REQUIRE(radix.erase(keys[i]) == map.erase(keys[i]));
+	}
+	REQUIRE(radix.size() == map.size());
+	for (auto key : keys) {
+		REQUIRE(radix.count(key) == map.count(key));
+	}
+
+	radix.clear();
+	REQUIRE(radix.empty());
+	REQUIRE(radix.begin() == radix.end());
+}
+
+TEST_CASE("Radix page table covers 32-bit address space", "[PageTable]")
+{
+	RadixPageTable<RISCV32> radix;
+	radix.try_emplace(0xFFFFF, PageAttributes{}, PageData::INITIALIZED);
+	radix.try_emplace(0x0, PageAttributes{}, PageData::INITIALIZED);
+	radix.try_emplace(0x80000, PageAttributes{}, PageData::INITIALIZED);
+
+	std::vector<address_type<RISCV32>> order;
+	for (auto& it : radix)
+		order.push_back(it.first);
+	const std::vector<address_type<RISCV32>> expected { 0x0, 0x80000, 0xFFFFF };
+	REQUIRE(order == expected);
+
+	REQUIRE(radix.erase(0x80000) == 1);
+	REQUIRE(radix.erase(0x80000) == 0);
+	REQUIRE(radix.size() == 2);
+}
+
+TEST_CASE("Radix page table lookup benchmark", "[PageTable][.benchmark]")
+{
+	RadixPageTable<RISCV64> radix;
+	std::unordered_map<address_type<RISCV64>, Page> map;
+	const auto keys = scattered_keys<RISCV64>(20000, 0xFFFFF);
+	for (auto key : keys) {
+		radix.try_emplace(key, PageAttributes{}, PageData::INITIALIZED);
+		map.try_emplace(key, PageAttributes{}, PageData::INITIALIZED);
+	}
+
+	BENCHMARK("unordered_map scattered lookups") {
+		size_t found = 0;
+		for (auto key : keys)
+			found += map.find(key) != map.end();
+		return found;
+	};
+	BENCHMARK("radix tree scattered lookups") {
+		size_t found = 0;
+		for (auto key : keys)
+			found += radix.find(key) != radix.end();
+		return found;
+	};
+}
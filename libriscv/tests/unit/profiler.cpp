@@ -0,0 +1,59 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include <libriscv/machine.hpp>
+#include <libriscv/profiler.hpp>
+extern std::vector<uint8_t> build_and_load(const std::string& code,
+		   const std::string& args = "-O2 -static", bool cpp = false);
+static const uint64_t MAX_MEMORY = 8ul << 20; /* 8MB */
+static const uint64_t MAX_INSTRUCTIONS = 50'000'000ul;
+using namespace riscv;
+
+static const char* hot_program = R"M(
+	__attribute__((noinline))
+	static int hot_loop(int n) {
+		volatile int sum = 0;
+		for (int i = 0; i < n; i++) sum += i;
+		return sum;
+	}
+	__attribute__((noinline))
+	int caller_function(int n) {
+		return hot_loop(n) + 1;
+	}
+	int main() {
+		return caller_function(2000000) != 0 ? 666 : 0;
+	})M";
+
+TEST_CASE("Sample a program into folded stacks", "[Profiler]")
+{
+	const auto binary = build_and_load(hot_program, "-O2 -static -fno-omit-frame-pointer");
+
+	riscv::Machine<RISCV64> machine { binary, { .memory_max = MAX_MEMORY } };
+	machine.setup_linux_syscalls();
+	machine.setup_linux({"profiler"}, {"LC_ALL=C"});
+
+	auto profiler = std::make_shared<Profiler<RISCV64>>(ProfilerOptions{ .interval = 1000 });
+	machine.set_profiler(profiler);
+	machine.simulate(MAX_INSTRUCTIONS);
+	REQUIRE(machine.return_value<int>() == 666);
+
+	REQUIRE(profiler->samples() > 100);
+	REQUIRE(profiler->dropped_samples() == 0);
+	// Every sample is a stack that ends with a count
+	const auto folded = profiler->folded_stacks(machine.memory);
+	REQUIRE_THAT(folded, Catch::Matchers::EndsWith("\n"));
+	// Most of the time is spent in the loop, called from caller_function
+	REQUIRE_THAT(folded, Catch::Matchers::ContainsSubstring("caller_function;hot_loop "));
+
+	// Forks share the profiler of the main machine
+	const uint64_t samples = profiler->samples();
+	riscv::Machine<RISCV64> fork { machine };
+	REQUIRE(fork.profiler() == profiler.get());
+	fork.vmcall("caller_function", 100000);
+	REQUIRE(profiler->samples() > samples);
+
+	profiler->clear();
+	REQUIRE(profiler->samples() == 0);
+	REQUIRE(profiler->unique_stacks() == 0);
+	REQUIRE(profiler->folded_stacks(machine.memory).empty());
+}
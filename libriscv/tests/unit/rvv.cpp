@@ -0,0 +1,122 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <libriscv/machine.hpp>
+#include <libriscv/rv32i_instr.hpp>
+#include <cstring>
+extern std::vector<uint8_t> build_and_load(const std::string& code,
+	const std::string& args = "-O2 -static", bool cpp = false);
+static const std::string cwd {SRCDIR};
+static const uint64_t MAX_MEMORY = 8ul << 20; /* 8MB */
+static const uint64_t MAX_INSTRUCTIONS = 50'000'000ul;
+using namespace riscv;
+
+// Unmasked OP-V instruction: funct6 vd, vs1, vs2
+static constexpr rv32i_instruction opv(uint32_t funct6, uint32_t funct3, uint32_t vd, uint32_t vs1, uint32_t vs2)
+{
+	return rv32i_instruction { (funct6 << 26) | (1u << 25) | (vs2 << 20) | (vs1 << 15) | (funct3 << 12) | (vd << 7) | 0b1010111 };
+}
+static constexpr uint32_t OPIVV = 0, OPFVV = 1, OPMVV = 2, OPFVF = 5;
+
+static bool same_lane(const VectorLane& a, const VectorLane& b)
+{
+	return std::memcmp(&a, &b, sizeof(VectorLane)) == 0;
+}
+
+TEST_CASE("Vector instructions match scalar loops", "[RVV]")
+{
+	Machine<RISCV64> machine;
+	auto& rvv = machine.cpu.registers().rvv();
+	const auto reset = [&] {
+		for (unsigned i = 0; i < 8; i++) {
+			rvv.u32(2)[i] = 0x9E3779B9u * (i + 1);
+			rvv.u32(3)[i] = 0x7F4A7C15u ^ (i << 13);
+		}
+		for (unsigned i = 0; i < 8; i++) {
+			rvv.f32(4)[i] = 1.5f * i - 3.25f;
+			rvv.f32(5)[i] = 0.1f + i * 1e-3f;
+		}
+		rvv.f32(1) = rvv.f32(5);
+	};
+
+	// Integer operations are vd = vs1 OP vs2
+	const auto check_int = [&] (uint32_t funct3, uint32_t funct6, auto op) {
+		reset();
+		VectorLane expected;
+		for (unsigned i = 0; i < 8; i++)
+			expected.u32[i] = op(rvv.u32(2)[i], rvv.u32(3)[i]);
+		machine.cpu.execute(opv(funct6, funct3, 1, 2, 3));
+		REQUIRE(same_lane(rvv.get(1), expected));
+		// The destination can also be a source
+		reset();
+		machine.cpu.execute(opv(funct6, funct3, 2, 2, 3));
+		REQUIRE(same_lane(rvv.get(2), expected));
+	};
+	check_int(OPIVV, 0b000000, [] (uint32_t a, uint32_t b) { return a + b; });
+	check_int(OPIVV, 0b000010, [] (uint32_t a, uint32_t b) { return a - b; });
+	check_int(OPIVV, 0b001001, [] (uint32_t a, uint32_t b) { return a & b; });
+	check_int(OPIVV, 0b001010, [] (uint32_t a, uint32_t b) { return a | b; });
+	check_int(OPIVV, 0b001011, [] (uint32_t a, uint32_t b) { return a ^ b; });
+	check_int(OPMVV, 0b100101, [] (uint32_t a, uint32_t b) { return a * b; });
+
+	const auto check_float = [&] (uint32_t funct6, auto op) {
+		reset();
+		VectorLane expected;
+		for (unsigned i = 0; i < 8; i++)
+			expected.f32[i] = op(rvv.f32(4)[i], rvv.f32(5)[i], rvv.f32(1)[i]);
+		machine.cpu.execute(opv(funct6, OPFVV, 1, 4, 5));
+		REQUIRE(same_lane(rvv.get(1), expected));
+	};
+	check_float(0b000000, [] (float a, float b, float) { return a + b; });
+	check_float(0b000010, [] (float a, float b, float) { return a - b; });
+	check_float(0b100100, [] (float a, float b, float) { return a * b; });
+	// VFMADD: vd = (vs1 * vd) + vs2, VFMACC: vd = (vs1 * vs2) + vd
+	check_float(0b101000, [] (float a, float b, float d) { volatile float m = a * d; return m + b; });
+	check_float(0b101100, [] (float a, float b, float d) { volatile float m = a * b; return m + d; });
+
+	// Vector-scalar operations are vd = vs2 OP f[rs1]
+	reset();
+	machine.cpu.registers().getfl(10).set_float(2.5f);
+	VectorLane expected;
+	for (unsigned i = 0; i < 8; i++)
+		expected.f32[i] = rvv.f32(4)[i] * 2.5f;
+	machine.cpu.execute(opv(0b100100, OPFVF, 1, 10, 4));
+	REQUIRE(same_lane(rvv.get(1), expected));
+
+	// Unordered reductions add pairwise: (0+4, 1+5, 2+6, 3+7), (0+2, 1+3), (0+1)
+	reset();
+	float v[8];
+	for (unsigned i = 0; i < 8; i++)
+		v[i] = rvv.f32(4)[i] + rvv.f32(5)[i];
+	const float w0 = v[0] + v[4], w1 = v[1] + v[5], w2 = v[2] + v[6], w3 = v[3] + v[7];
+	machine.cpu.execute(opv(0b000001, OPFVV, 1, 4, 5));
+	REQUIRE(rvv.f32(1)[0] == (w0 + w2) + (w1 + w3));
+
+	// VREDSUM: vd[0] = vs1[0] + sum(vs2)
+	reset();
+	uint32_t sum = rvv.u32(2)[0];
+	for (unsigned i = 0; i < 8; i++)
+		sum += rvv.u32(3)[i];
+	machine.cpu.execute(opv(0b000000, OPMVV, 1, 2, 3));
+	REQUIRE(rvv.u32(1)[0] == sum);
+}
+
+TEST_CASE("Vector dot-product benchmark", "[RVV][.benchmark]")
+{
+	// The existing RVV program: a 4096-element dot product using vfmacc.vv
+	const auto binary = build_and_load("",
+		"-O2 -static -fno-tree-vectorize -march=rv64gcv -mabi=lp64d " + cwd + "/../../binaries/rvv/src/simple.cpp", true);
+
+	riscv::Machine<RISCV64> machine { binary, { .memory_max = MAX_MEMORY } };
+	machine.setup_linux_syscalls();
+	machine.setup_linux({"rvv"}, {"LC_ALL=C"});
+	machine.simulate(MAX_INSTRUCTIONS);
+	REQUIRE(machine.return_value<int>() == 16384);
+
+	riscv::Machine<RISCV64> fork { machine };
+	const auto main_addr = machine.address_of("main");
+	REQUIRE(main_addr != 0x0);
+	BENCHMARK("simple.cpp dot product") {
+		return fork.vmcall(main_addr);
+	};
+}
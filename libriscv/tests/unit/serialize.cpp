@@ -163,3 +163,61 @@ TEST_CASE("Serialized state from another place", "[Serialize]")
 	restored_machine.simulate(MAX_INSTRUCTIONS);
 	REQUIRE(restored_machine.return_value<int>() == 666);
 }
+
+TEST_CASE("Serialize baseline and deltas", "[Serialize]")
+{
+	struct State {
+		std::vector<std::vector<uint8_t>> snapshots;
+	} state;
+	const auto binary = build_and_load(R"M(
+	#include <string.h>
+	static inline void sched_yield(int num) {
+		register int a0 __asm__("a0") = num;
+		register int a7 __asm__("a7") = 124;
+		__asm__ volatile ("ecall" : "+r"(a0) : "r"(a7) : "memory");
+	}
+	static char buffer[256 * 1024];
+	int main(int argc, char** argv) {
+		for (int i = 0; i < 4; i++) {
+			// Only touch one page between each snapshot
+			buffer[i * 4096] = 'a' + i;
+			sched_yield(i);
+		}
+		return 666;
+	})M");
+
+	riscv::Machine<RISCV64> machine { binary, restored_options };
+	machine.setup_linux_syscalls();
+	machine.setup_linux(
+		{"serialize_me"},
+		{"LC_TYPE=C", "LC_ALL=C", "USER=root"});
+	machine.set_userdata(&state);
+
+	static constexpr int SYSCALL_SCHED_YIELD  = 124;
+	machine.syscall_handlers.at(SYSCALL_SCHED_YIELD) = [] (auto& m) {
+		m.cpu.increment_pc(4);
+		auto* state = m.template get_userdata<State> ();
+		state->snapshots.emplace_back();
+		m.serialize_delta_to(state->snapshots.back());
+		m.cpu.increment_pc(-4);
+	};
+	machine.simulate(MAX_INSTRUCTIONS);
+	REQUIRE(machine.return_value<int>() == 666);
+	REQUIRE(state.snapshots.size() == 4);
+	// Deltas only contain the few pages that changed
+	for (size_t i = 1; i < state.snapshots.size(); i++) {
+		REQUIRE(state.snapshots[i].size() < state.snapshots[0].size() / 4);
+	}
+
+	// Restore the baseline and each delta in order
+	riscv::Machine<RISCV64> restored_machine { empty, restored_options };
+	for (size_t i = 0; i < state.snapshots.size(); i++) {
+		REQUIRE(restored_machine.deserialize_from(state.snapshots[i]) == 0);
+		REQUIRE(restored_machine.sysarg(0) == i);
+	}
+
+	// Resume the program from the last delta
+	restored_machine.setup_linux_syscalls();
+	restored_machine.simulate(MAX_INSTRUCTIONS);
+	REQUIRE(restored_machine.return_value<int>() == 666);
+}
@@ -0,0 +1,71 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <libriscv/machine.hpp>
+#include <libriscv/decoder_cache.hpp>
+#include <libriscv/superinstructions.hpp>
+extern std::vector<uint8_t> build_and_load(const std::string& code,
+		   const std::string& args = "-O2 -static", bool cpp = false);
+static const uint64_t MAX_MEMORY = 8ul << 20; /* 8MB */
+static const uint64_t MAX_INSTRUCTIONS = 50'000'000ul;
+using namespace riscv;
+
+// Loads, stores and arithmetic in straight-line sequences,
+// which is what superinstructions are made of
+static const char* sequence_program = R"M(
+	#include <stdint.h>
+	#include <string.h>
+	static uint64_t words[512];
+	static uint8_t bytes[2048];
+	__attribute__((noinline))
+	uint64_t checksum(int rounds) {
+		uint64_t sum = 0;
+		for (int r = 0; r < rounds; r++) {
+			for (int i = 0; i < 512; i++)
+				words[i] = words[i] * 3 + i + r;
+			memset(bytes, r, sizeof(bytes));
+			for (int i = 0; i < 2048; i++)
+				sum += (uint64_t)(bytes[i] << (i & 7)) | words[i & 511];
+		}
+		return sum;
+	}
+	int main() {
+		return (int)(checksum(20) % 1000);
+	})M";
+
+// The number of decoder entries that begin a superinstruction
+template <int W>
+static size_t count_superinstructions(const DecodedExecuteSegment<W>& exec)
+{
+	size_t count = 0;
+	for (auto pc = exec.exec_begin(); pc < exec.exec_end(); pc += DecoderCache<W>::DIVISOR) {
+		const auto bytecode = exec.decoder_cache()[pc / DecoderCache<W>::DIVISOR].get_bytecode();
+		for (size_t i = 0; i < superinstruction_count; i++)
+			count += (bytecode == superinstructions[i].bytecode);
+	}
+	return count;
+}
+
+TEST_CASE("Superinstructions match precise simulation", "[Superinstructions]")
+{
+	const auto binary = build_and_load(sequence_program);
+
+	// The fast dispatch uses superinstructions, precise simulation does not
+	riscv::Machine<RISCV64> fast { binary, { .memory_max = MAX_MEMORY } };
+	fast.setup_linux_syscalls();
+	fast.setup_linux({"superinstructions"}, {"LC_ALL=C"});
+	fast.simulate(MAX_INSTRUCTIONS);
+	// Sequences in the program were actually fused
+	if constexpr (!bytecode_recording_enabled)
+		REQUIRE(count_superinstructions(fast.cpu.current_execute_segment()) > 0);
+
+	riscv::Machine<RISCV64> precise { binary, { .memory_max = MAX_MEMORY } };
+	precise.setup_linux_syscalls();
+	precise.setup_linux({"superinstructions"}, {"LC_ALL=C"});
+	precise.set_max_instructions(MAX_INSTRUCTIONS);
+	precise.cpu.simulate_precise();
+
+	REQUIRE(fast.instruction_counter() < MAX_INSTRUCTIONS);
+	REQUIRE(fast.return_value<int>() == precise.return_value<int>());
+	// Instruction counting is unchanged by fusing
+	REQUIRE(fast.instruction_counter() == precise.instruction_counter());
+}
@@ -0,0 +1,174 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <libriscv/machine.hpp>
+#include <libriscv/syscall_offload.hpp>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <atomic>
+#include <thread>
+extern std::vector<uint8_t> build_and_load(const std::string& code,
+	const std::string& args = "-O2 -static", bool cpp = false);
+static const std::string cwd {SRCDIR};
+static const uint64_t MAX_MEMORY = 8ul << 20; /* 8MB */
+static const uint64_t MAX_INSTRUCTIONS = 10'000'000ul;
+using namespace riscv;
+
+// The tcpserver sample: accepts a connection, echoes one read, closes it
+static std::vector<uint8_t> build_tcpserver()
+{
+	return build_and_load("", "-O2 -static " + cwd + "/../../binaries/tcpserver/src/main.c");
+}
+
+static std::unique_ptr<Machine<RISCV64>> start_server(const std::vector<uint8_t>& binary,
+	uint16_t port, std::shared_ptr<SyscallOffload> offload)
+{
+	auto machine = std::make_unique<Machine<RISCV64>> (binary, MachineOptions<RISCV64>{ .memory_max = MAX_MEMORY });
+	machine->setup_linux_syscalls();
+	machine->fds().permit_sockets = true;
+	machine->setup_linux({"tcpserver", std::to_string(port)}, {"LC_ALL=C"});
+	machine->set_printer([] (const auto&, const char*, size_t) {});
+	machine->set_syscall_offload(std::move(offload));
+	return machine;
+}
+
+// A loopback client that sends a message and returns the reply
+static std::string echo(uint16_t port, const std::string& message)
+{
+	for (int attempt = 0; attempt < 100; attempt++)
+	{
+		const int fd = socket(AF_INET, SOCK_STREAM, 0);
+		struct timeval tv { .tv_sec = 5, .tv_usec = 0 };
+		setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+		struct sockaddr_in addr {};
+		addr.sin_family = AF_INET;
+		addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		addr.sin_port = htons(port);
+		if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+			// The server may not be listening yet
+			close(fd);
+			usleep(10'000);
+			continue;
+		}
+		std::string reply;
+		if (write(fd, message.data(), message.size()) == (ssize_t)message.size()) {
+			char buffer[256];
+			const ssize_t len = read(fd, buffer, sizeof(buffer));
+			if (len > 0)
+				reply.assign(buffer, len);
+		}
+		close(fd);
+		return reply;
+	}
+	return "";
+}
+
+TEST_CASE("Offloaded system calls let one thread run many servers", "[Offload]")
+{
+	const auto binary = build_tcpserver();
+	const uint16_t port = 20000 + getpid() % 20000;
+	auto offload = std::make_shared<SyscallOffload>(2);
+
+	// Two servers on the same host thread. Without offloading, the first
+	// one would block the thread in accept(), and the second would never run.
+	std::array<std::unique_ptr<Machine<RISCV64>>, 2> servers {
+		start_server(binary, port, offload),
+		start_server(binary, port + 1, offload)
+	};
+
+	std::vector<std::string> replies;
+	std::atomic<bool> done = false;
+	std::thread client([&] {
+		replies.push_back(echo(port + 1, "Hello Second\n"));
+		replies.push_back(echo(port, "Hello First\n"));
+		replies.push_back(echo(port + 1, "Hello Again\n"));
+		done = true;
+	});
+
+	while (!done) {
+		for (auto& server : servers) {
+			if (!server->is_parked())
+				server->simulate(MAX_INSTRUCTIONS);
+		}
+		offload->complete(std::chrono::milliseconds(10));
+	}
+	client.join();
+
+	const std::vector<std::string> expected { "Hello Second\n", "Hello First\n", "Hello Again\n" };
+	REQUIRE(replies == expected);
+	// Both servers are waiting in accept() again
+	offload->complete();
+	for (auto& server : servers) {
+		if (!server->is_parked())
+			server->simulate(MAX_INSTRUCTIONS);
+		REQUIRE(server->is_parked());
+	}
+	REQUIRE(offload->in_flight() == 2);
+}
+
+TEST_CASE("Parked machines can be destroyed", "[Offload]")
+{
+	const auto binary = build_tcpserver();
+	const uint16_t port = 20000 + (getpid() + 2) % 20000;
+	auto offload = std::make_shared<SyscallOffload>(1);
+
+	auto server = start_server(binary, port, offload);
+	server->simulate(MAX_INSTRUCTIONS);
+	REQUIRE(server->is_parked());
+	REQUIRE(offload->in_flight() == 1);
+
+	// The accept() is cancelled, and never completes
+	server.reset();
+	REQUIRE(offload->in_flight() == 0);
+	REQUIRE(offload->complete() == 0);
+}
+
+TEST_CASE("A failing completion only affects its own machine", "[Offload]")
+{
+	// A system call whose result is written into the guest by its completion
+	const auto binary = build_and_load(R"M(
+	static char buffer[16];
+	static long offloaded_read(char* dst) {
+		register long a0 asm("a0") = (long)dst;
+		register long a7 asm("a7") = 500;
+		asm volatile("ecall" : "+r"(a0) : "r"(a7) : "memory");
+		return a0;
+	}
+	int main(int argc, char** argv) {
+		// The second machine passes an address that cannot be written
+		char* dst = (argv[1][0] == 'b') ? (char*)0x0 : buffer;
+		const long len = offloaded_read(dst);
+		return (len == 5 && buffer[0] == 'h') ? 666 : 1;
+	})M");
+	Machine<RISCV64>::install_syscall_handler(500, [] (auto& machine) {
+		const auto dst = machine.cpu.reg(REG_ARG0);
+		machine.offload_syscall([] { return 5L; },
+			[dst] (auto& machine, long result) {
+				machine.copy_to_guest(dst, "hello", result);
+			});
+	});
+	auto offload = std::make_shared<SyscallOffload>(1);
+
+	std::array<std::unique_ptr<Machine<RISCV64>>, 2> machines;
+	for (size_t i = 0; i < machines.size(); i++) {
+		machines[i] = std::make_unique<Machine<RISCV64>> (binary, MachineOptions<RISCV64>{ .memory_max = MAX_MEMORY });
+		machines[i]->setup_linux_syscalls();
+		machines[i]->setup_linux({"offload", i == 0 ? "good" : "bad"}, {"LC_ALL=C"});
+		machines[i]->set_syscall_offload(offload);
+		machines[i]->simulate(MAX_INSTRUCTIONS);
+		REQUIRE(machines[i]->is_parked());
+	}
+
+	// Both system calls are completed, and neither machine stays parked
+	while (offload->in_flight() > 0)
+		offload->complete(std::chrono::milliseconds(10));
+	REQUIRE(!machines[0]->is_parked());
+	REQUIRE(!machines[1]->is_parked());
+
+	machines[0]->simulate(MAX_INSTRUCTIONS);
+	REQUIRE(machines[0]->return_value<int>() == 666);
+	// The fault is delivered to the machine it belongs to
+	REQUIRE_THROWS_AS(machines[1]->simulate(MAX_INSTRUCTIONS), MachineException);
+}
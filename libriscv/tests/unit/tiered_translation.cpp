@@ -0,0 +1,66 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <libriscv/machine.hpp>
+extern std::vector<uint8_t> build_and_load(const std::string& code,
+	const std::string& args = "-O2 -static", bool cpp = false);
+static const uint64_t MAX_MEMORY = 8ul << 20; /* 8MB */
+static const uint64_t MAX_INSTRUCTIONS = 100'000'000ul;
+using namespace riscv;
+
+#ifdef RISCV_BINARY_TRANSLATION
+#include <libriscv/tr_types.hpp>
+
+TEST_CASE("Code that gets hot later is translated in a later tier", "[Tiered]")
+{
+	// Two loops in separate code regions: the second one only starts
+	// running after the first one has been translated.
+	const auto binary = build_and_load(R"M(
+	__attribute__((noinline, aligned(1024)))
+	long first(long n) {
+		long sum = 0;
+		for (long i = 0; i < n; i++)
+			sum += i * 3;
+		return sum;
+	}
+	__attribute__((noinline, aligned(1024)))
+	long second(long n) {
+		long sum = 0;
+		for (long i = 0; i < n; i++)
+			sum += i * 5;
+		return sum;
+	}
+	static volatile long count = 4'000'000;
+
+	int main() {
+		const long a = first(count);
+		const long b = second(count);
+		return (a == 23999994000000L && b == 39999990000000L) ? 666 : 1;
+	})M");
+
+	Machine<RISCV64> machine { binary, {
+		.memory_max = MAX_MEMORY,
+		.translate_enable_embedded = false,
+		.translation_cache = false,
+		.translate_hot_threshold = 4,
+		.translate_hot_sample_interval = 100'000,
+	} };
+	machine.setup_linux_syscalls();
+	machine.setup_linux({"tiered"}, {"LC_ALL=C"});
+
+	machine.simulate(MAX_INSTRUCTIONS);
+	REQUIRE(machine.return_value<int>() == 666);
+
+	auto& exec = machine.cpu.current_execute_segment();
+	auto* profile = exec.translation_profile();
+	REQUIRE(profile != nullptr);
+	REQUIRE(exec.is_binary_translated());
+	// Each loop was translated on its own, and the tier is finished
+	CHECK(profile->tiers == 2);
+	CHECK(!profile->translating);
+	static constexpr unsigned SHIFT = TranslationProfile<RISCV64>::REGION_SHIFT;
+	CHECK(profile->translated.count(machine.address_of("first") >> SHIFT) == 1);
+	CHECK(profile->translated.count(machine.address_of("second") >> SHIFT) == 1);
+	// Regions that did not get hot are not part of any tier
+	CHECK(profile->translated.count(machine.address_of("main") >> SHIFT) == 0);
+}
+#endif
@@ -1,7 +1,9 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 
 #include <libriscv/machine.hpp>
+#include <libriscv/prepared_call.hpp>
 extern std::vector<uint8_t> build_and_load(const std::string& code,
 	const std::string& args = "-O2 -static -Wl,--undefined=hello", bool cpp = false);
 static const uint64_t MAX_MEMORY = 8ul << 20; /* 8MB */
@@ -157,6 +159,116 @@ TEST_CASE("VM call enum values", "[VMCall]")
 	REQUIRE(machine.return_value<MyEnum>() == MyEnum::World);
 }
 
+static const char* batch_program = R"M(
+	extern long callback(long a, int b) {
+		return a * 3 + b;
+	}
+	extern long scale(double x, float y, long z) {
+		return (long)(x * y) + z;
+	}
+
+	int main() {
+		return 666;
+	})M";
+
+TEST_CASE("VM call batches", "[VMCall]")
+{
+	const auto binary = build_and_load(batch_program,
+		"-O2 -static -Wl,--undefined=callback,--undefined=scale");
+
+	riscv::Machine<RISCV64> machine { binary, { .memory_max = MAX_MEMORY } };
+	machine.setup_linux_syscalls();
+	machine.setup_linux(
+		{"vmcall"},
+		{"LC_TYPE=C", "LC_ALL=C", "USER=root"});
+	machine.simulate(MAX_INSTRUCTIONS);
+	REQUIRE(machine.return_value<int>() == 666);
+
+	const auto callback = machine.address_of("callback");
+	REQUIRE(callback != 0x0);
+
+	std::vector<std::tuple<long, int>> inputs;
+	for (long i = 0; i < 1000; i++)
+		inputs.emplace_back(i, int(-i));
+	std::vector<uint64_t> results(inputs.size());
+	machine.vmcall_batch<MAX_INSTRUCTIONS>(callback,
+		std::span<const std::tuple<long, int>> (inputs), std::span<uint64_t> (results));
+	for (size_t i = 0; i < inputs.size(); i++) {
+		REQUIRE(results[i] == uint64_t(2 * i));
+		// The same result as a regular vmcall
+		REQUIRE(results[i] == machine.vmcall(callback, std::get<0>(inputs[i]), std::get<1>(inputs[i])));
+	}
+
+	// A prepared call can also be batched
+	PreparedCall<RISCV64, long(long, int), MAX_INSTRUCTIONS> prepared { machine, callback };
+	std::fill(results.begin(), results.end(), 0);
+	prepared.call_batch(std::span<const std::tuple<long, int>> (inputs), std::span<uint64_t> (results));
+	for (size_t i = 0; i < inputs.size(); i++)
+		REQUIRE(results[i] == uint64_t(2 * i));
+
+	// Floating-point arguments use their own registers
+	const auto scale = machine.address_of("scale");
+	REQUIRE(scale != 0x0);
+	const std::array<std::tuple<double, float, long>, 2> fp_inputs {{
+		{ 2.5, 4.0f, 1 }, { -1.0, 8.0f, 100 }
+	}};
+	std::array<uint64_t, 2> fp_results;
+	machine.vmcall_batch(scale,
+		std::span<const std::tuple<double, float, long>> (fp_inputs), std::span<uint64_t> (fp_results));
+	REQUIRE(fp_results[0] == 11);
+	REQUIRE(fp_results[1] == 92);
+
+	// The results must have room for every call
+	REQUIRE_THROWS_WITH([&] {
+		machine.vmcall_batch(callback,
+			std::span<const std::tuple<long, int>> (inputs), std::span<uint64_t> (fp_results));
+	}(), Catch::Matchers::ContainsSubstring("Not enough room"));
+}
+
+TEST_CASE("VM call batch benchmark", "[VMCall][.benchmark]")
+{
+	const auto binary = build_and_load(batch_program,
+		"-O2 -static -Wl,--undefined=callback,--undefined=scale");
+
+	riscv::Machine<RISCV64> machine { binary, { .memory_max = MAX_MEMORY } };
+	machine.setup_linux_syscalls();
+	machine.setup_linux(
+		{"vmcall"},
+		{"LC_TYPE=C", "LC_ALL=C", "USER=root"});
+	machine.simulate(MAX_INSTRUCTIONS);
+
+	const auto callback = machine.address_of("callback");
+	REQUIRE(callback != 0x0);
+	std::vector<std::tuple<long, int>> inputs;
+	for (long i = 0; i < 10000; i++)
+		inputs.emplace_back(i, int(i & 0xFF));
+	std::vector<uint64_t> results(inputs.size());
+
+	BENCHMARK("10000 vmcalls in a loop") {
+		for (size_t i = 0; i < inputs.size(); i++)
+			results[i] = machine.vmcall<MAX_INSTRUCTIONS>(callback,
+				std::get<0>(inputs[i]), std::get<1>(inputs[i]));
+		return results.back();
+	};
+	BENCHMARK("10000 vmcalls in a batch") {
+		machine.vmcall_batch<MAX_INSTRUCTIONS>(callback,
+			std::span<const std::tuple<long, int>> (inputs), std::span<uint64_t> (results));
+		return results.back();
+	};
+
+	// Prepared calls return directly to the host
+	PreparedCall<RISCV64, long(long, int), MAX_INSTRUCTIONS> prepared { machine, callback };
+	BENCHMARK("10000 prepared calls in a loop") {
+		for (size_t i = 0; i < inputs.size(); i++)
+			results[i] = prepared(std::get<0>(inputs[i]), std::get<1>(inputs[i]));
+		return results.back();
+	};
+	BENCHMARK("10000 prepared calls in a batch") {
+		prepared.call_batch(std::span<const std::tuple<long, int>> (inputs), std::span<uint64_t> (results));
+		return results.back();
+	};
+}
+
 TEST_CASE("VM function call in fork", "[VMCall]")
 {
 	// The global variable 'value' should get
@@ -280,6 +392,54 @@ TEST_CASE("VM function call in fork", "[VMCall]")
 	}
 }
 
+TEST_CASE("VM function call in recycled fork", "[VMCall]")
+{
+	// Each call changes the global counter and the heap, and
+	// a fork that is reset to the main VM must see neither.
+	const auto binary = build_and_load(R"M(
+	#include <stdlib.h>
+	static int counter = 0;
+	static char* last = NULL;
+
+	extern int request(int n) {
+		counter += n;
+		last = malloc(64 * 1024);
+		last[0] = n;
+		return counter;
+	}
+
+	int main() {
+		return 666;
+	})M");
+
+	riscv::Machine<RISCV64> machine { binary, { .memory_max = MAX_MEMORY } };
+	machine.setup_linux_syscalls();
+	machine.setup_linux(
+		{"vmcall"},
+		{"LC_TYPE=C", "LC_ALL=C", "USER=root"});
+
+	machine.simulate(MAX_INSTRUCTIONS);
+	REQUIRE(machine.return_value<int>() == 666);
+
+	riscv::Machine<RISCV64> fork { machine, {
+		.fork_dirty_tracking = true,
+#ifdef RISCV_BINARY_TRANSLATION
+		.use_memory_arena = false,
+#endif
+	} };
+	for (int i = 0; i < 10; i++)
+	{
+		REQUIRE(fork.vmcall("request", 5) == 5);
+		REQUIRE(fork.vmcall("request", 7) == 12);
+		REQUIRE(fork.memory.dirty_pages() > 0);
+
+		fork.reset_to(machine);
+		REQUIRE(fork.memory.dirty_pages() == 0);
+	}
+	// The main VM was never changed by the fork
+	REQUIRE(machine.vmcall("request", 1) == 1);
+}
+
 TEST_CASE("VM call and preemption", "[VMCall]")
 {
 	struct State {
@@ -0,0 +1,102 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <libriscv/machine.hpp>
+#include <cstring>
+extern std::vector<uint8_t> build_and_load(const std::string& code,
+	const std::string& args = "-O2 -static", bool cpp = false);
+static const uint64_t MAX_MEMORY = 8ul << 20; /* 8MB */
+static const uint64_t MAX_INSTRUCTIONS = 10'000'000ul;
+using namespace riscv;
+
+static const char* segments_program = R"M(
+	static const char rodata[64 * 1024] = { [0] = 1, [40000] = 2, [65535] = 3 };
+	static int data[8192] = { 7 };
+	int main() {
+		int sum = rodata[0] + rodata[40000] + rodata[65535];
+		for (int i = 0; i < 8192; i++)
+			data[i] += i;
+		return sum + data[0] + data[8191];
+	})M";
+
+// A page-aligned copy of a binary, like a mmap() of the file
+struct AlignedBinary {
+	AlignedBinary(const std::vector<uint8_t>& binary)
+		: size(binary.size()),
+		  data((PageData *)new PageData[(binary.size() + Page::size()-1) / Page::size()])
+	{
+		std::memcpy(data.get(), binary.data(), binary.size());
+	}
+	std::string_view view() const { return { (const char *)data.get(), size }; }
+	bool contains(const Page& page) const {
+		const auto* ptr = (const char *)page.data();
+		return ptr >= view().data() && ptr < view().data() + size;
+	}
+	const size_t size;
+	std::unique_ptr<PageData[]> data;
+};
+
+TEST_CASE("Zero-copy segments share the binary", "[Memory]")
+{
+	const auto binary = build_and_load(segments_program);
+	const AlignedBinary aligned { binary };
+	const MachineOptions<RISCV64> options {
+		.memory_max = MAX_MEMORY,
+		.zero_copy_segments = true,
+		.use_memory_arena = false
+	};
+
+	Machine<RISCV64> machine { aligned.view(), options };
+	size_t shared_pages = 0;
+	for (const auto& it : machine.memory.pages()) {
+		if (aligned.contains(it.second)) {
+			REQUIRE(it.second.attr.non_owning);
+			REQUIRE(!it.second.attr.write);
+			shared_pages++;
+		}
+	}
+	// Most of the 64KB rodata and the 32KB data is shared
+	REQUIRE(shared_pages >= 16);
+	Machine<RISCV64> copied { aligned.view(), { .memory_max = MAX_MEMORY, .use_memory_arena = false } };
+	REQUIRE(machine.memory.memory_usage_total() + 16 * Page::size() <= copied.memory.memory_usage_total());
+
+	machine.setup_linux_syscalls();
+	machine.setup_linux({"zero_copy"}, {"LC_ALL=C"});
+	machine.simulate(MAX_INSTRUCTIONS);
+	REQUIRE(machine.return_value<int>() == 6 + 7 + 8191);
+
+	// Writable segments are copy-on-write, leaving the binary unchanged
+	REQUIRE(std::memcmp(aligned.view().data(), binary.data(), binary.size()) == 0);
+
+	// Another machine shares the same pages, and sees none of the writes
+	Machine<RISCV64> other { aligned.view(), options };
+	other.setup_linux_syscalls();
+	other.setup_linux({"zero_copy"}, {"LC_ALL=C"});
+	other.simulate(MAX_INSTRUCTIONS);
+	REQUIRE(other.return_value<int>() == 6 + 7 + 8191);
+}
+
+TEST_CASE("Zero-copy read-only pages stay unchanged", "[Memory]")
+{
+	const auto binary = build_and_load(segments_program);
+	const AlignedBinary aligned { binary };
+
+	Machine<RISCV64> machine { aligned.view(), {
+		.memory_max = MAX_MEMORY,
+		.zero_copy_segments = true,
+		.use_memory_arena = false
+	} };
+	for (auto& it : machine.memory.pages()) {
+		if (!aligned.contains(it.second) || it.second.attr.is_cow)
+			continue;
+		const auto addr = it.first * Page::size();
+		// Read-only pages cannot be written to
+		REQUIRE_THROWS([&] {
+			machine.memory.template write<uint8_t> (addr, 0xFF);
+		}());
+		// Made writable, they are copied before the write
+		machine.memory.set_page_attr(addr, Page::size(), { .read = true, .write = true });
+		machine.memory.template write<uint8_t> (addr, 0xFF);
+		REQUIRE(machine.memory.template read<uint8_t> (addr) == 0xFF);
+	}
+	REQUIRE(std::memcmp(aligned.view().data(), binary.data(), binary.size()) == 0);
+}
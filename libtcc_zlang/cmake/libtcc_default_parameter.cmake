@@ -7,6 +7,7 @@ set(LIBTCC_INSTALL_RUNTIME_DEFAULT TRUE)
 set(LIBTCC_RUNTIME_PATH_DEFAULT libtcc)
 set(LIBTCC_ENABLE_EXTENSION_DEFAULT TRUE)
 set(LIBTCC_ONE_SOURCE_DEFAULT FALSE)
+set(LIBTCC_BUILD_INSTRUMENTED_DEFAULT TRUE)
 
 if(NOT DEFINED LIBTCC_BUILD_TYPE)
     set(LIBTCC_BUILD_TYPE ${LIBTCC_BUILD_TYPE_DEFAULT})
@@ -23,6 +24,9 @@ endif()
 if(NOT DEFINED LIBTCC_ONE_SOURCE)
     set(LIBTCC_ONE_SOURCE ${LIBTCC_ONE_SOURCE_DEFAULT})
 endif()
+if(NOT DEFINED LIBTCC_BUILD_INSTRUMENTED)
+    set(LIBTCC_BUILD_INSTRUMENTED ${LIBTCC_BUILD_INSTRUMENTED_DEFAULT})
+endif()
 
 if(NOT DEFINED LIBTCC_RUNTIME_PATH)
     set(LIBTCC_RUNTIME_PATH ${LIBTCC_RUNTIME_PATH_DEFAULT})
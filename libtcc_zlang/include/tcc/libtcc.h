@@ -22,6 +22,12 @@ LIBTCCAPI TCCState *tcc_new_with_defines(int add_default_defines);
 /* free a TCC compilation context */
 LIBTCCAPI void tcc_delete(TCCState *s);
 
+/* return 's' to the state of a freshly created context, but keep the
+   memory of its preprocessor allocators and symbol pools for the next
+   compilation (error callback, options and output type must be set again) */
+LIBTCCAPI void tcc_reuse(TCCState *s);
+LIBTCCAPI void tcc_reuse_with_defines(TCCState *s, int add_default_defines);
+
 /* set CONFIG_TCCDIR at runtime */
 LIBTCCAPI void tcc_set_lib_path(TCCState *s, const char *path);
 
@@ -105,6 +111,36 @@ LIBTCCAPI void *tcc_get_symbol(TCCState *s, const char *name);
 LIBTCCAPI void tcc_list_symbols(TCCState *s, void *ctx,
     void (*symbol_cb)(void *ctx, const char *name, const void *val));
 
+/* list pointer sized slots filled by tcc_relocate(), 'name' is NULL for
+   slots that point into the relocated code itself. returns -1 if the
+   relocated code cannot be moved to another address */
+LIBTCCAPI int tcc_list_relocations(TCCState *s, void *ptr, void *ctx,
+    void (*reloc_cb)(void *ctx, const char *name, unsigned long offset));
+
+/* compiler counters, only collected by the instrumented library (built
+   with TCC_STATS), all counters stay zero otherwise */
+enum {
+    TCC_STATS_TAL_TOKSYM, /* TokenSym allocator */
+    TCC_STATS_TAL_TOKSTR, /* TokenString allocator */
+    TCC_STATS_TAL_TAGS
+};
+
+typedef struct TCCStats {
+    unsigned long tal_allocs[TCC_STATS_TAL_TAGS]; /* allocations served by the allocator */
+    unsigned long tal_bytes[TCC_STATS_TAL_TAGS];  /* bytes served by the allocator */
+    unsigned long tal_missed[TCC_STATS_TAL_TAGS]; /* allocations passed on to tcc_malloc */
+    unsigned long tokens;   /* tokens returned by the preprocessor */
+    unsigned long syms;     /* C symbols created */
+    unsigned long elf_syms; /* ELF symbols created */
+    unsigned long relocs;   /* relocations applied */
+} TCCStats;
+
+/* copy the counters collected for 's' since it was created or reset */
+LIBTCCAPI void tcc_get_stats(TCCState *s, TCCStats *stats);
+
+/* reset the counters of 's' */
+LIBTCCAPI void tcc_reset_stats(TCCState *s);
+
 #ifdef __cplusplus
 }
 #endif
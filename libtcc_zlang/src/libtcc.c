@@ -408,6 +408,61 @@ PUB_FUNC void tcc_memcheck(void)
 #define malloc(s) use_tcc_malloc(s)
 #define realloc(p, s) use_tcc_realloc(p, s)
 
+/********************************************************/
+/* region allocator */
+
+#define TCC_ARENA_BLOCK_SIZE (64 * 1024)
+#define TCC_ARENA_ALIGN 16
+
+struct TCCArenaBlock {
+    TCCArenaBlock *next;
+    unsigned long size;
+    unsigned long used;
+};
+
+#define TCC_ARENA_HEADER \
+    ((sizeof(TCCArenaBlock) + TCC_ARENA_ALIGN - 1) & -TCC_ARENA_ALIGN)
+
+ST_FUNC void *tcc_arena_alloc(TCCArena *a, unsigned long size)
+{
+    TCCArenaBlock *b = a->blocks;
+
+    size = (size + TCC_ARENA_ALIGN - 1) & -TCC_ARENA_ALIGN;
+    if (size > TCC_ARENA_BLOCK_SIZE / 4) {
+        /* big requests get their own block, behind the current one so
+           that its free space stays available */
+        TCCArenaBlock *big = tcc_malloc(TCC_ARENA_HEADER + size);
+        big->size = big->used = size;
+        if (b) {
+            big->next = b->next;
+            b->next = big;
+        } else {
+            big->next = NULL;
+            a->blocks = big;
+        }
+        return (char *)big + TCC_ARENA_HEADER;
+    }
+    if (!b || b->size - b->used < size) {
+        b = tcc_malloc(TCC_ARENA_HEADER + TCC_ARENA_BLOCK_SIZE);
+        b->size = TCC_ARENA_BLOCK_SIZE;
+        b->used = 0;
+        b->next = a->blocks;
+        a->blocks = b;
+    }
+    b->used += size;
+    return (char *)b + TCC_ARENA_HEADER + b->used - size;
+}
+
+ST_FUNC void tcc_arena_free(TCCArena *a)
+{
+    TCCArenaBlock *b, *next;
+    for (b = a->blocks; b; b = next) {
+        next = b->next;
+        tcc_free(b);
+    }
+    a->blocks = NULL;
+}
+
 /********************************************************/
 /* dynarrays */
 
@@ -821,17 +876,8 @@ LIBTCCAPI TCCState *tcc_new(void)
   return tcc_new_with_defines(1);
 }
 
-LIBTCCAPI TCCState *tcc_new_with_defines(int add_default_defines)
+static void tcc_state_init(TCCState *s, int add_default_defines)
 {
-    TCCState *s;
-
-    s = tcc_mallocz(sizeof(TCCState));
-    if (!s)
-        return NULL;
-#ifdef MEM_DEBUG
-    ++nb_states;
-#endif
-
 #undef gnu_ext
 
     s->gnu_ext = 1;
@@ -1013,10 +1059,24 @@ LIBTCCAPI TCCState *tcc_new_with_defines(int add_default_defines)
       if (s->char_is_unsigned)
           tcc_define_symbol(s, "__CHAR_UNSIGNED__", NULL);
     }
+}
+
+LIBTCCAPI TCCState *tcc_new_with_defines(int add_default_defines)
+{
+    TCCState *s;
+
+    s = tcc_mallocz(sizeof(TCCState));
+    if (!s)
+        return NULL;
+#ifdef MEM_DEBUG
+    ++nb_states;
+#endif
+    tcc_state_init(s, add_default_defines);
     return s;
 }
 
-LIBTCCAPI void tcc_delete(TCCState *s1)
+/* free everything but the arena and what lives in it */
+static void tcc_state_free(TCCState *s1)
 {
     /* free sections */
     tccelf_delete(s1);
@@ -1047,6 +1107,14 @@ LIBTCCAPI void tcc_delete(TCCState *s1)
     /* free runtime memory */
     tcc_run_free(s1);
 #endif
+}
+
+LIBTCCAPI void tcc_delete(TCCState *s1)
+{
+    tcc_state_free(s1);
+
+    /* free preprocessor allocators and symbol pools at once */
+    tcc_arena_free(&s1->arena);
 
     tcc_free(s1);
 #ifdef MEM_DEBUG
@@ -1055,6 +1123,28 @@ LIBTCCAPI void tcc_delete(TCCState *s1)
 #endif
 }
 
+LIBTCCAPI void tcc_reuse(TCCState *s1)
+{
+    tcc_reuse_with_defines(s1, 1);
+}
+
+LIBTCCAPI void tcc_reuse_with_defines(TCCState *s1, int add_default_defines)
+{
+    TCCArena arena = s1->arena;
+    struct TinyAlloc *toksym_alloc = s1->toksym_alloc;
+    struct TinyAlloc *tokstr_alloc = s1->tokstr_alloc;
+    Sym *sym_free_first = s1->sym_free_first;
+
+    tcc_state_free(s1);
+    memset(s1, 0, sizeof *s1);
+
+    s1->arena = arena;
+    s1->toksym_alloc = toksym_alloc;
+    s1->tokstr_alloc = tokstr_alloc;
+    s1->sym_free_first = sym_free_first;
+    tcc_state_init(s1, add_default_defines);
+}
+
 LIBTCCAPI int tcc_set_output_type(TCCState *s, int output_type)
 {
     s->output_type = output_type;
@@ -2168,6 +2258,16 @@ LIBTCCAPI void tcc_set_options(TCCState *s, const char *r)
     dynarray_reset(&argv, &argc);
 }
 
+LIBTCCAPI void tcc_get_stats(TCCState *s1, TCCStats *stats)
+{
+    *stats = s1->stats;
+}
+
+LIBTCCAPI void tcc_reset_stats(TCCState *s1)
+{
+    memset(&s1->stats, 0, sizeof s1->stats);
+}
+
 PUB_FUNC void tcc_print_stats(TCCState *s1, unsigned total_time)
 {
     if (total_time < 1)
@@ -2183,4 +2283,14 @@ PUB_FUNC void tcc_print_stats(TCCState *s1, unsigned total_time)
 #ifdef MEM_DEBUG
     fprintf(stderr, "* %d bytes memory used\n", mem_max_size);
 #endif
+#ifdef TCC_STATS
+    fprintf(stderr, "* %lu tokens, %lu syms, %lu elf syms, %lu relocs\n"
+                    "* tal toksym: %lu allocs, %lu bytes, %lu missed\n"
+                    "* tal tokstr: %lu allocs, %lu bytes, %lu missed\n",
+           s1->stats.tokens, s1->stats.syms, s1->stats.elf_syms, s1->stats.relocs,
+           s1->stats.tal_allocs[TCC_STATS_TAL_TOKSYM], s1->stats.tal_bytes[TCC_STATS_TAL_TOKSYM],
+           s1->stats.tal_missed[TCC_STATS_TAL_TOKSYM],
+           s1->stats.tal_allocs[TCC_STATS_TAL_TOKSTR], s1->stats.tal_bytes[TCC_STATS_TAL_TOKSTR],
+           s1->stats.tal_missed[TCC_STATS_TAL_TOKSTR]);
+#endif
 }
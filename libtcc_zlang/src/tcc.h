@@ -690,6 +690,12 @@ struct sym_attr {
 #endif
 };
 
+/* region allocator, blocks are only released all at once */
+typedef struct TCCArenaBlock TCCArenaBlock;
+typedef struct TCCArena {
+    TCCArenaBlock *blocks; /* most recent block first */
+} TCCArena;
+
 struct TCCState {
     unsigned char verbose; /* if true, display some information during compilation */
     unsigned char nostdinc; /* if true, no standard headers are added */
@@ -907,6 +913,16 @@ struct TCCState {
     AFileHandle fh; /* used by tcc_load_ldscript */
     int cc; /* used by tcc_load_ldscript */
 
+    /* counters, see tcc_get_stats() */
+    TCCStats stats;
+
+    /* backing store of the preprocessor allocators and symbol pools,
+       which are kept between compilations and by tcc_reuse() */
+    TCCArena arena;
+    struct TinyAlloc *toksym_alloc;
+    struct TinyAlloc *tokstr_alloc;
+    Sym *sym_free_first;
+
     /* benchmark info */
     int total_idents;
     int total_lines;
@@ -1192,6 +1208,13 @@ struct AAssetManager;
 ST_DATA struct AAssetManager* asset_manager;
 #endif
 
+/* count into the TCCStats of a state, only in the instrumented library */
+#ifdef TCC_STATS
+# define tcc_stats_add(s, field, n) ((s) ? (void)((s)->stats.field += (n)) : (void)0)
+#else
+# define tcc_stats_add(s, field, n) ((void)0)
+#endif
+
 /* public functions currently used by the tcc main function */
 ST_FUNC char *pstrcpy(char *buf, size_t buf_size, const char *s);
 ST_FUNC char *pstrcat(char *buf, size_t buf_size, const char *s);
@@ -1228,6 +1251,8 @@ PUB_FUNC NORETURN void _tcc_error(const char *fmt, ...);
 PUB_FUNC void _tcc_warning(const char *fmt, ...);
 
 /* other utilities */
+ST_FUNC void *tcc_arena_alloc(TCCArena *a, unsigned long size);
+ST_FUNC void tcc_arena_free(TCCArena *a);
 ST_FUNC void dynarray_add(void *ptab, int *nb_ptr, void *data);
 ST_FUNC void dynarray_reset(void *pp, int *n);
 ST_INLN void cstr_ccat(CString *cstr, int ch);
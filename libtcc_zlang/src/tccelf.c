@@ -420,6 +420,7 @@ ST_FUNC int put_elf_sym(Section *s, addr_t value, unsigned long size,
     Section *hs;
 
     sym = section_ptr_add(s, sizeof(ElfW(Sym)));
+    tcc_stats_add(s->s1, elf_syms, 1);
     if (name && name[0])
         name_offset = put_elf_str(s->link, name);
     else
@@ -994,6 +995,7 @@ ST_FUNC void relocate_section(TCCState *s1, Section *s)
 #endif
         addr = s->sh_addr + rel->r_offset;
         relocate(s1, rel, type, ptr, addr, tgt);
+        tcc_stats_add(s1, relocs, 1);
     }
     /* if the relocation is allocated, we change its symbol table */
     if (sr->sh_flags & SHF_ALLOC) {
@@ -1008,6 +1010,51 @@ ST_FUNC void relocate_section(TCCState *s1, Section *s)
     }
 }
 
+/* list the pointer sized slots that relocation filled with an absolute
+   address. 'offset' is relative to 'ptr' as passed to tcc_relocate().
+   'name' is set for symbols that live outside of the relocated code
+   (added with tcc_add_symbol() or resolved with dlsym()) and NULL for
+   addresses inside of it. Returns -1 if there are absolute relocations
+   that are not pointer sized, in which case the code cannot be moved. */
+LIBTCCAPI int tcc_list_relocations(TCCState *s1, void *ptr, void *ctx,
+    void (*reloc_cb)(void *ctx, const char *name, unsigned long offset))
+{
+    Section *s;
+    ElfW_Rel *rel;
+    ElfW(Sym) *sym;
+    int i, type, sym_index, ret = 0;
+    const char *name;
+
+    for (i = 1; i < s1->nb_sections; i++) {
+        s = s1->sections[i];
+        if (!s->reloc || 0 == (s->sh_flags & SHF_ALLOC))
+            continue;
+        for_each_elem(s->reloc, 0, rel, ElfW_Rel) {
+            sym_index = ELFW(R_SYM)(rel->r_info);
+            type = ELFW(R_TYPE)(rel->r_info);
+            if (0 == sym_index)
+                continue;
+            if (type != R_DATA_PTR && type != R_JMP_SLOT && type != R_GLOB_DAT) {
+#if PTR_SIZE == 8
+                if (type == R_DATA_32)
+                    ret = -1;
+#ifdef TCC_TARGET_X86_64
+                if (type == R_X86_64_32)
+                    ret = -1;
+#endif
+#endif
+                continue;
+            }
+            sym = &((ElfW(Sym) *)symtab_section->data)[sym_index];
+            name = NULL;
+            if (sym->st_shndx == SHN_UNDEF || sym->st_shndx == SHN_ABS)
+                name = (char *)symtab_section->link->data + sym->st_name;
+            reloc_cb(ctx, name, s->sh_addr + rel->r_offset - (addr_t)ptr);
+        }
+    }
+    return ret;
+}
+
 #ifndef ELF_OBJ_ONLY
 /* relocate relocation table in 'sr' */
 static void relocate_rel(TCCState *s1, Section *sr)
@@ -41,8 +41,6 @@ ST_DATA Sym *global_label_stack;
 ST_DATA Sym *local_label_stack;
 
 static Sym *sym_free_first;
-static void **sym_pools;
-static int nb_sym_pools;
 
 static Sym *all_cleanups, *pending_gotos;
 static int local_scope;
@@ -558,8 +556,8 @@ ST_FUNC void tccgen_finish(TCCState *s1)
     sym_pop(&local_stack, NULL, 0);
     /* free preprocessor macros */
     free_defines(NULL);
-    /* free sym_pools */
-    dynarray_reset(&sym_pools, &nb_sym_pools);
+    /* park the free symbols in the state, their pools live in its arena */
+    s1->sym_free_first = sym_free_first;
     sym_free_first = NULL;
 }
 
@@ -755,8 +753,14 @@ static Sym *__sym_malloc(void)
     Sym *sym_pool, *sym, *last_sym;
     int i;
 
-    sym_pool = tcc_malloc(SYM_POOL_NB * sizeof(Sym));
-    dynarray_add(&sym_pools, &nb_sym_pools, sym_pool);
+    /* take back the symbols of a previous compilation first */
+    if (tcc_state->sym_free_first) {
+        sym_free_first = tcc_state->sym_free_first;
+        tcc_state->sym_free_first = NULL;
+        return sym_free_first;
+    }
+
+    sym_pool = tcc_arena_alloc(&tcc_state->arena, SYM_POOL_NB * sizeof(Sym));
 
     last_sym = sym_free_first;
     sym = sym_pool;
@@ -769,6 +773,7 @@ static Sym *__sym_malloc(void)
     return last_sym;
 }
 
+
 static inline Sym *sym_malloc(void)
 {
     Sym *sym;
@@ -804,6 +809,7 @@ ST_FUNC Sym *sym_push2(Sym **ps, int v, int t, int c)
     s->v = v;
     s->type.t = t;
     s->c = c;
+    tcc_stats_add(tcc_state, syms, 1);
     /* add in stack */
     s->prev = *ps;
     *ps = s;
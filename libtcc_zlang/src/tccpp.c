@@ -115,7 +115,7 @@ ST_FUNC void expect(const char *msg)
 #define tal_free(al, p) tcc_free(p)
 #define tal_realloc(al, p, size) tcc_realloc(p, size)
 #define tal_new(a,b,c)
-#define tal_delete(a)
+#define tal_rewind(a) NULL
 #else
 #if !defined(MEM_DEBUG)
 #define tal_free(al, p) tal_free_impl(al, p)
@@ -162,52 +162,64 @@ typedef struct tal_header_t {
 
 /* ------------------------------------------------------------------------- */
 
+#ifdef TCC_STATS
+/* allocators are told apart by their unique limits */
+static int tal_stats_tag(TinyAlloc *al)
+{
+    return al->limit == TOKSYM_TAL_LIMIT ? TCC_STATS_TAL_TOKSYM : TCC_STATS_TAL_TOKSTR;
+}
+#endif
+
+/* allocators live in the arena of the state and are released with it */
 static TinyAlloc *tal_new(TinyAlloc **pal, unsigned limit, unsigned size)
 {
-    TinyAlloc *al = tcc_mallocz(sizeof(TinyAlloc));
-    al->p = al->buffer = tcc_malloc(size);
+    TinyAlloc *al = tcc_arena_alloc(&tcc_state->arena, sizeof(TinyAlloc));
+    memset(al, 0, sizeof *al);
+    al->p = al->buffer = tcc_arena_alloc(&tcc_state->arena, size);
     al->limit = limit;
     al->size = size;
     if (pal) *pal = al;
     return al;
 }
 
-static void tal_delete(TinyAlloc *al)
+/* forget all chunks, the buffers are kept for the next compilation */
+static TinyAlloc *tal_rewind(TinyAlloc *top)
 {
-    TinyAlloc *next;
+    TinyAlloc *al;
 
-tail_call:
-    if (!al)
-        return;
+    for (al = top; al; al = al->next) {
 #ifdef TAL_INFO
-    fprintf(stderr, "limit=%5d, size=%5g MB, nb_peak=%6d, nb_total=%8d, nb_missed=%6d, usage=%5.1f%%\n",
-            al->limit, al->size / 1024.0 / 1024.0, al->nb_peak, al->nb_total, al->nb_missed,
-            (al->peak_p - al->buffer) * 100.0 / al->size);
+        fprintf(stderr, "limit=%5d, size=%5g MB, nb_peak=%6d, nb_total=%8d, nb_missed=%6d, usage=%5.1f%%\n",
+                al->limit, al->size / 1024.0 / 1024.0, al->nb_peak, al->nb_total, al->nb_missed,
+                (al->peak_p - al->buffer) * 100.0 / al->size);
 #endif
 #ifdef TAL_DEBUG
-    if (al->nb_allocs > 0) {
-        uint8_t *p;
-        fprintf(stderr, "TAL_DEBUG: memory leak %d chunk(s) (limit= %d)\n",
-                al->nb_allocs, al->limit);
-        p = al->buffer;
-        while (p < al->p) {
-            tal_header_t *header = (tal_header_t *)p;
-            if (header->line_num > 0) {
-                fprintf(stderr, "%s:%d: chunk of %d bytes leaked\n",
-                        header->file_name, header->line_num, header->size);
+        if (al->nb_allocs > 0) {
+            uint8_t *p;
+            fprintf(stderr, "TAL_DEBUG: memory leak %d chunk(s) (limit= %d)\n",
+                    al->nb_allocs, al->limit);
+            p = al->buffer;
+            while (p < al->p) {
+                tal_header_t *header = (tal_header_t *)p;
+                if (header->line_num > 0) {
+                    fprintf(stderr, "%s:%d: chunk of %d bytes leaked\n",
+                            header->file_name, header->line_num, header->size);
+                }
+                p += header->size + sizeof(tal_header_t);
             }
-            p += header->size + sizeof(tal_header_t);
-        }
 #if MEM_DEBUG-0 == 2
-        exit(2);
+            exit(2);
 #endif
-    }
+        }
 #endif
-    next = al->next;
-    tcc_free(al->buffer);
-    tcc_free(al);
-    al = next;
-    goto tail_call;
+        al->nb_allocs = 0;
+        al->p = al->buffer;
+#ifdef TAL_INFO
+        al->nb_peak = al->nb_total = al->nb_missed = 0;
+        al->peak_p = al->buffer;
+#endif
+    }
+    return top;
 }
 
 static void tal_free_impl(TinyAlloc *al, void *p TAL_DEBUG_PARAMS)
@@ -259,6 +271,8 @@ tail_call:
 #endif
             ret = al->p + sizeof(tal_header_t);
             al->p += adj_size + sizeof(tal_header_t);
+            tcc_stats_add(tcc_state, tal_allocs[tal_stats_tag(al)], 1);
+            tcc_stats_add(tcc_state, tal_bytes[tal_stats_tag(al)], adj_size);
             if (is_own) {
                 header = (((tal_header_t *)p) - 1);
                 memcpy(ret, p, header->size);
@@ -310,6 +324,7 @@ tail_call:
         goto tail_call;
     } else
         ret = tcc_realloc(p, size);
+    tcc_stats_add(tcc_state, tal_missed[tal_stats_tag(al)], 1);
 #ifdef TAL_INFO
     al->nb_missed++;
 #endif
@@ -3531,6 +3546,7 @@ no_subst:
 /* return next token with macro substitution */
 ST_FUNC void next(void)
 {
+    tcc_stats_add(tcc_state, tokens, 1);
  redo:
     if (parse_flags & PARSE_FLAG_SPACES)
         next_nomacro_spc();
@@ -3647,9 +3663,13 @@ ST_FUNC void tccpp_new(TCCState *s)
     for(i = 128; i<256; i++)
         set_idnum(i, IS_ID);
 
-    /* init allocators */
-    tal_new(&toksym_alloc, TOKSYM_TAL_LIMIT, TOKSYM_TAL_SIZE);
-    tal_new(&tokstr_alloc, TOKSTR_TAL_LIMIT, TOKSTR_TAL_SIZE);
+    /* init allocators, or take back those of a previous compilation */
+    if (!s->toksym_alloc) {
+        tal_new(&s->toksym_alloc, TOKSYM_TAL_LIMIT, TOKSYM_TAL_SIZE);
+        tal_new(&s->tokstr_alloc, TOKSTR_TAL_LIMIT, TOKSTR_TAL_SIZE);
+    }
+    toksym_alloc = s->toksym_alloc;
+    tokstr_alloc = s->tokstr_alloc;
 
     memset(hash_ident, 0, TOK_HASH_SIZE * sizeof(TokenSym *));
     memset(s->cached_includes_hash, 0, sizeof s->cached_includes_hash);
@@ -3702,10 +3722,10 @@ ST_FUNC void tccpp_delete(TCCState *s)
     cstr_free(&macro_equal_buf);
     tok_str_free_str(tokstr_buf.str);
 
-    /* free allocators */
-    tal_delete(toksym_alloc);
+    /* park allocators in the state, tcc_delete() frees them */
+    s->toksym_alloc = tal_rewind(toksym_alloc);
     toksym_alloc = NULL;
-    tal_delete(tokstr_alloc);
+    s->tokstr_alloc = tal_rewind(tokstr_alloc);
     tokstr_alloc = NULL;
 }
 
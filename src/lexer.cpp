@@ -12,8 +12,79 @@
 #include <stdexcept>
 #include <stream.h>
 #include <math.h>
+#include <hash.hh>
 #include <tcc/libtcc.h>
 
+#ifndef _WIN32
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <condition_variable>
+#include <csetjmp>
+#include <mutex>
+#include <set>
+
+#if defined(__x86_64__) && !defined(_WIN32)
+#define TCC_JIT_LAZY 1
+
+// first call of a lazy function stub, r10 holds the function to compile
+// saves the argument registers (and al for varargs), resolves the function
+// and tail calls it with the original arguments
+extern "C" void * tcc_jit_lazy_resolve(void * function);
+extern "C" void tcc_jit_lazy_entry();
+asm(R"(
+    .text
+    .p2align 4
+    .globl tcc_jit_lazy_entry
+    .type tcc_jit_lazy_entry, @function
+tcc_jit_lazy_entry:
+    push %rbp
+    mov %rsp, %rbp
+    push %rax
+    push %rdi
+    push %rsi
+    push %rdx
+    push %rcx
+    push %r8
+    push %r9
+    sub $136, %rsp
+    movdqu %xmm0, 0(%rsp)
+    movdqu %xmm1, 16(%rsp)
+    movdqu %xmm2, 32(%rsp)
+    movdqu %xmm3, 48(%rsp)
+    movdqu %xmm4, 64(%rsp)
+    movdqu %xmm5, 80(%rsp)
+    movdqu %xmm6, 96(%rsp)
+    movdqu %xmm7, 112(%rsp)
+    mov %r10, %rdi
+    call tcc_jit_lazy_resolve@PLT
+    mov %rax, %r11
+    movdqu 0(%rsp), %xmm0
+    movdqu 16(%rsp), %xmm1
+    movdqu 32(%rsp), %xmm2
+    movdqu 48(%rsp), %xmm3
+    movdqu 64(%rsp), %xmm4
+    movdqu 80(%rsp), %xmm5
+    movdqu 96(%rsp), %xmm6
+    movdqu 112(%rsp), %xmm7
+    add $136, %rsp
+    pop %r9
+    pop %r8
+    pop %rcx
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    pop %rax
+    pop %rbp
+    jmp *%r11
+    .size tcc_jit_lazy_entry, .-tcc_jit_lazy_entry
+)");
+#endif
+
 class tcc_jit {
   static void handle_error(void *opaque, const char *msg) {
       fprintf(static_cast<FILE*>(opaque), "%s\n", msg);
@@ -21,6 +92,702 @@ class tcc_jit {
   
   std::shared_ptr<TCCState> tcc_state;
   std::string binds;
+  bool include_default_defines = true;
+
+  // on-disk code cache
+  //
+  // an entry is a relocated image that has been made position independent,
+  // pointer slots into the image itself are stored relative to 0 and pointer
+  // slots to external symbols (bind_map and dlsym) are stored as a name plus
+  // addend, both are patched after mapping the image at a new address
+  //
+  // layout: Header, base slots, named slots, symbols, image at image_offset
+
+  static constexpr uint32_t CACHE_MAGIC = 0x54494a5a; // ZJIT
+  static constexpr uint32_t CACHE_VERSION = 1;
+  static constexpr uint64_t CACHE_IMAGE_ALIGNMENT = 65536;
+
+  struct CacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;
+    uint64_t bind_key;
+    uint64_t image_offset;
+    uint64_t image_size;
+    uint64_t base_slot_count;
+    uint64_t named_slot_count;
+    uint64_t symbol_count;
+  };
+
+  struct CacheNamedSlot {
+    std::string name;
+    uint64_t offset;
+    int64_t addend;
+  };
+
+  struct CacheEntry {
+    CacheHeader header;
+    std::vector<uint64_t> base_slots;
+    std::vector<CacheNamedSlot> named_slots;
+    std::vector<std::pair<std::string, uint64_t>> symbols;
+  };
+
+  std::string cache_dir;
+  std::shared_ptr<CacheEntry> cache_entry;
+  std::shared_ptr<void> image;
+  size_t image_size = 0;
+
+  // libtcc is not reentrant, lazy functions may be compiled from any thread
+  static std::recursive_mutex & compile_mutex() {
+    static std::recursive_mutex mutex;
+    return mutex;
+  }
+
+  // released states are kept and reset with tcc_reuse(), which keeps their
+  // allocator memory, instead of creating a state for every compilation
+  static constexpr size_t IDLE_STATE_LIMIT = 4;
+
+  static std::vector<TCCState*> & idle_states() {
+    static std::vector<TCCState*> states;
+    return states;
+  }
+
+  static TCCState * acquire_state(bool default_defines) {
+    auto & idle = idle_states();
+    if (idle.empty()) {
+      return tcc_new_with_defines(default_defines);
+    }
+    TCCState * state = idle.back();
+    idle.pop_back();
+    tcc_reuse_with_defines(state, default_defines);
+    return state;
+  }
+
+  static void release_state(TCCState * state) {
+    std::lock_guard<std::recursive_mutex> lock(compile_mutex());
+    auto & idle = idle_states();
+    if (idle.size() < IDLE_STATE_LIMIT) {
+      idle.push_back(state);
+    } else {
+      tcc_delete(state);
+    }
+  }
+
+  std::shared_ptr<TCCState> compile_units(const std::vector<std::string> & units) {
+    std::lock_guard<std::recursive_mutex> lock(compile_mutex());
+    TCCState * state = acquire_state(include_default_defines);
+    if (!state) {
+      std::cout << "failed to create a new tcc state" << std::endl;
+      return nullptr;
+    }
+    std::shared_ptr<TCCState> ret(state, release_state);
+    tcc_set_error_func(state, stderr, handle_error);
+    tcc_set_output_type(state, TCC_OUTPUT_MEMORY);
+    for (auto & o : options) {
+      tcc_set_options(state, o.c_str());
+    }
+    for (auto & unit : units) {
+        std::string code = this->binds + "\n" + unit + "\n";
+        auto r = tcc_compile_string(state, code.c_str());
+        if (r != 0) {
+          std::cout << "failed to compile code: tcc_compile_string() returned " << std::to_string(r) << std::endl;
+          return nullptr;
+        }
+    }
+    return ret;
+  }
+
+  bool compile_objects() {
+    tcc_state.reset();
+    std::vector<std::string> units;
+    for (auto & obj : objects) {
+      units.emplace_back(obj->code);
+    }
+    tcc_state = compile_units(units);
+    return tcc_state != nullptr;
+  }
+
+  // lazy compilation
+  //
+  // each object is split into its top-level items, declarations and eager
+  // functions (main, and functions whose name cannot be determined) are
+  // compiled up front, every other function is bound to a stub that compiles
+  // it on its first call and then patches itself to jump to the compiled body
+  //
+  // a lazy function is compiled on its own against an extern-only version of
+  // its object, which cannot keep file scope 'static' and 'inline' definitions
+  // private to the object, code that has any is compiled eagerly
+
+  struct LazySplit {
+    std::string eager;  // declarations, eager functions, lazy prototypes
+    std::string header; // extern declarations and prototypes only
+    std::vector<std::pair<std::string, std::string>> functions; // name, definition
+  };
+
+  static size_t skip_literal(const std::string & src, size_t i) {
+    char quote = src[i++];
+    while (i < src.size() && src[i] != quote) {
+      if (src[i] == '\\') i++;
+      i++;
+    }
+    return i;
+  }
+
+  static std::string strip_comments(const std::string & src) {
+    std::string out;
+    for (size_t i = 0; i < src.size(); i++) {
+      if (src[i] == '"' || src[i] == '\'') {
+        size_t e = skip_literal(src, i);
+        out.append(src, i, e - i + 1);
+        i = e;
+      } else if (src.compare(i, 2, "//") == 0) {
+        while (i < src.size() && src[i] != '\n') i++;
+        out += '\n';
+      } else if (src.compare(i, 2, "/*") == 0) {
+        size_t e = src.find("*/", i + 2);
+        if (e == std::string::npos) e = src.size();
+        out += ' ';
+        out.append(std::count(src.begin() + i, src.begin() + std::min(e, src.size()), '\n'), '\n');
+        i = e + 1;
+      } else {
+        out += src[i];
+      }
+    }
+    return out;
+  }
+
+  static bool is_ident(char c) {
+    return isalnum(static_cast<unsigned char>(c)) || c == '_';
+  }
+
+  static bool starts_with_word(const std::string & item, const char * word) {
+    size_t i = item.find_first_not_of(" \t\r\n");
+    size_t n = strlen(word);
+    return i != std::string::npos && item.compare(i, n, word) == 0 && (i + n == item.size() || !is_ident(item[i + n]));
+  }
+
+  // true if 'static' or 'inline' is one of the specifiers of a declaration,
+  // splitting it from its unit would change its linkage
+  static bool has_internal_specifier(const std::string & item) {
+    size_t end = item.find_first_of("({[=");
+    if (end == std::string::npos) end = item.size();
+    for (const char * word : { "static", "inline", "__inline", "__inline__" }) {
+      size_t n = strlen(word);
+      for (size_t i = item.find(word); i != std::string::npos && i < end; i = item.find(word, i + 1)) {
+        if ((i == 0 || !is_ident(item[i - 1])) && (i + n == item.size() || !is_ident(item[i + n]))) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  // turns a declaration into one that defines nothing
+  static std::string extern_declaration(const std::string & item) {
+    if (starts_with_word(item, "typedef") || starts_with_word(item, "extern")) return item;
+    if (starts_with_word(item, "struct") || starts_with_word(item, "union") || starts_with_word(item, "enum") || starts_with_word(item, "class")) {
+      // a type definition without declarators
+      size_t i = item.find_first_not_of(" \t\r\n");
+      while (i < item.size() && is_ident(item[i])) i++;
+      i = item.find_first_not_of(" \t\r\n", i);
+      while (i < item.size() && is_ident(item[i])) i++;
+      i = item.find_first_not_of(" \t\r\n", i);
+      if (i < item.size() && item[i] == '{') {
+        int depth = 0;
+        for (; i < item.size(); i++) {
+          if (item[i] == '"' || item[i] == '\'') i = skip_literal(item, i);
+          else if (item[i] == '{') depth++;
+          else if (item[i] == '}' && --depth == 0) break;
+        }
+        i = item.find_first_not_of(" \t\r\n", i + 1);
+      }
+      if (i < item.size() && item[i] == ';') return item;
+    }
+    std::string out = "extern ";
+    int depth = 0;
+    bool initializer = false;
+    for (size_t i = 0; i < item.size(); i++) {
+      char c = item[i];
+      if (c == '"' || c == '\'') {
+        size_t e = skip_literal(item, i);
+        if (!initializer) out.append(item, i, e - i + 1);
+        i = e;
+        continue;
+      }
+      if (c == '(' || c == '[' || c == '{') depth++;
+      else if (c == ')' || c == ']' || c == '}') depth--;
+      else if (depth == 0 && c == '=') initializer = true;
+      else if (depth == 0 && (c == ',' || c == ';')) initializer = false;
+      if (!initializer) out += c;
+    }
+    return out;
+  }
+
+  // the name of a function from the text before its body, empty if it cannot be determined
+  static std::string function_name(const std::string & prefix) {
+    size_t i = prefix.find_last_not_of(" \t\r\n");
+    if (i == std::string::npos || prefix[i] != ')') return "";
+    int depth = 0;
+    for (;; i--) {
+      if (prefix[i] == ')') depth++;
+      else if (prefix[i] == '(' && --depth == 0) break;
+      if (i == 0) return "";
+    }
+    if (i == 0) return "";
+    size_t end = prefix.find_last_not_of(" \t\r\n", i - 1);
+    if (end == std::string::npos || !is_ident(prefix[end])) return "";
+    size_t begin = end;
+    while (begin > 0 && is_ident(prefix[begin - 1])) begin--;
+    std::string name = prefix.substr(begin, end - begin + 1);
+    if (isdigit(static_cast<unsigned char>(name[0])) || name.compare(0, 2, "__") == 0) return "";
+    return name;
+  }
+
+  static bool split_object(const std::string & code, LazySplit & split) {
+    std::string src = strip_comments(code);
+    size_t item_start = 0;
+    int depth = 0;
+    bool line_start = true;
+    for (size_t i = 0; i < src.size(); i++) {
+      char c = src[i];
+      if (depth == 0 && line_start && c == '#') {
+        size_t e = i;
+        while (e < src.size() && src[e] != '\n') {
+          if (src[e] == '\\' && e + 1 < src.size()) e++;
+          e++;
+        }
+        std::string line = src.substr(i, e - i) + "\n";
+        split.eager += line;
+        split.header += line;
+        item_start = i = e;
+        line_start = true;
+        continue;
+      }
+      if (c == '\n') {
+        line_start = true;
+        continue;
+      }
+      if (!isspace(static_cast<unsigned char>(c))) line_start = false;
+      if (c == '"' || c == '\'') {
+        i = skip_literal(src, i);
+      } else if (c == '(' || c == '[') {
+        depth++;
+      } else if (c == ')' || c == ']' || c == '}') {
+        if (--depth < 0) return false;
+      } else if (c == '{') {
+        std::string prefix = src.substr(item_start, i - item_start);
+        size_t last = prefix.find_last_not_of(" \t\r\n");
+        if (depth != 0 || last == std::string::npos || prefix[last] != ')' || starts_with_word(prefix, "typedef")) {
+          depth++;
+          continue;
+        }
+        // function definition
+        size_t e = i;
+        for (int body = 0; e < src.size(); e++) {
+          if (src[e] == '"' || src[e] == '\'') e = skip_literal(src, e);
+          else if (src[e] == '{') body++;
+          else if (src[e] == '}' && --body == 0) break;
+        }
+        if (e >= src.size()) return false;
+        if (has_internal_specifier(prefix)) return false;
+        std::string name = function_name(prefix);
+        std::string definition = prefix + src.substr(i, e - i + 1) + "\n";
+        if (name.empty() || name == "main") {
+          split.eager += definition;
+        } else {
+          split.eager += prefix + ";\n";
+          split.functions.emplace_back(name, definition);
+        }
+        split.header += prefix + ";\n";
+        item_start = i = e + 1;
+        line_start = false;
+        i--;
+      } else if (c == ';' && depth == 0) {
+        std::string item = src.substr(item_start, i - item_start + 1);
+        if (has_internal_specifier(item)) return false;
+        split.eager += item + "\n";
+        split.header += extern_declaration(item) + "\n";
+        item_start = i + 1;
+      }
+    }
+    return depth == 0 && src.find_first_not_of(" \t\r\n", item_start) == std::string::npos;
+  }
+
+  struct LazyFunction {
+    enum { UNCOMPILED, COMPILING, COMPILED, FAILED };
+    tcc_jit * jit;
+    size_t object;
+    std::string name;
+    std::string definition;
+    char * stub;
+    void * target = nullptr;
+    std::shared_ptr<TCCState> state;
+    std::atomic<int> status { UNCOMPILED };
+    std::mutex mutex;
+    std::condition_variable compiled;
+  };
+
+  bool lazy_mode = false;
+  std::vector<std::string> lazy_headers;
+  std::vector<std::unique_ptr<LazyFunction>> lazy_functions;
+  std::vector<std::pair<std::string, void*>> lazy_globals;
+  std::shared_ptr<void> lazy_stubs;
+
+#ifdef TCC_JIT_LAZY
+  // mov r10, function ; jmp [rip] ; .quad target
+  static constexpr size_t LAZY_STUB_SIZE = 24;
+  static constexpr size_t LAZY_STUB_TARGET = 16;
+
+  bool compile_lazy() {
+    lazy_functions.clear();
+    lazy_headers.clear();
+    lazy_globals.clear();
+    lazy_stubs.reset();
+    std::vector<std::string> units;
+    std::set<std::string> names;
+    for (size_t o = 0; o < objects.size(); o++) {
+      LazySplit split;
+      if (!split_object(objects[o]->code, split)) {
+        std::cout << "cannot split code into functions, compiling eagerly" << std::endl;
+        lazy_functions.clear();
+        return compile_objects();
+      }
+      for (auto & f : split.functions) {
+        if (!names.insert(f.first).second) {
+          std::cout << "function [" << f.first << "] is defined more than once, compiling eagerly" << std::endl;
+          lazy_functions.clear();
+          return compile_objects();
+        }
+        auto * function = new LazyFunction();
+        function->jit = this;
+        function->object = o;
+        function->name = f.first;
+        function->definition = f.second;
+        lazy_functions.emplace_back(function);
+      }
+      units.emplace_back(split.eager);
+      lazy_headers.emplace_back(split.header);
+    }
+    if (!lazy_functions.empty()) {
+      size_t size = lazy_functions.size() * LAZY_STUB_SIZE;
+      void * mem = mmap(nullptr, size, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (mem == MAP_FAILED) {
+        std::cout << "failed to allocate lazy function stubs, compiling eagerly" << std::endl;
+        lazy_functions.clear();
+        return compile_objects();
+      }
+      lazy_stubs.reset(mem, [size](void * p){ munmap(p, size); });
+      char * stub = static_cast<char*>(mem);
+      for (auto & f : lazy_functions) {
+        void * function = f.get();
+        void * entry = reinterpret_cast<void*>(&tcc_jit_lazy_entry);
+        const unsigned char code[] = { 0x49, 0xba, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0x25, 0, 0, 0, 0 };
+        memcpy(stub, code, sizeof(code));
+        memcpy(stub + 2, &function, sizeof(function));
+        memcpy(stub + LAZY_STUB_TARGET, &entry, sizeof(entry));
+        f->stub = stub;
+        stub += LAZY_STUB_SIZE;
+      }
+    }
+    tcc_state = compile_units(units);
+    return tcc_state != nullptr;
+  }
+
+  void * compile_lazy_function(LazyFunction & f) {
+    std::lock_guard<std::recursive_mutex> lock(compile_mutex());
+    std::cout << "compiling lazy function [" << f.name << "] ..." << std::endl;
+    f.state = compile_units({ lazy_headers[f.object] + f.definition });
+    TCCState * s = f.state.get();
+    if (s == nullptr) return nullptr;
+    for (auto & map : bind_map) {
+      if (map.second == "N_CRASH") continue;
+      tcc_add_symbol(s, map.second.c_str(), map.first);
+    }
+    for (auto & other : lazy_functions) {
+      if (other.get() != &f) tcc_add_symbol(s, other->name.c_str(), other->stub);
+    }
+    for (auto & global : lazy_globals) {
+      tcc_add_symbol(s, global.first.c_str(), global.second);
+    }
+    if (tcc_relocate(s, TCC_RELOCATE_AUTO) != 0) return nullptr;
+    return tcc_get_symbol(s, f.name.c_str());
+  }
+
+  void * resolve(LazyFunction & f) {
+    int expected = LazyFunction::UNCOMPILED;
+    if (f.status.compare_exchange_strong(expected, LazyFunction::COMPILING)) {
+      void * target = compile_lazy_function(f);
+      if (target) {
+        __atomic_store_n(reinterpret_cast<void**>(f.stub + LAZY_STUB_TARGET), target, __ATOMIC_RELEASE);
+      }
+      {
+        std::lock_guard<std::mutex> lock(f.mutex);
+        f.target = target;
+        f.status = target ? LazyFunction::COMPILED : LazyFunction::FAILED;
+      }
+      f.compiled.notify_all();
+    } else {
+      std::unique_lock<std::mutex> lock(f.mutex);
+      f.compiled.wait(lock, [&f]{ return f.status != LazyFunction::COMPILING; });
+    }
+    if (f.status == LazyFunction::FAILED) {
+      std::cout << "failed to compile lazy function [" << f.name << "]" << std::endl;
+      // the caller is compiled code that cannot handle the failure, the run
+      // that called it ends instead, the frames in between are compiled code
+      // and the lazy stub
+      if (lazy_failure != nullptr) {
+        longjmp(*lazy_failure, 1);
+      }
+      std::cout << "no run to return the failure to on this thread" << std::endl;
+      abort();
+    }
+    return f.target;
+  }
+
+  // the run of main on this thread, which a failed lazy function returns to
+  static inline thread_local jmp_buf * lazy_failure = nullptr;
+
+  static int run_main(int (*m)()) {
+    jmp_buf failed;
+    jmp_buf * outer = lazy_failure;
+    lazy_failure = &failed;
+    if (setjmp(failed) != 0) {
+      lazy_failure = outer;
+      return -1;
+    }
+    int r = m();
+    lazy_failure = outer;
+    return r;
+  }
+#else
+  bool compile_lazy() {
+    std::cout << "lazy compilation is not supported on this platform, compiling eagerly" << std::endl;
+    return compile_objects();
+  }
+
+  static int run_main(int (*m)()) {
+    return m();
+  }
+#endif
+
+  uint64_t cache_key() {
+    uint64_t hash = Hash::FNV1a_64(std::to_string(CACHE_VERSION) + ":" + std::to_string(sizeof(void*)) + ":" + std::to_string(include_default_defines));
+    for (auto & o : options) {
+      hash = Hash::FNV1a_64(o, hash);
+      hash = Hash::FNV1a_64("\n", 1, hash);
+    }
+    hash = Hash::FNV1a_64(binds, hash);
+    for (auto & obj : objects) {
+      hash = Hash::FNV1a_64("\n", 1, hash);
+      hash = Hash::FNV1a_64(obj->code, hash);
+    }
+    return hash;
+  }
+
+  uint64_t cache_bind_key() {
+    uint64_t hash = Hash::FNV1a_64("");
+    for (auto & map : bind_map) {
+      if (map.second == "N_CRASH") continue;
+      hash = Hash::FNV1a_64(map.second, hash);
+      hash = Hash::FNV1a_64("\n", 1, hash);
+    }
+    return hash;
+  }
+
+  std::string cache_path(uint64_t key) {
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.tccjit", (unsigned long long)key);
+    return cache_dir + "/" + name;
+  }
+
+  const void * resolve_symbol(const std::string & name) {
+    for (auto & map : bind_map) {
+      if (map.second == name) return map.first;
+    }
+#ifndef _WIN32
+    return dlsym(RTLD_DEFAULT, name.c_str());
+#else
+    return nullptr;
+#endif
+  }
+
+  std::shared_ptr<CacheEntry> load_cache_entry(uint64_t key) {
+    std::ifstream f(cache_path(key), std::ios::binary);
+    if (!f) return nullptr;
+    std::shared_ptr<CacheEntry> e(new CacheEntry());
+    auto read_string = [&f](std::string & str) {
+      uint32_t len = 0;
+      f.read(reinterpret_cast<char*>(&len), sizeof(len));
+      str.resize(len);
+      f.read(&str[0], len);
+    };
+    f.read(reinterpret_cast<char*>(&e->header), sizeof(e->header));
+    if (!f || e->header.magic != CACHE_MAGIC || e->header.version != CACHE_VERSION || e->header.key != key) return nullptr;
+    e->base_slots.resize(e->header.base_slot_count);
+    f.read(reinterpret_cast<char*>(e->base_slots.data()), e->base_slots.size() * sizeof(uint64_t));
+    e->named_slots.resize(e->header.named_slot_count);
+    for (auto & slot : e->named_slots) {
+      read_string(slot.name);
+      f.read(reinterpret_cast<char*>(&slot.offset), sizeof(slot.offset));
+      f.read(reinterpret_cast<char*>(&slot.addend), sizeof(slot.addend));
+    }
+    e->symbols.resize(e->header.symbol_count);
+    for (auto & sym : e->symbols) {
+      read_string(sym.first);
+      f.read(reinterpret_cast<char*>(&sym.second), sizeof(sym.second));
+    }
+    if (!f) return nullptr;
+    return e;
+  }
+
+  bool map_cache_entry(CacheEntry & e) {
+#ifndef _WIN32
+    int fd = open(cache_path(e.header.key).c_str(), O_RDONLY);
+    if (fd == -1) return false;
+    void * base = mmap(nullptr, e.header.image_size, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE, fd, e.header.image_offset);
+    close(fd);
+    if (base == MAP_FAILED) return false;
+    size_t size = e.header.image_size;
+    image.reset(base, [size](void * p){ munmap(p, size); });
+    image_size = size;
+    char * mem = static_cast<char*>(base);
+    for (auto offset : e.base_slots) {
+      uintptr_t value;
+      memcpy(&value, mem + offset, sizeof(value));
+      value += reinterpret_cast<uintptr_t>(base);
+      memcpy(mem + offset, &value, sizeof(value));
+    }
+    for (auto & slot : e.named_slots) {
+      const void * symbol = resolve_symbol(slot.name);
+      if (symbol == nullptr) {
+        // the code would call through a garbage address, compile it instead
+        std::cout << "cannot resolve symbol [" << slot.name << "] of cached code" << std::endl;
+        image.reset();
+        image_size = 0;
+        return false;
+      }
+      uintptr_t value = reinterpret_cast<uintptr_t>(symbol) + slot.addend;
+      memcpy(mem + slot.offset, &value, sizeof(value));
+    }
+#if defined(__arm__) || defined(__aarch64__) || defined(__riscv)
+    __builtin___clear_cache(mem, mem + size);
+#endif
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  struct RelocationList {
+    std::vector<uint64_t> base_slots;
+    std::vector<std::pair<std::string, uint64_t>> named_slots;
+  };
+
+  void store_cache_entry(char * mem) {
+    RelocationList relocations;
+    if (tcc_list_relocations(tcc_state.get(), mem, &relocations, [](void * ctx, const char * name, unsigned long offset) {
+      auto * r = static_cast<RelocationList*>(ctx);
+      if (name == nullptr) {
+        r->base_slots.emplace_back(offset);
+      } else {
+        r->named_slots.emplace_back(name, offset);
+      }
+    }) != 0) {
+      std::cout << "warning: code cannot be cached, it contains relocations that cannot be moved" << std::endl;
+      return;
+    }
+    std::pair<char*, std::vector<std::pair<std::string, uint64_t>>> symbols;
+    symbols.first = mem;
+    tcc_list_symbols(tcc_state.get(), &symbols, [](void * ctx, const char * name, const void * val) {
+      auto * s = static_cast<std::pair<char*, std::vector<std::pair<std::string, uint64_t>>>*>(ctx);
+      if (name == nullptr || *name == '\0') return;
+      // only symbols inside of the image can be restored from the cache
+      if (val < s->first) return;
+      s->second.emplace_back(name, static_cast<const char*>(val) - s->first);
+    });
+
+    std::string normalized(mem, image_size);
+    for (auto offset : relocations.base_slots) {
+      uintptr_t value;
+      memcpy(&value, &normalized[offset], sizeof(value));
+      value -= reinterpret_cast<uintptr_t>(mem);
+      memcpy(&normalized[offset], &value, sizeof(value));
+    }
+    std::vector<CacheNamedSlot> named_slots;
+    for (auto & slot : relocations.named_slots) {
+      uintptr_t value;
+      memcpy(&value, &normalized[slot.second], sizeof(value));
+      named_slots.push_back({slot.first, slot.second, static_cast<int64_t>(value - reinterpret_cast<uintptr_t>(resolve_symbol(slot.first)))});
+      value = 0;
+      memcpy(&normalized[slot.second], &value, sizeof(value));
+    }
+
+    CacheHeader header {};
+    header.magic = CACHE_MAGIC;
+    header.version = CACHE_VERSION;
+    header.key = cache_key();
+    header.bind_key = cache_bind_key();
+    header.image_size = image_size;
+    header.base_slot_count = relocations.base_slots.size();
+    header.named_slot_count = named_slots.size();
+    header.symbol_count = symbols.second.size();
+
+    std::string table;
+    auto write_string = [&table](const std::string & str) {
+      uint32_t len = str.size();
+      table.append(reinterpret_cast<const char*>(&len), sizeof(len));
+      table.append(str);
+    };
+    table.append(reinterpret_cast<const char*>(relocations.base_slots.data()), relocations.base_slots.size() * sizeof(uint64_t));
+    for (auto & slot : named_slots) {
+      write_string(slot.name);
+      table.append(reinterpret_cast<const char*>(&slot.offset), sizeof(slot.offset));
+      table.append(reinterpret_cast<const char*>(&slot.addend), sizeof(slot.addend));
+    }
+    for (auto & sym : symbols.second) {
+      write_string(sym.first);
+      table.append(reinterpret_cast<const char*>(&sym.second), sizeof(sym.second));
+    }
+    uint64_t end = sizeof(header) + table.size();
+    header.image_offset = (end + CACHE_IMAGE_ALIGNMENT - 1) & ~(CACHE_IMAGE_ALIGNMENT - 1);
+
+    // write to a temporary file first so a concurrent run never maps a partial entry
+    std::string path = cache_path(header.key);
+    std::string tmp = path + "." + std::to_string(getpid());
+    {
+      std::ofstream f(tmp, std::ios::binary | std::ios::trunc);
+      f.write(reinterpret_cast<const char*>(&header), sizeof(header));
+      f.write(table.data(), table.size());
+      f.write(std::string(header.image_offset - end, '\0').data(), header.image_offset - end);
+      f.write(normalized.data(), normalized.size());
+      if (!f) {
+        std::cout << "warning: failed to write code cache entry [" << tmp << "]" << std::endl;
+        f.close();
+        remove(tmp.c_str());
+        return;
+      }
+    }
+    if (rename(tmp.c_str(), path.c_str()) != 0) {
+      remove(tmp.c_str());
+    }
+  }
+
+  // relocates into memory owned by this tcc_jit so the result can be written to the code cache
+  bool relocate_for_cache(TCCState * s) {
+#ifndef _WIN32
+    int size = tcc_relocate(s, nullptr);
+    if (size < 0) return false;
+    void * mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) return false;
+    image.reset(mem, [size](void * p){ munmap(p, size); });
+    image_size = size;
+    if (tcc_relocate(s, mem) != 0) return false;
+    store_cache_entry(static_cast<char*>(mem));
+    return true;
+#else
+    return tcc_relocate(s, TCC_RELOCATE_AUTO) == 0;
+#endif
+  }
   
   public:
 
@@ -46,34 +813,42 @@ class tcc_jit {
   }
   
   bool compile(bool include_default_defines = true) {
-    tcc_state.reset();
-    TCCState * state = tcc_new_with_defines(include_default_defines);
-    if (!state) {
-      std::cout << "failed to create a new tcc state" << std::endl;
-      return false;
+    this->include_default_defines = include_default_defines;
+    cache_entry.reset();
+    if (lazy_mode) {
+      return compile_lazy();
     }
-    tcc_state.reset(state, [](TCCState*state){tcc_delete(state);});
-    tcc_set_error_func(state, stderr, handle_error);
-    tcc_set_output_type(state, TCC_OUTPUT_MEMORY);
-    for (auto & o : options) {
-      tcc_set_options(state, o.c_str());
-    }
-    for (auto & obj : objects) {
-        std::string code = this->binds + "\n" + obj->code + "\n";
-        auto r = tcc_compile_string(state, code.c_str());
-        if (r != 0) {
-          std::cout << "failed to compile code: tcc_compile_string() returned " << std::to_string(r) << std::endl;
-          tcc_state.reset();
-          return false;
-        }
+    if (!cache_dir.empty()) {
+      // a cache entry only exists for code that compiled successfully
+      cache_entry = load_cache_entry(cache_key());
+      if (cache_entry) {
+        tcc_state.reset();
+        return true;
+      }
     }
-    return true;
+    return compile_objects();
   }
   
   std::vector<std::pair<void*, std::string>> bind_map;
   std::vector<std::string> options;
 
   int operator()() {
+    if (cache_entry) {
+      if (cache_entry->header.bind_key == cache_bind_key() && map_cache_entry(*cache_entry)) {
+        std::cout << "loaded code from cache" << std::endl;
+        for (auto & sym : cache_entry->symbols) {
+          if (sym.first == "main") {
+            auto m = reinterpret_cast<int(*)()>(static_cast<char*>(image.get()) + sym.second);
+            return m();
+          }
+        }
+        std::cout << "failed to find symbol [main] in code" << std::endl;
+        return -1;
+      }
+      // the bound symbols changed, compile the objects we skipped
+      cache_entry.reset();
+      if (!compile_objects()) return -1;
+    }
     TCCState * s = tcc_state.get();
     if (s == nullptr) {
       std::cout << "cannot execute code that has not yet been compiled" << std::endl;
@@ -86,21 +861,39 @@ class tcc_jit {
         std::cout << "warning: failed to bind symbol [" << map.second << "]" << std::endl;
       }
     }
+    for (auto & f : lazy_functions) {
+      tcc_add_symbol(s, f->name.c_str(), f->stub);
+    }
     std::cout << "binded symbols" << std::endl;
     
     std::cout << "relocating symbols..." << std::endl;
-    auto r2 = tcc_relocate(s, TCC_RELOCATE_AUTO);
-    if (r2 != 0) {
-      std::cout << "failed to relocate code: tcc_relocate() returned " << std::to_string(r2) << std::endl;
-      return -1;
+    if (!cache_dir.empty() && !lazy_mode) {
+      if (!relocate_for_cache(s)) {
+        std::cout << "failed to relocate code" << std::endl;
+        return -1;
+      }
+    } else {
+      auto r2 = tcc_relocate(s, TCC_RELOCATE_AUTO);
+      if (r2 != 0) {
+        std::cout << "failed to relocate code: tcc_relocate() returned " << std::to_string(r2) << std::endl;
+        return -1;
+      }
     }
     std::cout << "relocated symbols" << std::endl;
+    if (!lazy_functions.empty()) {
+      // lazy functions link against the globals of the eagerly compiled code
+      tcc_list_symbols(s, &lazy_globals, [](void * ctx, const char * name, const void * val) {
+        // names starting with '_' are reserved for the implementation
+        if (name == nullptr || *name == '\0' || *name == '_' || strchr(name, '.')) return;
+        static_cast<std::vector<std::pair<std::string, void*>>*>(ctx)->emplace_back(name, const_cast<void*>(val));
+      });
+    }
     auto m = ((int(*)())tcc_get_symbol(s, "main"));
     if (m == nullptr) {
       std::cout << "failed to find symbol [main] in code" << std::endl;
       return -1;
     }
-    return m();
+    return run_main(m);
   }
   
   template <typename T>
@@ -111,8 +904,31 @@ class tcc_jit {
   void opt(const char * tcc_opt) {
     options.emplace_back(tcc_opt);
   }
+
+  // enables the on-disk code cache, entries are stored in the existing directory 'dir'
+  void cache(const char * dir) {
+    cache_dir = dir;
+  }
+
+  // compiles functions other than main on their first call, the code cache is not used in lazy mode
+  void lazy(bool enable = true) {
+    lazy_mode = enable;
+  }
+
+#ifdef TCC_JIT_LAZY
+  static void * resolve_lazy_function(void * function) {
+    auto * f = static_cast<LazyFunction*>(function);
+    return f->jit->resolve(*f);
+  }
+#endif
 };
 
+#ifdef TCC_JIT_LAZY
+void * tcc_jit_lazy_resolve(void * function) {
+  return tcc_jit::resolve_lazy_function(function);
+}
+#endif
+
 void print(const char * s) {
   std::cout << s << std::endl << std::flush;
 }
@@ -192,6 +1008,24 @@ int main(int argc, char **argv) {
     o.bind(print, "print");
     o();
   }
+  if (false) {
+    // second run maps the image from the cache without invoking the compiler
+    tcc_jit o;
+    o.cache(".");
+    o.add_obj()->println("void print(const char*); void b() { print(\"::b cached\"); } int main() { b(); return 0; }");
+    o.compile();
+    o.bind(print, "print");
+    o();
+  }
+  if (false) {
+    // only main and the functions it reaches are compiled, never() is not
+    tcc_jit o;
+    o.lazy();
+    o.add_obj()->println("void print(const char*); int g = 5; int add(int a, int b) { return a + b + g; } void never() { print(\"never\"); } int main() { print(add(1, 2) == 8 ? \"add\" : \"bad\"); return 0; }");
+    o.compile();
+    o.bind(print, "print");
+    o();
+  }
   if (false) {
     tcc_jit o;
     o.add_obj()->println("void print(const char*); class foo1 { void bar84(float y) { print(\"foo1::bar84\"); } void bar88(int x) { print(\"foo1::bar88\"); } void bar88() { print(\"foo1::bar88 void\"); } }; ");
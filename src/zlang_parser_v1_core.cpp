@@ -9,10 +9,15 @@
 #include <map>
 #include <algorithm>
 #include <Rules_Extra.h>
+#include <tcc/libtcc.h>
 
 const char * zlang_c_compiler;
 const char * zlang_cxx_compiler;
 
+// when true, c objects are compiled and c-only outputs are linked in-process via libtcc
+// the external compilers are only used for c++ objects or when building with --release
+bool zlang_use_libtcc = true;
+
 extern "C" {
   void zlang_create_no_link();
   void zlang_create_static_library(const char * name);
@@ -224,6 +229,56 @@ void zlang_create_c_file(const char * name) { zlang_create_source_file(name, tru
 void zlang_create_cxx_file(const char * name) { zlang_create_source_file(name, false, true); }
 void zlang_create_transpile_file(const char * name) { zlang_create_source_file(name, false, false); }
 
+void zlang_libtcc_handle_error(void * opaque, const char * msg) {
+  fprintf(static_cast<FILE*>(opaque), "%s\n", msg);
+}
+
+TCCState * zlang_libtcc_new(int output_type) {
+  TCCState * state = tcc_new();
+  if (!state) {
+    printf("  error: failed to create a new tcc state\n");
+    exit(1);
+  }
+  tcc_set_error_func(state, stderr, zlang_libtcc_handle_error);
+  tcc_set_output_type(state, output_type);
+  return state;
+}
+
+void zlang_libtcc_build_c_object(zlang_CMD & cmd, zlang_CMD & file) {
+  TCCState * state = zlang_libtcc_new(TCC_OUTPUT_OBJ);
+  for (auto & s : cmd.include_list) {
+    tcc_add_include_path(state, s.c_str());
+  }
+  if (tcc_add_file(state, file.full_name.c_str()) != 0) {
+    printf("  error: failed to compile c object: %s\n", file.name.c_str());
+    tcc_delete(state);
+    exit(1);
+  }
+  if (tcc_output_file(state, (file.full_name + ".o").c_str()) != 0) {
+    printf("  error: failed to write c object: %s.o\n", file.full_name.c_str());
+    tcc_delete(state);
+    exit(1);
+  }
+  tcc_delete(state);
+}
+
+void zlang_libtcc_link_executable(zlang_CMD & cmd) {
+  TCCState * state = zlang_libtcc_new(TCC_OUTPUT_EXE);
+  for (auto & file : cmd.file_list) {
+    if (tcc_add_file(state, (file.full_name + ".o").c_str()) != 0) {
+      printf("error: failed to add object to executable: %s.o\n", file.full_name.c_str());
+      tcc_delete(state);
+      exit(1);
+    }
+  }
+  if (tcc_output_file(state, cmd.full_name.c_str()) != 0) {
+    printf("error: failed to link executable: %s\n", cmd.full_name.c_str());
+    tcc_delete(state);
+    exit(1);
+  }
+  tcc_delete(state);
+}
+
 bool zlang_build_command(zlang_CMD & cmd) {
   bool contains_cxx_files = false;
   for (auto & file : cmd.file_list) {
@@ -236,14 +291,18 @@ bool zlang_build_command(zlang_CMD & cmd) {
     if (file.is_c_object) {
       if (!file.built) {
         printf("  building c object: %s.o\n", file.name.c_str());
-        std::string command = zlang_c_compiler;
-        for (auto & s : cmd.include_list) {
-          command += " -I " + s;
+        if (zlang_use_libtcc) {
+          zlang_libtcc_build_c_object(cmd, file);
+        } else {
+          std::string command = zlang_c_compiler;
+          for (auto & s : cmd.include_list) {
+            command += " -I " + s;
+          }
+          command += " -c ";
+          command += file.full_name + " ";
+          command += "-o " + file.full_name + ".o";
+          system(command.c_str());
         }
-        command += " -c ";
-        command += file.full_name + " ";
-        command += "-o " + file.full_name + ".o";
-        system(command.c_str());
         file.built = true;
       }
     } else if (file.is_cxx_object) {
@@ -279,6 +338,9 @@ void zlang_link_command(zlang_CMD & cmd) {
     printf("linking shared library: %s\n", cmd.name.c_str());
     for (auto & file : cmd.file_list) {
     }
+  } else if (zlang_use_libtcc && !contains_cxx_files) {
+    printf("linking executable: %s\n", cmd.name.c_str());
+    zlang_libtcc_link_executable(cmd);
   } else {
     printf("linking executable: %s\n", cmd.name.c_str());
     std::string command = contains_cxx_files ? zlang_cxx_compiler : zlang_c_compiler;
@@ -1256,7 +1318,10 @@ void translate(ClassInfo * root) {
 int main(int argc, char **argv) {
     zlang_c_compiler = argv[1];
     zlang_cxx_compiler = argv[2];
-    printf("c compiler: %s\n", zlang_c_compiler);
+    if (argc > 4 && strcmp(argv[4], "--release") == 0) {
+      zlang_use_libtcc = false;
+    }
+    printf("c compiler: %s\n", zlang_use_libtcc ? "libtcc" : zlang_c_compiler);
     printf("c++ compiler: %s\n", zlang_cxx_compiler);
     printf("processing file: %s\n", argv[3]);
     if (zlang_push_input(argv[3])) {
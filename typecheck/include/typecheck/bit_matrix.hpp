@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace typecheck {
+	// Square matrix of bits, one row of 64-bit words per index.
+	class BitMatrix {
+	public:
+		using WordType = std::uint64_t;
+		using Row = std::vector<WordType>;
+		static constexpr std::size_t WordBits = 64;
+
+		BitMatrix() = default;
+		~BitMatrix() = default;
+
+		// Grows to n x n, new bits are clear.
+		void resize(std::size_t n);
+		std::size_t size() const noexcept;
+
+		bool test(std::size_t row, std::size_t column) const noexcept;
+		void set(std::size_t row, std::size_t column);
+		const Row& row(std::size_t i) const;
+		// row(dst) |= row(src), returns true if any bit was added
+		bool merge(std::size_t dst, std::size_t src);
+
+		// Helpers for rows built outside of the matrix
+		Row emptyRow() const;
+		static void set(Row& row, std::size_t column);
+		static bool test(const Row& row, std::size_t column) noexcept;
+		static bool intersects(const Row& a, const Row& b) noexcept;
+		static void merge(Row& dst, const Row& src);
+
+	private:
+		std::size_t n = 0;
+		std::vector<Row> rows;
+	};
+}
@@ -53,6 +53,8 @@ namespace typecheck {
 			Types(Types&& other) noexcept;
 			Types& operator=(Types&& other) noexcept;
 
+			bool operator==(const Types& other) const noexcept;
+
 			bool has_first() const;
 			const TypeVar& first() const;
 			TypeVar* mutable_first();
@@ -80,6 +82,8 @@ namespace typecheck {
 			ExplicitType(ExplicitType&& other) noexcept;
 			ExplicitType& operator=(ExplicitType&& other) noexcept;
 
+			bool operator==(const ExplicitType& other) const noexcept;
+
 			bool has_type() const;
 			Type* mutable_type();
 			const Type& type() const;
@@ -97,6 +101,8 @@ namespace typecheck {
 
 		class Member {
 		public:
+			bool operator==(const Member& other) const noexcept;
+
 			const TypeVar& first() const;
 			const TypeVar& second() const;
 
@@ -118,6 +124,8 @@ namespace typecheck {
 			Overload(Overload&& other) noexcept;
 			Overload& operator=(Overload&& other) noexcept;
 
+			bool operator==(const Overload& other) const noexcept;
+
 			long long functionid() const;
 			void set_functionid(const long long functionid);
 
@@ -152,6 +160,8 @@ namespace typecheck {
 			Conforms(Conforms&& other) noexcept;
 			Conforms& operator=(Conforms&& other) noexcept;
 
+			bool operator==(const Conforms& other) const noexcept;
+
 			bool has_protocol() const;
 			const KnownProtocolKind& protocol() const;
 			KnownProtocolKind* mutable_protocol();
@@ -18,7 +18,6 @@ namespace typecheck {
 		bool setResolvedType(const TypeVar& var, const Type& type);
 
 	private:
-        // The key must be string, because 'typeVar' not comparable.
-        std::unordered_map<std::string, Type> resolvedTypes;
+        std::unordered_map<TypeVar::IDType, Type> resolvedTypes;
 	};
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "interner.hpp"
+
 #include <vector>
 #include <memory>
 #include <string>
@@ -29,7 +31,8 @@ namespace typecheck {
 		Type* mutable_returntype();
 		bool has_returntype() const;
 
-		std::string name() const;
+		const std::string& name() const;
+		Interner::IDType name_id() const noexcept;
         void set_name(const std::string& name);
 
 		long long id() const;
@@ -43,7 +46,8 @@ namespace typecheck {
 		// This one is a ptr so we can forward-declare it
 		mutable std::unique_ptr<Type> _returnType;
 
-		std::string _name;
+		Interner::IDType _nameID;
+		const std::string* _name;
 		long long _id;
 	};
 }
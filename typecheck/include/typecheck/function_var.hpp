@@ -23,7 +23,7 @@ namespace typecheck {
         std::string serialize() const;
         static FunctionVar unserialize(const std::string& str);
 
-        std::string name() const;
+        const std::string& name() const;
 
 	private:
 		std::vector<TypeVar> _args;
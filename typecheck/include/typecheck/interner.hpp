@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace typecheck {
+	// Maps the names of types and type variables to 32-bit handles, so they can be
+	// compared and hashed without touching the strings.  The names are only kept
+	// around for diagnostics.  Handles are never released, and are shared between
+	// every TypeManager in the process.
+	class Interner {
+	public:
+		using IDType = std::uint32_t;
+
+		// The handle of the empty name, used by default-constructed types and vars.
+		static constexpr IDType EmptyID = 0;
+
+		Interner();
+		~Interner() = default;
+
+		// Not moveable or copyable, handed out names point into it.
+		Interner(const Interner&) = delete;
+		Interner& operator=(const Interner&) = delete;
+
+		IDType intern(std::string_view name);
+		std::optional<IDType> find(std::string_view name) const;
+
+		// The returned reference stays valid for the lifetime of the interner.
+		const std::string& name(const IDType id) const;
+		std::size_t size() const;
+
+		static Interner& global();
+
+	private:
+		mutable std::shared_mutex mutex;
+		// Deque, so references to the names are stable when it grows.
+		std::deque<std::string> names;
+		std::unordered_map<std::string_view, IDType> ids;
+	};
+}
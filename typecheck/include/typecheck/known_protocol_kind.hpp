@@ -47,6 +47,8 @@ namespace typecheck {
 		KnownProtocolKind(const LiteralProtocol& l) : _data(l) {}
 		~KnownProtocolKind() = default;
 
+		bool operator==(const KnownProtocolKind& other) const noexcept;
+
 		const LiteralProtocol& literal() const;
 		void set_literal(const LiteralProtocol& literal);
 		bool has_literal() const;
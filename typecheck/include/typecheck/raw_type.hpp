@@ -1,23 +1,34 @@
 #pragma once
 
+#include "interner.hpp"
+
 #include <string>
 
 namespace typecheck {
 	class RawType {
 	public:
-		RawType(std::string  n = "");
+		using IDType = Interner::IDType;
+
+		RawType(const std::string& n = "");
 		~RawType() = default;
 
+		// Creates the type from a handle returned by id(), without a lookup.
+		static RawType FromID(const IDType id);
+
 		void CopyFrom(const RawType& other);
 
 		bool operator==(const RawType& other) const noexcept;
 		bool operator!=(const RawType& other) const noexcept;
 
-		std::string name() const;
+		// The interned handle of the name, cheap to compare and hash.
+		IDType id() const noexcept;
+
+		const std::string& name() const;
 		void set_name(const std::string& name);
 
 		std::string ShortDebugString() const;
 	private:
-		std::string _name;
+		IDType _id;
+		const std::string* _name;
 	};
 }
@@ -20,6 +20,9 @@ namespace typecheck {
 
 		bool operator==(const Type& other) const noexcept;
 
+		// Structural hash, consistent with operator==
+		std::size_t hash() const noexcept;
+
 		Type& CopyFrom(const Type& other);
 
 		bool has_raw() const;
@@ -37,3 +40,12 @@ namespace typecheck {
 		mutable std::variant<bool, RawType, FunctionDefinition> data;
 	};
 }
+
+namespace std {
+	template<>
+	struct hash<typecheck::Type> {
+		std::size_t operator()(const typecheck::Type& type) const noexcept {
+			return type.hash();
+		}
+	};
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "bit_matrix.hpp"
 #include "constraint.hpp"
 #include "constraint_pass.hpp"
 #include "function_var.hpp"
@@ -10,6 +11,8 @@
 #include <vector>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <optional>
 
 namespace typecheck {
@@ -32,12 +35,16 @@ namespace typecheck {
 		bool hasRegisteredType(const Type& name) const noexcept;
         Type getRegisteredType(const std::string& name) const noexcept;
 		Type getRegisteredType(const Type& name) const noexcept;
+		// By interned handle (RawType::id()), avoids hashing the name
+		bool hasRegisteredType(const RawType::IDType id) const noexcept;
+		Type getRegisteredType(const RawType::IDType id) const noexcept;
 
-		// 'Register' convertible types
+		// 'Register' convertible types, conversions are transitive
         bool setConvertible(const std::string& T0, const std::string& T1);
 		bool setConvertible(const Type& T0, const Type& T1);
         bool isConvertible(const std::string& T0, const std::string& T1) const noexcept;
 		bool isConvertible(const Type& T0, const Type& T1) const noexcept;
+		bool isConvertible(const RawType::IDType T0, const RawType::IDType T1) const noexcept;
         std::vector<Type> getConvertible(const Type& T0) const;
 
 		const typecheck::TypeVar CreateTypeVar();
@@ -59,13 +66,20 @@ namespace typecheck {
 
 	private:
 		std::vector<Type> registeredTypes;
-		std::set<std::string> registeredTypeVars;
-		std::map<std::string, std::set<std::string>> convertible;
-		std::vector<FunctionVar> functions;
+		// Position of each type in registeredTypes
+		std::unordered_map<Type, std::size_t> registeredTypeIndex;
+		std::unordered_set<TypeVar::IDType> registeredTypeVars;
+		// Direct conversions, keyed by interned type name
+		std::map<RawType::IDType, std::set<RawType::IDType>> convertible;
+		// Transitive closure of convertible, by position in registeredTypes
+		BitMatrix convertibleClosure;
+		// The overloads of a function are stored together, in the order they were created
+		std::vector<std::vector<FunctionVar>> functionFamilies;
+		std::unordered_map<Constraint::IDType, std::size_t> functionFamilyIndex;
 
 		GenericTypeGenerator type_generator;
 		GenericTypeGenerator constraint_generator;
-        std::vector<FunctionVar> getFunctionOverloads(const Constraint::IDType& funcID) const;
+        const std::vector<FunctionVar>& getFunctionOverloads(const Constraint::IDType& funcID) const;
 
         // Internal helper
         Constraint* getConstraintInternal(const Constraint::IDType id);
@@ -1,24 +1,43 @@
 #pragma once
 
+#include "interner.hpp"
+
+#include <functional>
 #include <string>
 
 namespace typecheck {
 	class TypeVar {
 	public:
-		TypeVar(std::string s = "");
+		using IDType = Interner::IDType;
+
+		TypeVar(const std::string& s = "");
 		~TypeVar() = default;
 
 		bool operator==(const TypeVar& other) const noexcept;
 		bool operator!=(const TypeVar& other) const noexcept;
+		// Orders by id, which is the order the symbols were first interned.
 		bool operator<(const TypeVar& other) const noexcept;
 
 		void CopyFrom(const TypeVar& other);
 
-		std::string symbol() const;
+		// The interned handle of the symbol, cheap to compare and hash.
+		IDType id() const noexcept;
+
+		const std::string& symbol() const;
 		void set_symbol(const std::string& s);
 
 		std::string ShortDebugString() const;
 	private:
-		std::string _symbol;
+		IDType _id;
+		const std::string* _symbol;
+	};
+}
+
+namespace std {
+	template<>
+	struct hash<typecheck::TypeVar> {
+		std::size_t operator()(const typecheck::TypeVar& var) const noexcept {
+			return std::hash<typecheck::TypeVar::IDType>()(var.id());
+		}
 	};
 }
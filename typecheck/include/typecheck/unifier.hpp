@@ -0,0 +1,102 @@
+#pragma once
+
+#include "known_protocol_kind.hpp"
+#include "literal_protocol.hpp"
+#include "type_var.hpp"
+#include "union_find.hpp"
+
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace typecheck {
+	// Linear pre-pass of TypeManager::solve.  Equal constraints collapse type
+	// variables into classes, and Bind and literal constraints narrow down the
+	// candidate types of a whole class at once.  Classes that are not touched
+	// by any residual (conversion or overload) constraint are resolved right
+	// away, only the others need to be searched.
+	class Unifier {
+	public:
+		using Domain = std::vector<std::string>;
+
+		Unifier() = default;
+		~Unifier() = default;
+
+		// Gathering, in any order
+		void add(const TypeVar& var);
+		void unify(const TypeVar& a, const TypeVar& b);
+		void bind(const TypeVar& var, const std::string& type);
+		void conformsTo(const TypeVar& var, KnownProtocolKind::LiteralProtocol kind, const LiteralProtocol& protocol);
+		void restrict(const TypeVar& var, const Domain& domain);
+		void markResidual(const TypeVar& var);
+		// The type the class of var is bound to so far, if any
+		std::optional<std::string> bound(const TypeVar& var);
+		// Hands id out of takeReady() once the class of var is bound
+		void watch(const TypeVar& var, std::size_t id);
+		std::vector<std::size_t> takeReady();
+
+		// Computes the candidates of every class, out of the universe of all
+		// types.  Fails if any class has none left.
+		bool resolve(const Domain& universe);
+
+		// After resolve()
+		const std::vector<TypeVar>& variables() const noexcept;
+		const TypeVar& representative(const TypeVar& var) const;
+		bool isResidual(const TypeVar& var) const;
+		// Ordered by how many of the literal protocols of the class prefer them
+		const Domain& candidates(const TypeVar& var) const;
+		const std::vector<KnownProtocolKind::LiteralProtocol>& literals(const TypeVar& var) const;
+		// The preferred candidate, the value of classes that are not residual
+		const std::string& value(const TypeVar& var) const;
+		// Drops the candidates of the class that keep() rejects, returns how many
+		std::size_t prune(const TypeVar& var, const std::function<bool(const std::string&)>& keep);
+
+	private:
+		struct Literal {
+			Domain preferred;
+			Domain all;
+		};
+
+		struct Class {
+			std::optional<std::string> bound;
+			bool conflict = false;
+			bool residual = false;
+			std::vector<KnownProtocolKind::LiteralProtocol> literals;
+			std::vector<std::size_t> restrictions;
+			// Empty when the class is not restricted at all, see unrestricted
+			Domain candidates;
+			bool unrestricted = false;
+		};
+
+		UnionFind::IndexType index(const TypeVar& var) const;
+		void bindRoot(UnionFind::IndexType root, const std::string& type);
+		void wake(UnionFind::IndexType root);
+		bool narrow(Class& c) const;
+
+		UnionFind sets;
+		std::vector<TypeVar> vars;
+		std::unordered_map<TypeVar::IDType, UnionFind::IndexType> indices;
+
+		// Kept on the root of each class while gathering
+		std::vector<std::optional<std::string>> binds;
+		std::vector<bool> conflicts;
+		std::vector<std::vector<std::size_t>> watchers;
+		std::vector<std::size_t> ready;
+		std::vector<std::pair<UnionFind::IndexType, KnownProtocolKind::LiteralProtocol>> conforms;
+		std::vector<std::pair<UnionFind::IndexType, std::size_t>> restricted;
+		std::vector<UnionFind::IndexType> residuals;
+
+		std::map<KnownProtocolKind::LiteralProtocol, Literal> literalDomains;
+		std::vector<Domain> restrictionDomains;
+
+		Domain universe;
+		std::unordered_set<std::string> universeSet;
+		// Filled by resolve(), indexed by variable
+		std::vector<UnionFind::IndexType> roots;
+		std::vector<Class> classes;
+	};
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace typecheck {
+	// Disjoint sets over dense indices, with path halving and union by size.
+	// All operations are amortized near-constant time.
+	class UnionFind {
+	public:
+		using IndexType = std::size_t;
+
+		UnionFind() = default;
+		~UnionFind() = default;
+
+		// Adds a new singleton set, returns its index.
+		IndexType add();
+
+		IndexType find(IndexType i);
+		// Merges the sets of a and b, returns the new root.
+		IndexType merge(IndexType a, IndexType b);
+		bool same(IndexType a, IndexType b);
+
+		std::size_t size() const noexcept;
+		std::size_t setSize(IndexType i);
+
+	private:
+		std::vector<IndexType> parent;
+		std::vector<std::size_t> sizes;
+	};
+}
@@ -0,0 +1,74 @@
+#include <typecheck/bit_matrix.hpp>
+
+using namespace typecheck;
+
+auto BitMatrix::resize(std::size_t n_) -> void {
+	if (n_ <= this->n) {
+		return;
+	}
+
+	this->n = n_;
+	const auto words = (n_ + WordBits - 1) / WordBits;
+	this->rows.resize(n_);
+	for (auto& r : this->rows) {
+		r.resize(words, 0);
+	}
+}
+
+auto BitMatrix::size() const noexcept -> std::size_t {
+	return this->n;
+}
+
+auto BitMatrix::test(std::size_t r, std::size_t column) const noexcept -> bool {
+	return r < this->n && column < this->n && test(this->rows[r], column);
+}
+
+auto BitMatrix::set(std::size_t r, std::size_t column) -> void {
+	set(this->rows.at(r), column);
+}
+
+auto BitMatrix::row(std::size_t i) const -> const Row& {
+	return this->rows.at(i);
+}
+
+auto BitMatrix::merge(std::size_t dst, std::size_t src) -> bool {
+	auto& to = this->rows.at(dst);
+	const auto& from = this->rows.at(src);
+
+	bool changed = false;
+	for (std::size_t w = 0; w < to.size(); ++w) {
+		const auto merged = to[w] | from[w];
+		changed = changed || merged != to[w];
+		to[w] = merged;
+	}
+	return changed;
+}
+
+auto BitMatrix::emptyRow() const -> Row {
+	return Row((this->n + WordBits - 1) / WordBits, 0);
+}
+
+auto BitMatrix::set(Row& r, std::size_t column) -> void {
+	r.at(column / WordBits) |= WordType{1} << (column % WordBits);
+}
+
+auto BitMatrix::test(const Row& r, std::size_t column) noexcept -> bool {
+	const auto word = column / WordBits;
+	return word < r.size() && (r[word] >> (column % WordBits)) & 1;
+}
+
+auto BitMatrix::intersects(const Row& a, const Row& b) noexcept -> bool {
+	const auto words = a.size() < b.size() ? a.size() : b.size();
+	for (std::size_t w = 0; w < words; ++w) {
+		if (a[w] & b[w]) {
+			return true;
+		}
+	}
+	return false;
+}
+
+auto BitMatrix::merge(Row& dst, const Row& src) -> void {
+	for (std::size_t w = 0; w < dst.size() && w < src.size(); ++w) {
+		dst[w] |= src[w];
+	}
+}
@@ -14,16 +14,16 @@ auto ConstraintPass::getResolvedType(const TypeVar& var) const -> Type {
         return type;
     }
 
-    return this->resolvedTypes.at(var.symbol());
+    return this->resolvedTypes.at(var.id());
 }
 
 auto ConstraintPass::hasResolvedType(const TypeVar& var) const -> bool {
-    return this->resolvedTypes.find(var.symbol()) != this->resolvedTypes.end();
+    return this->resolvedTypes.find(var.id()) != this->resolvedTypes.end();
 }
 
 auto ConstraintPass::setResolvedType(const TypeVar& var, const Type& type) -> bool {
-    if (!var.symbol().empty()) {
-        this->resolvedTypes[var.symbol()] = type;
+    if (var.id() != Interner::EmptyID) {
+        this->resolvedTypes[var.id()] = type;
         return true;
     }
 
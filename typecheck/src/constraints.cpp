@@ -23,6 +23,10 @@ auto Constraint::Conforms::operator=(Conforms&& other) noexcept -> Conforms& {
 	return *this;
 }
 
+auto Constraint::Conforms::operator==(const Conforms& other) const noexcept -> bool {
+	return this->_protocol == other._protocol && this->_type == other._type;
+}
+
 auto Constraint::Conforms::has_type() const -> bool {
 	return this->_type.has_value();
 }
@@ -85,6 +89,10 @@ auto Constraint::Types::operator=(Types&& other) noexcept -> Types& {
 
 Constraint::Types::Types(const Types& other)  = default;
 
+auto Constraint::Types::operator==(const Types& other) const noexcept -> bool {
+	return this->_first == other._first && this->_second == other._second && this->_third == other._third;
+}
+
 auto Constraint::Types::has_first() const -> bool {
 	return this->_first.has_value();
 }
@@ -167,6 +175,10 @@ auto Constraint::ExplicitType::operator=(ExplicitType&& other) noexcept -> Const
 	return *this;
 }
 
+auto Constraint::ExplicitType::operator==(const ExplicitType& other) const noexcept -> bool {
+	return this->_var == other._var && this->_type == other._type;
+}
+
 auto Constraint::ExplicitType::mutable_var() -> TypeVar* {
 	if (!this->has_var()) {
 		this->_var = TypeVar{};
@@ -215,6 +227,10 @@ auto Constraint::ExplicitType::ShortDebugString() const -> std::string {
 	return out;
 }
 
+auto Constraint::Member::operator==(const Member& other) const noexcept -> bool {
+	return this->_first == other._first && this->_second == other._second;
+}
+
 Constraint::Overload::Overload() = default;
 
 Constraint::Overload::Overload(Overload&& other) noexcept : _type(std::move(other._type)), _functionID(other._functionID), _argVars(std::move(other._argVars)), _returnVar(other._returnVar) {}
@@ -241,6 +257,13 @@ auto Constraint::Overload::operator=(const Overload& other) -> Overload& {
 	return *this;
 }
 
+auto Constraint::Overload::operator==(const Overload& other) const noexcept -> bool {
+	return this->_functionID == other._functionID &&
+		this->_type == other._type &&
+		this->_returnVar == other._returnVar &&
+		this->_argVars == other._argVars;
+}
+
 auto Constraint::Overload::add_argvars() -> TypeVar* {
 	this->_argVars.emplace_back();
 	return &this->_argVars.at(this->_argVars.size() - 1);
@@ -306,7 +329,8 @@ auto Constraint::Overload::ShortDebugString() const -> std::string {
 Constraint::Constraint() : _kind() {}
 
 auto Constraint::operator==(const Constraint& other) const -> bool {
-	return this->ShortDebugString() == other.ShortDebugString();
+	// Compares the interned handles, rather than rendering both constraints
+	return this->_id == other._id && this->_kind == other._kind && this->data == other.data;
 }
 
 auto Constraint::has_explicit_() const -> bool {
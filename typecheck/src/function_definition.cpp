@@ -3,7 +3,7 @@
 using namespace typecheck;
 
 
-FunctionDefinition::FunctionDefinition()  = default;
+FunctionDefinition::FunctionDefinition() : _nameID(Interner::EmptyID), _name(&Interner::global().name(Interner::EmptyID)), _id(0) {}
 
 FunctionDefinition::FunctionDefinition(const FunctionDefinition& other) {
 	this->CopyFrom(other);
@@ -26,13 +26,14 @@ void FunctionDefinition::CopyFrom(const FunctionDefinition& other) {
 		this->_returnType->CopyFrom(other.returntype());
 	}
 
+	this->_nameID = other._nameID;
 	this->_name = other._name;
 	this->_id = other._id;
 }
 
 auto FunctionDefinition::operator==(const FunctionDefinition& other) const noexcept -> bool {
 	const auto args_same = this->args_size() == other.args_size() &&
-		this->name() == other.name() &&
+		this->_nameID == other._nameID &&
 		this->id() == other.id() &&
 		this->has_returntype() == other.has_returntype() &&
 		// This is the most expensive, do it last
@@ -80,12 +81,18 @@ auto FunctionDefinition::args(std::size_t i) const -> const Type& {
 	return this->_args.at(i);
 }
 
-auto FunctionDefinition::name() const -> std::string {
-	return this->_name;
+auto FunctionDefinition::name() const -> const std::string& {
+	return *this->_name;
+}
+
+auto FunctionDefinition::name_id() const noexcept -> Interner::IDType {
+	return this->_nameID;
 }
 
 void FunctionDefinition::set_name(const std::string& name) {
-    this->_name = name;
+	auto& interner = Interner::global();
+	this->_nameID = interner.intern(name);
+	this->_name = &interner.name(this->_nameID);
 }
 
 auto FunctionDefinition::id() const -> long long {
@@ -99,7 +106,7 @@ void FunctionDefinition::set_id(long long id) {
 std::string FunctionDefinition::ShortDebugString() const {
 	std::string out;
 	out += "{ ";
-	out += "\"name\": \"" + this->_name + "\", ";
+	out += "\"name\": \"" + this->name() + "\", ";
 	if (this->has_returntype()) {
 		out += "\"returnType\": \"" + this->returntype().ShortDebugString() + "\", ";
 	}
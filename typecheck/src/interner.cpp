@@ -0,0 +1,63 @@
+#include <typecheck/interner.hpp>
+#include <typecheck/debug.hpp>
+
+#include <limits>
+#include <mutex>
+
+using namespace typecheck;
+
+Interner::Interner() {
+	this->names.emplace_back();
+	this->ids.emplace(this->names.back(), EmptyID);
+}
+
+auto Interner::intern(std::string_view name) -> IDType {
+	if (name.empty()) {
+		return EmptyID;
+	}
+
+	{
+		std::shared_lock<std::shared_mutex> lock(this->mutex);
+		const auto it = this->ids.find(name);
+		if (it != this->ids.end()) {
+			return it->second;
+		}
+	}
+
+	std::unique_lock<std::shared_mutex> lock(this->mutex);
+	// Another thread may have interned it in the meantime.
+	const auto it = this->ids.find(name);
+	if (it != this->ids.end()) {
+		return it->second;
+	}
+
+	TYPECHECK_ASSERT(this->names.size() < std::numeric_limits<IDType>::max(), "Too many interned names.");
+	const auto id = static_cast<IDType>(this->names.size());
+	this->names.emplace_back(name);
+	this->ids.emplace(this->names.back(), id);
+	return id;
+}
+
+auto Interner::find(std::string_view name) const -> std::optional<IDType> {
+	std::shared_lock<std::shared_mutex> lock(this->mutex);
+	const auto it = this->ids.find(name);
+	if (it == this->ids.end()) {
+		return std::nullopt;
+	}
+	return it->second;
+}
+
+auto Interner::name(const IDType id) const -> const std::string& {
+	std::shared_lock<std::shared_mutex> lock(this->mutex);
+	return this->names.at(id);
+}
+
+auto Interner::size() const -> std::size_t {
+	std::shared_lock<std::shared_mutex> lock(this->mutex);
+	return this->names.size();
+}
+
+auto Interner::global() -> Interner& {
+	static Interner interner;
+	return interner;
+}
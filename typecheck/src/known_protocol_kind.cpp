@@ -24,6 +24,10 @@ auto literal_to_str(const KnownProtocolKind::LiteralProtocol& literal) -> std::s
 	}
 }
 
+auto KnownProtocolKind::operator==(const KnownProtocolKind& other) const noexcept -> bool {
+	return this->_data == other._data;
+}
+
 auto KnownProtocolKind::literal() const -> const LiteralProtocol& {
 	return std::get<LiteralProtocol>(this->_data);
 }
@@ -1,30 +1,45 @@
 #include <typecheck/type.hpp>
-#include <utility>
 
 using namespace typecheck;
 
-RawType::RawType(std::string n) : _name(std::move(n)) {}
+RawType::RawType(const std::string& n) {
+	this->set_name(n);
+}
+
+auto RawType::FromID(const IDType id) -> RawType {
+	RawType type;
+	type._id = id;
+	type._name = &Interner::global().name(id);
+	return type;
+}
 
 void RawType::CopyFrom(const RawType& other) {
-	this->_name = other.name();
+	this->_id = other._id;
+	this->_name = other._name;
 }
 
 auto RawType::operator==(const RawType& other) const noexcept -> bool {
-	return this->name() == other.name();
+	return this->_id == other._id;
 }
 
 auto RawType::operator!=(const RawType& other) const noexcept -> bool {
 	return !(*this == other);
 }
 
-auto RawType::name() const -> std::string {
-	return this->_name;
+auto RawType::id() const noexcept -> IDType {
+	return this->_id;
+}
+
+auto RawType::name() const -> const std::string& {
+	return *this->_name;
 }
 
 void RawType::set_name(const std::string& name) {
-	this->_name = name;
+	auto& interner = Interner::global();
+	this->_id = interner.intern(name);
+	this->_name = &interner.name(this->_id);
 }
 
 auto RawType::ShortDebugString() const -> std::string {
-	return "{ \"name\": \"" + this->_name + "\" }";
+	return "{ \"name\": \"" + this->name() + "\" }";
 }
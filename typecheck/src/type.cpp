@@ -46,6 +46,30 @@ auto Type::operator==(const Type& other) const noexcept -> bool {
 	}
 }
 
+namespace {
+	void hash_combine(std::size_t& seed, const std::size_t value) {
+		seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+	}
+}
+
+auto Type::hash() const noexcept -> std::size_t {
+	std::size_t seed = this->data.index();
+	if (this->has_raw()) {
+		hash_combine(seed, this->raw().id());
+	} else if (this->has_func()) {
+		const auto& func = this->func();
+		hash_combine(seed, func.name_id());
+		hash_combine(seed, std::hash<long long>()(func.id()));
+		for (std::size_t i = 0; i < func.args_size(); ++i) {
+			hash_combine(seed, func.args(i).hash());
+		}
+		if (func.has_returntype()) {
+			hash_combine(seed, func.returntype().hash());
+		}
+	}
+	return seed;
+}
+
 auto Type::CopyFrom(const Type& other) -> Type& {
 	if (this == &other) {
 		return *this;
@@ -36,8 +36,8 @@ auto TypeManager::CreateEqualsConstraint(const TypeVar& t0, const TypeVar& t1) -
 	TYPECHECK_ASSERT(!t0.symbol().empty(), "Cannot use empty type when creating constraint.");
 	TYPECHECK_ASSERT(!t1.symbol().empty(), "Cannot use empty type when creating constraint.");
 
-	TYPECHECK_ASSERT(this->registeredTypeVars.find(t0.symbol()) != this->registeredTypeVars.end(), "Must create type var before using.");
-	TYPECHECK_ASSERT(this->registeredTypeVars.find(t1.symbol()) != this->registeredTypeVars.end(), "Must create type var before using.");
+	TYPECHECK_ASSERT(this->registeredTypeVars.find(t0.id()) != this->registeredTypeVars.end(), "Must create type var before using.");
+	TYPECHECK_ASSERT(this->registeredTypeVars.find(t1.id()) != this->registeredTypeVars.end(), "Must create type var before using.");
 
 	constraint.mutable_types()->mutable_first()->CopyFrom(t0);
 	constraint.mutable_types()->mutable_second()->CopyFrom(t1);
@@ -55,7 +55,7 @@ auto TypeManager::CreateLiteralConformsToConstraint(const TypeVar& t0, const Kno
 	auto constraint = getNewBlankConstraint(ConstraintKind::ConformsTo, this->constraint_generator.next_id());
 
 	TYPECHECK_ASSERT(!t0.symbol().empty(), "Cannot use empty type when creating constraint.");
-	TYPECHECK_ASSERT(this->registeredTypeVars.find(t0.symbol()) != this->registeredTypeVars.end(), "Must create type var before using.");
+	TYPECHECK_ASSERT(this->registeredTypeVars.find(t0.id()) != this->registeredTypeVars.end(), "Must create type var before using.");
 
 	constraint.mutable_conforms()->mutable_type()->CopyFrom(t0);
 	constraint.mutable_conforms()->mutable_protocol()->set_literal(protocol);
@@ -73,10 +73,10 @@ auto TypeManager::CreateConvertibleConstraint(const TypeVar& T0, const TypeVar&
     auto constraint = getNewBlankConstraint(ConstraintKind::Conversion, this->constraint_generator.next_id());
 
     TYPECHECK_ASSERT(!T0.symbol().empty(), "Cannot use empty type when creating constraint.");
-    TYPECHECK_ASSERT(this->registeredTypeVars.find(T0.symbol()) != this->registeredTypeVars.end(), "Must create type var before using.");
+    TYPECHECK_ASSERT(this->registeredTypeVars.find(T0.id()) != this->registeredTypeVars.end(), "Must create type var before using.");
 
     TYPECHECK_ASSERT(!T1.symbol().empty(), "Cannot use empty type when creating constraint.");
-    TYPECHECK_ASSERT(this->registeredTypeVars.find(T1.symbol()) != this->registeredTypeVars.end(), "Must create type var before using.");
+    TYPECHECK_ASSERT(this->registeredTypeVars.find(T1.id()) != this->registeredTypeVars.end(), "Must create type var before using.");
 
     constraint.mutable_types()->mutable_first()->CopyFrom(T0);
     constraint.mutable_types()->mutable_second()->CopyFrom(T1);
@@ -120,7 +120,11 @@ auto TypeManager::CreateApplicableFunctionConstraint(const Constraint::IDType& f
 auto TypeManager::CreateApplicableFunctionConstraint(const Constraint::IDType& functionid, const FunctionVar& type) -> Constraint::IDType {
     TYPECHECK_ASSERT(type.id() == functionid, "Function type ID should match function id and be set.");
 
-    this->functions.push_back(type);
+    const auto [family, inserted] = this->functionFamilyIndex.emplace(functionid, this->functionFamilies.size());
+    if (inserted) {
+        this->functionFamilies.emplace_back();
+    }
+    this->functionFamilies.at(family->second).push_back(type);
     return type.id();
 }
 
@@ -128,18 +132,18 @@ auto TypeManager::CreateBindFunctionConstraint(const Constraint::IDType& functio
     auto constraint = getNewBlankConstraint(ConstraintKind::BindOverload, this->constraint_generator.next_id());
 
     TYPECHECK_ASSERT(!T0.symbol().empty(), "Cannot use empty type when creating constraint.");
-    TYPECHECK_ASSERT(this->registeredTypeVars.find(T0.symbol()) != this->registeredTypeVars.end(), "Must create type var before using.");
+    TYPECHECK_ASSERT(this->registeredTypeVars.find(T0.id()) != this->registeredTypeVars.end(), "Must create type var before using.");
     constraint.mutable_overload()->mutable_type()->CopyFrom(T0);
     constraint.mutable_overload()->set_functionid(functionid);
 
     for (auto& arg : args) {
         TYPECHECK_ASSERT(!arg.symbol().empty(), "Cannot use empty type when creating constraint.");
-        TYPECHECK_ASSERT(this->registeredTypeVars.find(arg.symbol()) != this->registeredTypeVars.end(), "Must create type var before using.");
+        TYPECHECK_ASSERT(this->registeredTypeVars.find(arg.id()) != this->registeredTypeVars.end(), "Must create type var before using.");
         constraint.mutable_overload()->add_argvars()->CopyFrom(arg);
     }
 
     TYPECHECK_ASSERT(!returnType.symbol().empty(), "Cannot use empty type when creating constraint.");
-    TYPECHECK_ASSERT(this->registeredTypeVars.find(returnType.symbol()) != this->registeredTypeVars.end(), "Must create type var before using.");
+    TYPECHECK_ASSERT(this->registeredTypeVars.find(returnType.id()) != this->registeredTypeVars.end(), "Must create type var before using.");
     constraint.mutable_overload()->mutable_returnvar()->CopyFrom(returnType);
 
 #ifdef TYPECHECK_PRINT_DEBUG_CONSTRAINTS
@@ -154,7 +158,7 @@ auto TypeManager::CreateBindToConstraint(const TypeVar& T0, const Type& type) ->
     auto constraint = getNewBlankConstraint(ConstraintKind::Bind, this->constraint_generator.next_id());
 
     TYPECHECK_ASSERT(!T0.symbol().empty(), "Cannot use empty type when creating constraint.");
-    TYPECHECK_ASSERT(this->registeredTypeVars.find(T0.symbol()) != this->registeredTypeVars.end(), "Must create type var before using.");
+    TYPECHECK_ASSERT(this->registeredTypeVars.find(T0.id()) != this->registeredTypeVars.end(), "Must create type var before using.");
     TYPECHECK_ASSERT(type.has_raw() || type.has_func(), "Must insert valid type.");
 
     constraint.mutable_explicit_()->mutable_var()->CopyFrom(T0);
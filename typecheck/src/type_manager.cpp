@@ -3,6 +3,8 @@
 #include <typecheck/generic_type_generator.hpp>       // for GenericTypeGene...
 #include <typecheck/debug.hpp>
 #include <typecheck/type.hpp>                 // for Type, TypeVar
+#include <typecheck/unifier.hpp>
+#include <typecheck/union_find.hpp>
 
 #include <typecheck/protocols/ExpressibleByFloatLiteral.hpp>
 #include <typecheck/protocols/ExpressibleByIntegerLiteral.hpp>
@@ -17,15 +19,22 @@
 
 #include <cppnotstdlib/strings.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <exception>
+#include <functional>
 #include <optional>
 #include <list>
+#include <mutex>
 #include <queue>
 #include <limits>                                     // for numeric_limits
 #include <type_traits>                                // for move
 #include <utility>                                    // for make_pair
 #include <sstream>                                    // for std::stringstream
 #include <string>                                     // for std::string
+#include <thread>
+#include <unordered_map>
 
 using namespace typecheck;
 
@@ -43,7 +52,9 @@ auto TypeManager::registerType(const Type& name) -> bool {
 	if (!alreadyHasType) {
 		Type type;
 		type.CopyFrom(name);
+		this->registeredTypeIndex.emplace(type, this->registeredTypes.size());
 		this->registeredTypes.emplace_back(type);
+		this->convertibleClosure.resize(this->registeredTypes.size());
 	}
 	return !alreadyHasType;
 }
@@ -65,27 +76,32 @@ auto TypeManager::getRegisteredType(const std::string& name) const noexcept -> T
 }
 
 auto TypeManager::getRegisteredType(const Type& name) const noexcept -> Type {
-	for (auto& type : this->registeredTypes) {
-        if (type == name) {
-			return type;
-		}
+	const auto it = this->registeredTypeIndex.find(name);
+	if (it != this->registeredTypeIndex.end()) {
+		return this->registeredTypes.at(it->second);
 	}
 
 	return {};
 }
 
-auto TypeManager::getFunctionOverloads(const Constraint::IDType& funcID) const -> std::vector<FunctionVar> {
-    std::vector<FunctionVar> overloads;
-    for (const auto& overload : this->functions) {
-        // Lookup by 'var', to deal with anonymous functions.
-        if (overload.id() == funcID) {
-            // Copy it over, and hand it over a 'function definition'.
+auto TypeManager::hasRegisteredType(const RawType::IDType id) const noexcept -> bool {
+    const auto returned = this->getRegisteredType(id);
+    return returned.has_raw() || returned.has_func();
+}
 
-            overloads.push_back(overload);
-        }
-    }
+auto TypeManager::getRegisteredType(const RawType::IDType id) const noexcept -> Type {
+    return this->getRegisteredType(Type(RawType::FromID(id)));
+}
+
+auto TypeManager::getFunctionOverloads(const Constraint::IDType& funcID) const -> const std::vector<FunctionVar>& {
+    static const std::vector<FunctionVar> noOverloads;
 
-    return overloads;
+    // Lookup by 'var', to deal with anonymous functions.
+    const auto it = this->functionFamilyIndex.find(funcID);
+    if (it == this->functionFamilyIndex.end()) {
+        return noOverloads;
+    }
+    return this->functionFamilies.at(it->second);
 }
 
 auto TypeManager::setConvertible(const std::string& T0, const std::string& T1) -> bool {
@@ -124,10 +140,24 @@ auto TypeManager::setConvertible(const Type& T0, const Type& T1) -> bool {
     if (t0_ptr.has_func() || t1_ptr.has_func()) {
         // Functions not convertible to each other
         return false;
-    } else if (!t0_ptr.raw().name().empty() && !t1_ptr.raw().name().empty() && this->convertible[t0_ptr.raw().name()].find(t1_ptr.raw().name()) == this->convertible[t0_ptr.raw().name()].end()) {
+    } else if (t0_ptr.raw().id() != Interner::EmptyID && t1_ptr.raw().id() != Interner::EmptyID) {
 		// Convertible from T0 -> T1
-        this->convertible[t0_ptr.raw().name()].insert(t1_ptr.raw().name());
-		return true;
+        if (!this->convertible[t0_ptr.raw().id()].insert(t1_ptr.raw().id()).second) {
+            return false;
+        }
+
+        // Everything that converts to T0 now converts to T1, and to everything T1 converts to
+        const auto from = this->registeredTypeIndex.at(t0_ptr);
+        const auto to = this->registeredTypeIndex.at(t1_ptr);
+        if (!this->convertibleClosure.test(from, to)) {
+            for (std::size_t i = 0; i < this->convertibleClosure.size(); ++i) {
+                if (i == from || this->convertibleClosure.test(i, from)) {
+                    this->convertibleClosure.set(i, to);
+                    this->convertibleClosure.merge(i, to);
+                }
+            }
+        }
+        return true;
 	}
 	return false;
 }
@@ -142,7 +172,7 @@ auto TypeManager::isConvertible(const std::string& T0, const std::string& T1) co
 }
 
 auto TypeManager::isConvertible(const Type& T0, const Type& T1) const noexcept -> bool {
-    if (T0.raw().name().empty() || T1.raw().name().empty()) {
+    if (T0.raw().id() == Interner::EmptyID || T1.raw().id() == Interner::EmptyID) {
         // Undefined types, stop here.
         return false;
     }
@@ -157,16 +187,23 @@ auto TypeManager::isConvertible(const Type& T0, const Type& T1) const noexcept -
 	}
 
     // Because they're not functions, they must both be raw.
-    if (this->convertible.find(T0.raw().name()) == this->convertible.end()) {
-		// T0 is not in the map, meaning the conversion won't be there.
+    return this->isConvertible(T0.raw().id(), T1.raw().id());
+}
+
+auto TypeManager::isConvertible(const RawType::IDType T0, const RawType::IDType T1) const noexcept -> bool {
+    if (T0 == T1) {
+        return T0 != Interner::EmptyID;
+    }
+
+    const auto from = this->registeredTypeIndex.find(Type(RawType::FromID(T0)));
+    const auto to = this->registeredTypeIndex.find(Type(RawType::FromID(T1)));
+    if (from == this->registeredTypeIndex.end() || to == this->registeredTypeIndex.end()) {
+		// Only registered types can be convertible.
 		return false;
 	}
 
-    if (this->convertible.at(T0.raw().name()).find(T1.raw().name()) != this->convertible.at(T0.raw().name()).end()) {
-		// Convertible from T0 -> T1
-		return true;
-	}
-	return false;
+    // Convertible from T0 -> T1
+    return this->convertibleClosure.test(from->second, to->second);
 }
 
 auto TypeManager::getConvertible(const Type& T0) const -> std::vector<Type> {
@@ -177,12 +214,13 @@ auto TypeManager::getConvertible(const Type& T0) const -> std::vector<Type> {
         return out;
     }
 
-    if (this->convertible.find(T0.raw().name()) != this->convertible.end()) {
+    const auto it = this->registeredTypeIndex.find(T0);
+    if (it != this->registeredTypeIndex.end()) {
         // Load into vector
-        for (auto& convert : this->convertible.at(T0.raw().name())) {
-            Type type;
-            type.mutable_raw()->set_name(convert);
-            out.emplace_back(std::move(type));
+        for (std::size_t i = 0; i < this->registeredTypes.size(); ++i) {
+            if (i != it->second && this->convertibleClosure.test(it->second, i)) {
+                out.emplace_back(this->registeredTypes.at(i));
+            }
         }
     }
 
@@ -190,12 +228,8 @@ auto TypeManager::getConvertible(const Type& T0) const -> std::vector<Type> {
 }
 
 auto TypeManager::CreateTypeVar() -> const TypeVar {
-	const auto var = this->type_generator.next();
-
-	this->registeredTypeVars.insert(var);
-
-	TypeVar type;
-	type.set_symbol(var);
+	const TypeVar type{this->type_generator.next()};
+	this->registeredTypeVars.insert(type.id());
 	return type;
 }
 
@@ -220,7 +254,7 @@ auto TypeManager::getConstraint(const Constraint::IDType id) const -> const Cons
 }
 
 namespace {
-    typecheck::Type TypeFromString(const std::string& val, const constraint::Solution& sol) {
+    typecheck::Type TypeFromString(const std::string& val, const std::function<std::string(const TypeVar&)>& valueOf) {
         if (cppnotstdlib::string::explode(val, '|').size() == 1) {
             return Type(RawType(val));
         } else {
@@ -228,9 +262,9 @@ namespace {
             typecheck::FunctionDefinition funcDef;
             funcDef.set_name(fvar.name());
             funcDef.set_id(fvar.id());
-            funcDef.mutable_returntype()->CopyFrom(TypeFromString(sol.at(fvar.returnvar().symbol()).to_string(), sol));
+            funcDef.mutable_returntype()->CopyFrom(TypeFromString(valueOf(fvar.returnvar()), valueOf));
             for (const auto& a : fvar.args()) {
-                funcDef.add_args()->CopyFrom(TypeFromString(sol.at(a.symbol()).to_string(), sol));
+                funcDef.add_args()->CopyFrom(TypeFromString(valueOf(a), valueOf));
             }
             return Type(funcDef);
         }
@@ -250,18 +284,6 @@ namespace {
 
     using distance_type = std::function<std::size_t(const constraint::State&)>;
 
-    template<typename T>
-    void AddLiteralProtocolTypes(constraint::Domain::data_type& domain) {
-        T protocol;
-        for (const auto& ty : protocol.getPreferredTypes()) {
-            AddTypeToDomain(domain, ty);
-        }
-
-        for (const auto& ty : protocol.getOtherTypes()) {
-            AddTypeToDomain(domain, ty);
-        }
-    }
-
     template<typename T>
     void AddHeuristicProtocolFuncs(std::vector<constraint::Solver::DistanceFunc>& heuristics, std::vector<constraint::Solver::DistanceFunc>& actuals, const std::string& var) {
         heuristics.emplace_back([var](const constraint::StateQuery& state) {
@@ -299,27 +321,361 @@ namespace {
             return 0;
         });
     }
-}
 
-auto TypeManager::solve() -> std::optional<ConstraintPass> {
-    constraint::Solver constraint_solver;
-    std::set<std::string> all_variable_names;
+    // The conversions between registered types, looked up by name
+    struct ConvertibleTypes {
+        const BitMatrix& closure;
+        std::unordered_map<std::string, std::size_t> index;
 
-    std::vector<constraint::Solver::DistanceFunc> heuristcFuncs;
-    std::vector<constraint::Solver::DistanceFunc> distanceFuncs;
+        bool test(const std::string& from, const std::string& to) const {
+            const auto a = this->index.find(from);
+            const auto b = this->index.find(to);
+            return a != this->index.end() && b != this->index.end() && this->closure.test(a->second, b->second);
+        }
 
-#pragma mark - Gather All Data
-    auto insert_if_not_exists = [&constraint_solver, &all_variable_names](const std::string& var, const constraint::Domain& domain) {
-        if (domain.size() == 0) {
-            std::cout << "Warning: Domain Empty for variable: " << var << std::endl;
+        // The registered types in domain, and everything they convert to
+        BitMatrix::Row reachable(const Unifier::Domain& domain, const bool convert) const {
+            auto row = this->closure.emptyRow();
+            for (const auto& ty : domain) {
+                const auto it = this->index.find(ty);
+                if (it != this->index.end()) {
+                    BitMatrix::set(row, it->second);
+                    if (convert) {
+                        BitMatrix::merge(row, this->closure.row(it->second));
+                    }
+                }
+            }
+            return row;
+        }
+    };
+
+    // Drops the candidates of each conversion that cannot convert to any
+    // candidate of the other side, or be converted from any, until nothing
+    // changes.  Fails if a class is left without candidates.
+    auto PruneConversions(Unifier& unifier, const ConvertibleTypes& convertible, const std::vector<const Constraint*>& residualConstraints) -> bool {
+        for (bool changed = true; changed;) {
+            changed = false;
+            for (const auto constraint : residualConstraints) {
+                if (!constraint->has_types()) {
+                    continue;
+                }
+
+                const auto& from = constraint->types().first();
+                const auto& to = constraint->types().second();
+                if (unifier.representative(from) == unifier.representative(to)) {
+                    continue;
+                }
+
+                // Types that are not registered (functions) only convert to themselves
+                const auto& targets = unifier.candidates(to);
+                const auto targetMask = convertible.reachable(targets, false);
+                changed = unifier.prune(from, [&](const std::string& ty) {
+                    const auto it = convertible.index.find(ty);
+                    if (it == convertible.index.end()) {
+                        return std::find(targets.begin(), targets.end(), ty) != targets.end();
+                    }
+                    return BitMatrix::test(targetMask, it->second) || BitMatrix::intersects(convertible.closure.row(it->second), targetMask);
+                }) > 0 || changed;
+
+                const auto& sources = unifier.candidates(from);
+                const auto sourceMask = convertible.reachable(sources, true);
+                changed = unifier.prune(to, [&](const std::string& ty) {
+                    const auto it = convertible.index.find(ty);
+                    if (it == convertible.index.end()) {
+                        return std::find(sources.begin(), sources.end(), ty) != sources.end();
+                    }
+                    return BitMatrix::test(sourceMask, it->second);
+                }) > 0 || changed;
+
+                if (unifier.candidates(from).empty() || unifier.candidates(to).empty()) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // Memoized overload choices, keyed by function and argument types
+    struct OverloadKey {
+        Constraint::IDType function;
+        std::vector<RawType::IDType> args;
+
+        bool operator==(const OverloadKey& other) const noexcept {
+            return this->function == other.function && this->args == other.args;
         }
+    };
 
-        if (all_variable_names.find(var) == all_variable_names.end()) {
-            constraint_solver.addVariable(var, domain);
-            all_variable_names.insert(var);
+    struct OverloadKeyHash {
+        std::size_t operator()(const OverloadKey& key) const noexcept {
+            auto hash = std::hash<Constraint::IDType>()(key.function);
+            for (const auto arg : key.args) {
+                hash = hash * 31 + arg;
+            }
+            return hash;
         }
     };
 
+    // Calls fn with every variable of a residual constraint
+    template<typename F>
+    void ForEachResidualVar(const Constraint& constraint, const std::vector<FunctionVar>& funcFamily, F&& fn) {
+        if (constraint.has_types()) {
+            fn(constraint.types().first());
+            fn(constraint.types().second());
+            return;
+        }
+
+        const auto& overload = constraint.overload();
+        fn(overload.type());
+        fn(overload.returnvar());
+        for (std::size_t i = 0; i < overload.argvars_size(); ++i) {
+            fn(overload.argvars(i));
+        }
+        for (const auto& func : funcFamily) {
+            fn(func.returnvar());
+            for (const auto& arg : func.args()) {
+                fn(arg);
+            }
+        }
+    }
+
+    // Residual constraints that share a class must be searched together, the
+    // connected components of the class/constraint graph are independent.
+    struct Components {
+        std::vector<std::vector<std::size_t>> constraints;
+        // Keyed by the representative of a class
+        std::unordered_map<TypeVar::IDType, std::size_t> componentOf;
+    };
+
+    auto PartitionResidual(const Unifier& unifier, const std::vector<const Constraint*>& residualConstraints, const std::vector<const std::vector<FunctionVar>*>& residualFamilies) -> Components {
+        UnionFind sets;
+        std::unordered_map<TypeVar::IDType, UnionFind::IndexType> firstConstraint;
+        for (std::size_t c = 0; c < residualConstraints.size(); ++c) {
+            sets.add();
+            ForEachResidualVar(*residualConstraints.at(c), *residualFamilies.at(c), [&](const TypeVar& var) {
+                const auto [it, inserted] = firstConstraint.emplace(unifier.representative(var).id(), c);
+                if (!inserted) {
+                    sets.merge(it->second, c);
+                }
+            });
+        }
+
+        Components components;
+        std::unordered_map<UnionFind::IndexType, std::size_t> componentOfRoot;
+        for (std::size_t c = 0; c < residualConstraints.size(); ++c) {
+            const auto [it, inserted] = componentOfRoot.emplace(sets.find(c), components.constraints.size());
+            if (inserted) {
+                components.constraints.emplace_back();
+            }
+            components.constraints.at(it->second).push_back(c);
+        }
+        for (const auto& [rep, c] : firstConstraint) {
+            components.componentOf.emplace(rep, componentOfRoot.at(sets.find(c)));
+        }
+        return components;
+    }
+
+    // Below this many residual constraints, starting threads costs more than the search
+    constexpr std::size_t MinParallelResidual = 64;
+
+    // Runs fn(0..count) over up to maxThreads threads, the calling thread included.
+    // The first exception stops the remaining work, and is rethrown after the join.
+    template<typename F>
+    void ParallelFor(const std::size_t count, const std::size_t maxThreads, F&& fn) {
+        const auto numThreads = std::min(count, maxThreads);
+        if (numThreads <= 1) {
+            for (std::size_t i = 0; i < count; ++i) {
+                fn(i);
+            }
+            return;
+        }
+
+        std::atomic<std::size_t> next{0};
+        std::mutex errorMutex;
+        std::exception_ptr error;
+        auto worker = [&] {
+            try {
+                for (auto i = next++; i < count; i = next++) {
+                    fn(i);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                next = count;
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (std::size_t i = 1; i < numThreads; ++i) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // Searches for one component of the residual constraints, over the classes of the unifier
+    auto SearchResidual(const ConvertibleTypes& convertible, const Unifier& unifier, const std::vector<const Constraint*>& residualConstraints, const std::vector<const std::vector<FunctionVar>*>& residualFamilies, const std::vector<std::size_t>& component) -> std::optional<constraint::Solution> {
+        constraint::Solver constraint_solver;
+        std::set<std::string> all_variable_names;
+
+        std::vector<constraint::Solver::DistanceFunc> heuristcFuncs;
+        std::vector<constraint::Solver::DistanceFunc> distanceFuncs;
+
+        // Every class is searched as one variable, named after its representative
+        const auto insert_if_not_exists = [&](const TypeVar& var) -> std::string {
+            const auto& rep = unifier.representative(var);
+            if (all_variable_names.insert(rep.symbol()).second) {
+                constraint::Domain::data_type domain;
+                for (const auto& ty : unifier.candidates(rep)) {
+                    domain.emplace_back(ty);
+                }
+                constraint_solver.addVariable(rep.symbol(), constraint::Domain(domain));
+
+                for (const auto kind : unifier.literals(rep)) {
+                    switch (kind) {
+                    case KnownProtocolKind::ExpressibleByFloat:
+                        AddHeuristicProtocolFuncs<ExpressibleByFloatLiteral>(heuristcFuncs, distanceFuncs, rep.symbol());
+                        break;
+                    case KnownProtocolKind::ExpressibleByDouble:
+                        AddHeuristicProtocolFuncs<ExpressibleByDoubleLiteral>(heuristcFuncs, distanceFuncs, rep.symbol());
+                        break;
+                    case KnownProtocolKind::ExpressibleByInteger:
+                        AddHeuristicProtocolFuncs<ExpressibleByIntegerLiteral>(heuristcFuncs, distanceFuncs, rep.symbol());
+                        break;
+                    default:
+                        break;
+                    }
+                }
+            }
+            return rep.symbol();
+        };
+
+        for (const auto c : component) {
+            const auto& constraint = *residualConstraints.at(c);
+            if (constraint.has_types()) {
+                const auto types = constraint.types();
+                std::vector<std::string> type_names;
+                type_names.push_back(insert_if_not_exists(types.first()));
+                type_names.push_back(insert_if_not_exists(types.second()));
+
+                constraint_solver.addConstraint(type_names, [type_names, &convertible](const constraint::Env& env) {
+                    const auto firstVarValue = env.at(type_names.at(0));
+                    const auto secondVarValue = env.at(type_names.at(1));
+
+                    if (firstVarValue == secondVarValue) {
+                        return true;
+                    }
+
+                    return convertible.test(firstVarValue.to_string(), secondVarValue.to_string());
+                });
+            } else {
+                const auto& overload = constraint.overload();
+                const auto& funcFamily = *residualFamilies.at(c);
+
+                const auto overloadType = insert_if_not_exists(overload.type());
+                const auto overloadReturn = insert_if_not_exists(overload.returnvar());
+                std::vector<std::string> overloadArgs;
+                for (std::size_t i = 0; i < overload.argvars_size(); ++i) {
+                    overloadArgs.push_back(insert_if_not_exists(overload.argvars(i)));
+                }
+
+                for (const auto& func : funcFamily) {
+                    const auto funcReturn = insert_if_not_exists(func.returnvar());
+                    std::vector<std::string> funcArgs;
+                    for (const auto& arg : func.args()) {
+                        funcArgs.push_back(insert_if_not_exists(arg));
+                    }
+
+                    std::vector<std::string> overloadConstraintVars;
+
+                    // Copy the variables from the overload constraint
+                    overloadConstraintVars.push_back(overloadType);
+                    overloadConstraintVars.push_back(overloadReturn);
+                    std::copy(overloadArgs.begin(), overloadArgs.end(), std::back_inserter(overloadConstraintVars));
+
+                    // Copy the variables from the function definition
+                    overloadConstraintVars.push_back(funcReturn);
+                    std::copy(funcArgs.begin(), funcArgs.end(), std::back_inserter(overloadConstraintVars));
+
+                    auto allFuncDefinitionVariablesAssigned = [funcReturn, funcArgs](const constraint::Env& env) {
+                        if (!env.isAssigned(funcReturn)) {
+                            return false;
+                        }
+                        for (const auto& a : funcArgs) {
+                            if (!env.isAssigned(a)) {
+                                return false;
+                            }
+                        }
+                        return true;
+                    };
+
+                    constraint_solver.addConstraint(overloadConstraintVars, [overloadType, overloadReturn, overloadArgs, funcReturn, funcArgs, serialized = func.serialize(), check = std::move(allFuncDefinitionVariablesAssigned)](const constraint::Env& env) {
+                        if (!check(env)) {
+                            // If not all the variables of the function are assigned, say it's fine, and the other one will pick it up.
+                            return true;
+                        }
+
+                        if (env.at(overloadType).to_string() != serialized) {
+                            // This is not the overload we are looking for.
+                            return true;
+                        }
+
+                        auto compare_vars = [&env](const std::string& vA, const std::string& vB) {
+                            return env.at(vA).to_string() == env.at(vB).to_string();
+                        };
+
+                        // This is the the overload, check everything matches up.
+                        if (overloadArgs.size() != funcArgs.size()) {
+                            return false;
+                        }
+
+                        if (!compare_vars(overloadReturn, funcReturn)) {
+                            return false;
+                        }
+
+                        for (std::size_t i = 0; i < funcArgs.size(); ++i) {
+                            if (!compare_vars(overloadArgs.at(i), funcArgs.at(i))) {
+                                return false;
+                            }
+                        }
+
+                        return true;
+                    });
+                }
+            }
+        }
+
+        const auto numVariables = all_variable_names.size();
+        auto heuristic = [heuristics = std::move(heuristcFuncs), numVariables](const constraint::StateQuery& state) {
+            // Calculate the difference, allows us to measure meaningful progress
+            std::size_t sum = numVariables + state.numConstraints() - state.numSatisfied();
+            for (const auto& H : heuristics) {
+                sum += H(state);
+            }
+            return sum;
+        };
+
+        auto actualDistance = [actual = std::move(distanceFuncs), numVariables](const constraint::StateQuery& state) {
+            // Calculate the difference, allows us to measure meaningful progress
+            std::size_t sum = numVariables + state.numConstraints();
+            for (const auto& G : actual) {
+                sum += G(state);
+            }
+            return sum;
+        };
+
+        return constraint_solver.getOptimizedSolution(std::move(heuristic), std::move(actualDistance));
+    }
+}
+
+auto TypeManager::solve() -> std::optional<ConstraintPass> {
+#pragma mark - Gather All Data
     // Var Domain
     const auto varDomain = [this] {
         constraint::Domain::data_type domain;
@@ -327,32 +683,38 @@ auto TypeManager::solve() -> std::optional<ConstraintPass> {
             AddTypeToDomain(domain, ty);
         }
 
-        for (const auto& func : this->functions) {
-            AddTypeToDomain(domain, func);
+        for (const auto& family : this->functionFamilies) {
+            for (const auto& func : family) {
+                AddTypeToDomain(domain, func);
+            }
         }
 
-        return constraint::Domain(domain);
+        return domain;
     }();
 
+    // Equal, Bind and literal constraints are resolved by the unifier, the
+    // conversion and overload constraints are left for the search.
+    Unifier unifier;
+    std::vector<const Constraint*> overloads;
+    std::vector<const Constraint*> residualConstraints;
+    std::vector<const std::vector<FunctionVar>*> residualFamilies;
+    const std::vector<FunctionVar> noFamily;
+
     for (const auto& constraint : this->constraints) {
         if (constraint.has_conforms()) {
             const auto conforms = constraint.conforms();
             if (conforms.has_type() && conforms.has_protocol()) {
-                const auto var = conforms.type().symbol();
-                const auto protocol = conforms.protocol();
-                constraint::Domain::data_type domain;
-                switch (protocol.literal()) {
+                const auto& var = conforms.type();
+                const auto kind = conforms.protocol().literal();
+                switch (kind) {
                 case KnownProtocolKind::ExpressibleByFloat:
-                    AddLiteralProtocolTypes<ExpressibleByFloatLiteral>(domain);
-                    AddHeuristicProtocolFuncs<ExpressibleByFloatLiteral>(heuristcFuncs, distanceFuncs, var);
+                    unifier.conformsTo(var, kind, ExpressibleByFloatLiteral());
                     break;
                 case KnownProtocolKind::ExpressibleByDouble:
-                    AddLiteralProtocolTypes<ExpressibleByDoubleLiteral>(domain);
-                    AddHeuristicProtocolFuncs<ExpressibleByDoubleLiteral>(heuristcFuncs, distanceFuncs, var);
+                    unifier.conformsTo(var, kind, ExpressibleByDoubleLiteral());
                     break;
                 case KnownProtocolKind::ExpressibleByInteger:
-                    AddLiteralProtocolTypes<ExpressibleByIntegerLiteral>(domain);
-                    AddHeuristicProtocolFuncs<ExpressibleByIntegerLiteral>(heuristcFuncs, distanceFuncs, var);
+                    unifier.conformsTo(var, kind, ExpressibleByIntegerLiteral());
                     break;
 				case KnownProtocolKind::ExpressibleByArray:
 				case KnownProtocolKind::ExpressibleByBoolean:
@@ -364,71 +726,38 @@ auto TypeManager::solve() -> std::optional<ConstraintPass> {
                     return std::nullopt;
                     break;
                 }
-                insert_if_not_exists(var, varDomain);
-
-                // conforms literal is implied by its domain.
-                constraint_solver.addConstraint(std::vector{var}, [var, domain](const constraint::Env& env) {
-                    for (const auto& ty : domain) {
-                        if (env.at(var) == ty) {
-                            return true;
-                        }
-                    }
-
-                    return false;
-                });
             } else {
                 std::cout << "Malformed Conforms Constraint" << std::endl;
                 return std::nullopt;
             }
         } else if (constraint.has_types()) {
             const auto types = constraint.types();
-            std::vector<std::string> type_names;
+            std::vector<TypeVar> type_vars;
             if (types.has_first()) {
-                type_names.push_back(types.first().symbol());
+                type_vars.push_back(types.first());
             }
             if (types.has_second()) {
-                type_names.push_back(types.second().symbol());
+                type_vars.push_back(types.second());
             }
             if (types.has_third()) {
-                type_names.push_back(types.third().symbol());
+                type_vars.push_back(types.third());
             }
 
-            if (type_names.empty()) {
+            if (type_vars.empty()) {
                 std::cout << "Malformed Types Constraint" << std::endl;
             } else {
-                for (const auto& ty : type_names) {
-                    insert_if_not_exists(ty, varDomain);
-                }
-
                 switch (constraint.kind()) {
                 case Conversion:
-                    constraint_solver.addConstraint(std::vector{type_names}, [type_names, C = &convertible](const constraint::Env& env) {
-                        const auto firstVarValue = env.at(type_names.at(0));
-                        const auto secondVarValue = env.at(type_names.at(1));
-
-                        if (firstVarValue == secondVarValue) {
-                            return true;
-                        }
-
-                        const auto it = C->find(firstVarValue.to_string());
-                        if (it == C->end()) {
-                            return false;
-                        }
-
-                        return it->second.find(secondVarValue.to_string()) != it->second.end();
-                    });
+                    for (const auto& ty : type_vars) {
+                        unifier.markResidual(ty);
+                    }
+                    residualConstraints.push_back(&constraint);
+                    residualFamilies.push_back(&noFamily);
                     break;
                 case Equal:
-                    constraint_solver.addConstraint(std::vector{type_names}, [type_names](const constraint::Env& env) {
-                        const auto firstVar = env.at(type_names.at(0));
-                        for (const auto& ty : type_names) {
-                            if (firstVar != env.at(ty)) {
-                                return false;
-                            }
-                        }
-
-                        return true;
-                    });
+                    for (const auto& ty : type_vars) {
+                        unifier.unify(type_vars.front(), ty);
+                    }
                     break;
 				case Bind:
 				case BindParam:
@@ -442,150 +771,201 @@ auto TypeManager::solve() -> std::optional<ConstraintPass> {
                 }
             }
         } else if (constraint.has_overload()) {
-            const auto overload = constraint.overload();
+            // Resolved after everything else is known about the arguments
+            overloads.push_back(&constraint);
+        } else if (constraint.has_explicit_()) {
+            const auto explicit_ = constraint.explicit_();
+            if (explicit_.has_var() && explicit_.has_type()) {
+                if (!explicit_.type().has_raw()) {
+                    // Only raw types can be bound
+                    return std::nullopt;
+                }
+                unifier.bind(explicit_.var(), explicit_.type().raw().name());
+            } else {
+                std::cout << "Malformed Explicit Constraint" << std::endl;
+                return std::nullopt;
+            }
+        } else {
+            std::cout << "Unknown Constraint Type" << std::endl;
+            return std::nullopt;
+        }
+    }
 
-            std::vector<std::string> overloadVariables;
-            overloadVariables.emplace_back(overload.type().symbol());
-            overloadVariables.emplace_back(overload.returnvar().symbol());
-            for (std::size_t i = 0; i < overload.argvars_size(); ++i) {
-                overloadVariables.emplace_back(overload.argvars(i).symbol());
+    // Calls whose arguments are all bound pick their overload right away, by
+    // unifying with it.  The choice only depends on the function and the
+    // argument types, so it is made once for all the calls that share them.
+    std::unordered_map<OverloadKey, std::size_t, OverloadKeyHash> overloadChoices;
+    const auto chooseOverload = [&](const Constraint::Overload& overload, const std::size_t call) -> std::optional<std::size_t> {
+        OverloadKey key{overload.functionid(), {}};
+        std::vector<std::string> argTypes;
+        for (std::size_t i = 0; i < overload.argvars_size(); ++i) {
+            auto bound = unifier.bound(overload.argvars(i));
+            if (!bound.has_value()) {
+                return std::nullopt;
             }
+            key.args.push_back(RawType(*bound).id());
+            argTypes.push_back(std::move(*bound));
+        }
 
-            // Gather all overloads.
-            const auto funcFamily = this->getFunctionOverloads(overload.functionid());
-            std::vector<std::vector<std::string>> all_func_dependant_variables;
-            constraint::Domain::data_type typeDomain;
-            for (const auto& func : funcFamily) {
-                std::vector<std::string> funcDependantVariables;
-                funcDependantVariables.emplace_back(func.returnvar().symbol());
-                for (const auto& arg : func.args()) {
-                    funcDependantVariables.emplace_back(arg.symbol());
-                }
+        const auto cached = overloadChoices.find(key);
+        if (cached != overloadChoices.end()) {
+            return cached->second;
+        }
 
-                all_func_dependant_variables.emplace_back(funcDependantVariables);
-                typeDomain.emplace_back(func.serialize());
+        // Exactly one overload must match, and no other one may still be able to
+        std::optional<std::size_t> choice;
+        const auto& funcFamily = this->getFunctionOverloads(overload.functionid());
+        for (std::size_t i = 0; i < funcFamily.size(); ++i) {
+            const auto& func = funcFamily.at(i);
+            if (func.args().size() != argTypes.size()) {
+                continue;
             }
 
-            insert_if_not_exists(overload.type().symbol(), typeDomain);
-            for (const auto& a : overloadVariables) {
-                insert_if_not_exists(a, varDomain);
-            }
-            for (const auto& a : all_func_dependant_variables) {
-                for (const auto& b : a) {
-                    insert_if_not_exists(b, varDomain);
+            bool matches = true;
+            std::optional<TypeVar> undecided;
+            for (std::size_t j = 0; j < argTypes.size() && matches; ++j) {
+                const auto bound = unifier.bound(func.args().at(j));
+                if (!bound.has_value() && !undecided.has_value()) {
+                    undecided = func.args().at(j);
                 }
+                matches = !bound.has_value() || *bound == argTypes.at(j);
             }
 
+            if (!matches) {
+                continue;
+            }
+            if (undecided.has_value()) {
+                // Tried again once the parameter is bound
+                unifier.watch(*undecided, call);
+                return std::nullopt;
+            }
+            if (choice.has_value()) {
+                return std::nullopt;
+            }
+            choice = i;
+        }
 
-            for (std::size_t i = 0; i < funcFamily.size(); ++i) {
-                const auto& vars = all_func_dependant_variables.at(i);
-                const auto& func = funcFamily.at(i);
-
-                std::vector<std::string> overloadConstraintVars;
-
-                // Copy the variables from the overload constraint
-                std::copy(overloadVariables.begin(), overloadVariables.end(), std::back_inserter(overloadConstraintVars));
-
-                // Copy the variables from the function definition
-                std::copy(vars.begin(), vars.end(), std::back_inserter(overloadConstraintVars));
-
-                auto allFuncDefinitionVariablesAssigned = [vars](const constraint::Env& env) {
-                    for (const auto& a : vars) {
-                        if (!env.isAssigned(a)) {
-                            return false;
-                        }
-                    }
-                    return true;
-                };
-
-                constraint_solver.addConstraint(overloadConstraintVars, [overload, funcDefinition = func, check = std::move(allFuncDefinitionVariablesAssigned)](const constraint::Env& env) {
-                    if (!check(env)) {
-                        // If not all the variables of the function are assigned, say it's fine, and the other one will pick it up.
-                        return true;
-                    }
-
-                    if (env.at(overload.type().symbol()).to_string() != funcDefinition.serialize()) {
-                        // This is not the overload we are looking for.
-                        return true;
-                    }
+        if (choice.has_value()) {
+            overloadChoices.emplace(std::move(key), *choice);
+        }
+        return choice;
+    };
 
-                    auto compare_vars = [&env](const typecheck::TypeVar& vA, const typecheck::TypeVar& vB) {
-                        return env.at(vA.symbol()).to_string() == env.at(vB.symbol()).to_string();
-                    };
+    // Resolving a call can bind the arguments of another one, e.g. f(g(1)).
+    // A call is tried again only when the class of one of its arguments is bound.
+    std::vector<bool> resolved(overloads.size(), false);
+    std::vector<std::size_t> ready;
+    for (std::size_t c = 0; c < overloads.size(); ++c) {
+        const auto& overload = overloads.at(c)->overload();
+        if (overload.argvars_size() == 0) {
+            ready.push_back(c);
+        }
+        for (std::size_t i = 0; i < overload.argvars_size(); ++i) {
+            unifier.watch(overload.argvars(i), c);
+        }
+    }
+    for (auto woken = unifier.takeReady(); !ready.empty() || !woken.empty(); woken = unifier.takeReady()) {
+        ready.insert(ready.end(), woken.begin(), woken.end());
+        const auto c = ready.back();
+        ready.pop_back();
+        if (resolved.at(c)) {
+            continue;
+        }
 
-                    // This is the the overload, check everything matches up.
-                    if (overload.argvars_size() != funcDefinition.args().size()) {
-                        return false;
-                    }
+        const auto& overload = overloads.at(c)->overload();
+        const auto choice = chooseOverload(overload, c);
+        if (!choice.has_value()) {
+            continue;
+        }
 
-                    if (!compare_vars(overload.returnvar(), funcDefinition.returnvar())) {
-                        return false;
-                    }
+        const auto& func = this->getFunctionOverloads(overload.functionid()).at(*choice);
+        unifier.bind(overload.type(), func.serialize());
+        unifier.unify(overload.returnvar(), func.returnvar());
+        for (std::size_t i = 0; i < overload.argvars_size(); ++i) {
+            unifier.unify(overload.argvars(i), func.args().at(i));
+        }
+        resolved.at(c) = true;
+    }
 
-                    for (std::size_t i = 0; i < funcDefinition.args().size(); ++i) {
-                        if (!compare_vars(overload.argvars(i), funcDefinition.args().at(i))) {
-                            return false;
-                        }
-                    }
+    // The rest is left for the search
+    for (std::size_t c = 0; c < overloads.size(); ++c) {
+        if (resolved.at(c)) {
+            continue;
+        }
 
-                    return true;
-                });
-            }
+        const auto& overload = overloads.at(c)->overload();
+        unifier.markResidual(overload.type());
+        unifier.markResidual(overload.returnvar());
+        for (std::size_t i = 0; i < overload.argvars_size(); ++i) {
+            unifier.markResidual(overload.argvars(i));
+        }
 
-        } else if (constraint.has_explicit_()) {
-            const auto explicit_ = constraint.explicit_();
-            if (explicit_.has_var() && explicit_.has_type()) {
-                const auto var = explicit_.var();
-                const auto type = explicit_.type();
-
-                insert_if_not_exists(var.symbol(), varDomain);
-                constraint_solver.addConstraint(std::vector{var.symbol()}, [var, type](const constraint::Env& env) {
-                    if (type.has_raw()) {
-                        return env.at(var.symbol()).to_string() == type.raw().name();
-                    } else {
-                        return false;
-                    }
-                });
-            } else {
-                std::cout << "Malformed Explicit Constraint" << std::endl;
-                return std::nullopt;
+        // Gather all overloads.
+        const auto& funcFamily = this->getFunctionOverloads(overload.functionid());
+        Unifier::Domain typeDomain;
+        for (const auto& func : funcFamily) {
+            unifier.markResidual(func.returnvar());
+            for (const auto& arg : func.args()) {
+                unifier.markResidual(arg);
             }
-        } else {
-            std::cout << "Unknown Constraint Type" << std::endl;
-            return std::nullopt;
+            typeDomain.emplace_back(func.serialize());
         }
+        unifier.restrict(overload.type(), typeDomain);
+
+        residualConstraints.push_back(overloads.at(c));
+        residualFamilies.push_back(&funcFamily);
     }
 
+    Unifier::Domain universe;
+    for (const auto& value : varDomain) {
+        universe.emplace_back(value.to_string());
+    }
+    if (!unifier.resolve(universe)) {
+        return std::nullopt;
+    }
 
-    const auto numVariables = all_variable_names.size();
-    auto heuristic = [heuristics = std::move(heuristcFuncs), numVariables](const constraint::StateQuery& state) {
-        // Calculate the difference, allows us to measure meaningful progress
-        std::size_t sum = numVariables + state.numConstraints() - state.numSatisfied();
-        for (const auto& H : heuristics) {
-            sum += H(state);
+#pragma mark - Search
+    ConvertibleTypes conversions{this->convertibleClosure, {}};
+    for (std::size_t i = 0; i < this->registeredTypes.size(); ++i) {
+        if (this->registeredTypes.at(i).has_raw()) {
+            conversions.index.emplace(this->registeredTypes.at(i).raw().name(), i);
         }
-        return sum;
-    };
+    }
+    if (!PruneConversions(unifier, conversions, residualConstraints)) {
+        return std::nullopt;
+    }
 
-    auto actualDistance = [actual = std::move(distanceFuncs), numVariables](const constraint::StateQuery& state) {
-        // Calculate the difference, allows us to measure meaningful progress
-        std::size_t sum = numVariables + state.numConstraints();
-        for (const auto& G : actual) {
-            sum += G(state);
+    // Unrelated groups of constraints are searched on their own, in parallel
+    // when there are enough of them to be worth the threads
+    const auto components = PartitionResidual(unifier, residualConstraints, residualFamilies);
+    std::vector<std::optional<constraint::Solution>> solutions(components.constraints.size());
+    std::atomic<bool> failed{false};
+    const auto maxThreads = (residualConstraints.size() < MinParallelResidual)
+        ? std::size_t{1}
+        : static_cast<std::size_t>(std::max(1u, std::thread::hardware_concurrency()));
+    ParallelFor(components.constraints.size(), maxThreads, [&](const std::size_t i) {
+        if (!failed) {
+            solutions.at(i) = SearchResidual(conversions, unifier, residualConstraints, residualFamilies, components.constraints.at(i));
+            if (!solutions.at(i).has_value()) {
+                failed = true;
+            }
         }
-        return sum;
-    };
-
-    const auto solution = constraint_solver.getOptimizedSolution(std::move(heuristic), std::move(actualDistance));
-    const auto hasSolution = solution.has_value();
-    if (!hasSolution) {
+    });
+    if (failed) {
         return std::nullopt;
     }
 
+    const auto valueOf = [&unifier, &components, &solutions](const TypeVar& var) -> std::string {
+        if (unifier.isResidual(var)) {
+            const auto& rep = unifier.representative(var);
+            return solutions.at(components.componentOf.at(rep.id()))->at(rep.symbol()).to_string();
+        }
+        return unifier.value(var);
+    };
+
     ConstraintPass pass;
-    for (const auto& var : all_variable_names) {
-        const auto val = solution->at(var);
-        pass.setResolvedType(var, TypeFromString(val.to_string(), *solution));
+    for (const auto& var : unifier.variables()) {
+        pass.setResolvedType(var, TypeFromString(valueOf(var), valueOf));
     }
     return pass;
 }
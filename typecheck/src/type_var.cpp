@@ -1,12 +1,13 @@
 #include <typecheck/type_var.hpp>
-#include <utility>
 
 using namespace typecheck;
 
-TypeVar::TypeVar(std::string s) : _symbol(std::move(s)) {}
+TypeVar::TypeVar(const std::string& s) {
+	this->set_symbol(s);
+}
 
 auto TypeVar::operator==(const TypeVar& other) const noexcept -> bool {
-	return this->_symbol == other._symbol;
+	return this->_id == other._id;
 }
 
 auto TypeVar::operator!=(const TypeVar& other) const noexcept -> bool {
@@ -14,21 +15,28 @@ auto TypeVar::operator!=(const TypeVar& other) const noexcept -> bool {
 }
 
 bool TypeVar::operator<(const TypeVar& other) const noexcept {
-	return this->_symbol < other._symbol;
+	return this->_id < other._id;
 }
 
 void TypeVar::CopyFrom(const TypeVar& other) {
-	this->_symbol = other.symbol();
+	this->_id = other._id;
+	this->_symbol = other._symbol;
+}
+
+auto TypeVar::id() const noexcept -> IDType {
+	return this->_id;
 }
 
-auto TypeVar::symbol() const -> std::string {
-	return this->_symbol;
+auto TypeVar::symbol() const -> const std::string& {
+	return *this->_symbol;
 }
 
 void TypeVar::set_symbol(const std::string& s) {
-	this->_symbol = s;
+	auto& interner = Interner::global();
+	this->_id = interner.intern(s);
+	this->_symbol = &interner.name(this->_id);
 }
 
 auto TypeVar::ShortDebugString() const -> std::string {
-	return "{ \"symbol\": \"" + this->_symbol + "\" }";
+	return "{ \"symbol\": \"" + this->symbol() + "\" }";
 }
@@ -0,0 +1,250 @@
+#include <typecheck/unifier.hpp>
+
+#include <algorithm>
+#include <utility>
+
+using namespace typecheck;
+
+namespace {
+	auto contains(const Unifier::Domain& domain, const std::string& type) -> bool {
+		return std::find(domain.begin(), domain.end(), type) != domain.end();
+	}
+}
+
+auto Unifier::add(const TypeVar& var) -> void {
+	if (this->indices.find(var.id()) == this->indices.end()) {
+		this->indices.emplace(var.id(), this->sets.add());
+		this->vars.push_back(var);
+		this->binds.emplace_back();
+		this->conflicts.push_back(false);
+		this->watchers.emplace_back();
+	}
+}
+
+auto Unifier::unify(const TypeVar& a, const TypeVar& b) -> void {
+	this->add(a);
+	this->add(b);
+	const auto rootA = this->sets.find(this->index(a));
+	const auto rootB = this->sets.find(this->index(b));
+	if (rootA == rootB) {
+		return;
+	}
+
+	const auto root = this->sets.merge(rootA, rootB);
+	const auto other = (root == rootA) ? rootB : rootA;
+	if (this->conflicts[other]) {
+		this->conflicts[root] = true;
+	}
+	auto& otherWatchers = this->watchers[other];
+	this->watchers[root].insert(this->watchers[root].end(), otherWatchers.begin(), otherWatchers.end());
+	otherWatchers.clear();
+	if (this->binds[other].has_value()) {
+		this->bindRoot(root, *this->binds[other]);
+	}
+	// The watchers of an unbound class that joined a bound one
+	if (this->binds[root].has_value()) {
+		this->wake(root);
+	}
+}
+
+auto Unifier::bind(const TypeVar& var, const std::string& type) -> void {
+	this->add(var);
+	this->bindRoot(this->sets.find(this->index(var)), type);
+}
+
+auto Unifier::bindRoot(UnionFind::IndexType root, const std::string& type) -> void {
+	if (this->binds[root].has_value() && *this->binds[root] != type) {
+		this->conflicts[root] = true;
+	}
+	this->binds[root] = type;
+	this->wake(root);
+}
+
+auto Unifier::wake(UnionFind::IndexType root) -> void {
+	auto& waiting = this->watchers[root];
+	this->ready.insert(this->ready.end(), waiting.begin(), waiting.end());
+	waiting.clear();
+}
+
+auto Unifier::bound(const TypeVar& var) -> std::optional<std::string> {
+	if (this->indices.find(var.id()) == this->indices.end()) {
+		return std::nullopt;
+	}
+	return this->binds[this->sets.find(this->index(var))];
+}
+
+auto Unifier::watch(const TypeVar& var, std::size_t id) -> void {
+	this->add(var);
+	const auto root = this->sets.find(this->index(var));
+	if (this->binds[root].has_value()) {
+		this->ready.push_back(id);
+	} else {
+		this->watchers[root].push_back(id);
+	}
+}
+
+auto Unifier::takeReady() -> std::vector<std::size_t> {
+	return std::exchange(this->ready, {});
+}
+
+auto Unifier::conformsTo(const TypeVar& var, KnownProtocolKind::LiteralProtocol kind, const LiteralProtocol& protocol) -> void {
+	this->add(var);
+	this->conforms.emplace_back(this->index(var), kind);
+
+	if (this->literalDomains.find(kind) == this->literalDomains.end()) {
+		Literal literal;
+		for (const auto& ty : protocol.getPreferredTypes()) {
+			literal.preferred.push_back(ty.raw().name());
+			literal.all.push_back(ty.raw().name());
+		}
+		for (const auto& ty : protocol.getOtherTypes()) {
+			literal.all.push_back(ty.raw().name());
+		}
+		this->literalDomains.emplace(kind, std::move(literal));
+	}
+}
+
+auto Unifier::restrict(const TypeVar& var, const Domain& domain) -> void {
+	this->add(var);
+	this->restricted.emplace_back(this->index(var), this->restrictionDomains.size());
+	this->restrictionDomains.push_back(domain);
+}
+
+auto Unifier::markResidual(const TypeVar& var) -> void {
+	this->add(var);
+	this->residuals.push_back(this->index(var));
+}
+
+auto Unifier::resolve(const Domain& universe_) -> bool {
+	this->universe = universe_;
+	this->universeSet = std::unordered_set<std::string>(universe_.begin(), universe_.end());
+
+	this->roots.resize(this->vars.size());
+	for (std::size_t i = 0; i < this->vars.size(); ++i) {
+		this->roots[i] = this->sets.find(i);
+	}
+
+	// Gather everything known about a variable onto its class
+	this->classes = std::vector<Class>(this->vars.size());
+	for (std::size_t i = 0; i < this->vars.size(); ++i) {
+		if (this->roots[i] == i) {
+			this->classes[i].bound = this->binds[i];
+			this->classes[i].conflict = this->conflicts[i];
+		}
+	}
+	for (const auto& [i, kind] : this->conforms) {
+		auto& literals = this->classes[this->roots[i]].literals;
+		if (std::find(literals.begin(), literals.end(), kind) == literals.end()) {
+			literals.push_back(kind);
+		}
+	}
+	for (const auto& [i, restriction] : this->restricted) {
+		this->classes[this->roots[i]].restrictions.push_back(restriction);
+	}
+	for (const auto i : this->residuals) {
+		this->classes[this->roots[i]].residual = true;
+	}
+
+	for (std::size_t i = 0; i < this->vars.size(); ++i) {
+		if (this->roots[i] == i && !this->narrow(this->classes[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+auto Unifier::narrow(Class& c) const -> bool {
+	if (c.conflict) {
+		return false;
+	}
+
+	// Start from the smallest known set, and intersect it with the others
+	auto& candidates = c.candidates;
+	if (c.bound.has_value()) {
+		candidates.push_back(*c.bound);
+	} else if (!c.literals.empty()) {
+		candidates = this->literalDomains.at(c.literals.front()).all;
+	} else if (!c.restrictions.empty()) {
+		candidates = this->restrictionDomains.at(c.restrictions.front());
+	} else {
+		c.unrestricted = true;
+		return !this->universe.empty();
+	}
+
+	const auto rejected = [&](const std::string& type) {
+		if (this->universeSet.find(type) == this->universeSet.end()) {
+			return true;
+		}
+		for (const auto kind : c.literals) {
+			if (!contains(this->literalDomains.at(kind).all, type)) {
+				return true;
+			}
+		}
+		for (const auto restriction : c.restrictions) {
+			if (!contains(this->restrictionDomains.at(restriction), type)) {
+				return true;
+			}
+		}
+		return false;
+	};
+	candidates.erase(std::remove_if(candidates.begin(), candidates.end(), rejected), candidates.end());
+
+	// Literal defaults, the type preferred by most of the protocols wins
+	if (c.literals.size() > 0) {
+		const auto penalty = [&](const std::string& type) {
+			std::size_t sum = 0;
+			for (const auto kind : c.literals) {
+				sum += contains(this->literalDomains.at(kind).preferred, type) ? 0 : 1;
+			}
+			return sum;
+		};
+		std::stable_sort(candidates.begin(), candidates.end(), [&](const std::string& a, const std::string& b) {
+			return penalty(a) < penalty(b);
+		});
+	}
+
+	return !candidates.empty();
+}
+
+auto Unifier::index(const TypeVar& var) const -> UnionFind::IndexType {
+	return this->indices.at(var.id());
+}
+
+auto Unifier::variables() const noexcept -> const std::vector<TypeVar>& {
+	return this->vars;
+}
+
+auto Unifier::representative(const TypeVar& var) const -> const TypeVar& {
+	return this->vars.at(this->roots.at(this->index(var)));
+}
+
+auto Unifier::isResidual(const TypeVar& var) const -> bool {
+	return this->classes.at(this->roots.at(this->index(var))).residual;
+}
+
+auto Unifier::candidates(const TypeVar& var) const -> const Domain& {
+	const auto& c = this->classes.at(this->roots.at(this->index(var)));
+	return c.unrestricted ? this->universe : c.candidates;
+}
+
+auto Unifier::literals(const TypeVar& var) const -> const std::vector<KnownProtocolKind::LiteralProtocol>& {
+	return this->classes.at(this->roots.at(this->index(var))).literals;
+}
+
+auto Unifier::value(const TypeVar& var) const -> const std::string& {
+	return this->candidates(var).front();
+}
+
+auto Unifier::prune(const TypeVar& var, const std::function<bool(const std::string&)>& keep) -> std::size_t {
+	auto& c = this->classes.at(this->roots.at(this->index(var)));
+	if (c.unrestricted) {
+		c.candidates = this->universe;
+		c.unrestricted = false;
+	}
+
+	const auto before = c.candidates.size();
+	c.candidates.erase(std::remove_if(c.candidates.begin(), c.candidates.end(), [&keep](const std::string& type) {
+		return !keep(type);
+	}), c.candidates.end());
+	return before - c.candidates.size();
+}
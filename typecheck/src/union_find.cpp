@@ -0,0 +1,48 @@
+#include <typecheck/union_find.hpp>
+
+#include <utility>
+
+using namespace typecheck;
+
+auto UnionFind::add() -> IndexType {
+	const auto index = this->parent.size();
+	this->parent.push_back(index);
+	this->sizes.push_back(1);
+	return index;
+}
+
+auto UnionFind::find(IndexType i) -> IndexType {
+	while (this->parent.at(i) != i) {
+		// Path halving, every other node points to its grandparent
+		this->parent[i] = this->parent[this->parent[i]];
+		i = this->parent[i];
+	}
+	return i;
+}
+
+auto UnionFind::merge(IndexType a, IndexType b) -> IndexType {
+	a = this->find(a);
+	b = this->find(b);
+	if (a == b) {
+		return a;
+	}
+
+	if (this->sizes[a] < this->sizes[b]) {
+		std::swap(a, b);
+	}
+	this->parent[b] = a;
+	this->sizes[a] += this->sizes[b];
+	return a;
+}
+
+auto UnionFind::same(IndexType a, IndexType b) -> bool {
+	return this->find(a) == this->find(b);
+}
+
+auto UnionFind::size() const noexcept -> std::size_t {
+	return this->parent.size();
+}
+
+auto UnionFind::setSize(IndexType i) -> std::size_t {
+	return this->sizes.at(this->find(i));
+}
@@ -16,6 +16,32 @@ TEST_CASE("test resolve bindto conflicting full", "[constraints]") {
     REQUIRE(!tm.solve());
 }
 
+TEST_CASE("test resolve bindto conflicting through equals", "[constraints]") {
+    getDefaultTypeManager(tm);
+    auto T1 = tm.CreateTypeVar();
+    auto T2 = tm.CreateTypeVar();
+    auto T3 = tm.CreateTypeVar();
+
+    tm.CreateBindToConstraint(T1, tm.getRegisteredType("int"));
+    tm.CreateBindToConstraint(T3, tm.getRegisteredType("float"));
+    tm.CreateEqualsConstraint(T1, T2);
+    tm.CreateEqualsConstraint(T2, T3);
+
+    REQUIRE(!tm.solve());
+}
+
+TEST_CASE("test resolve bindto conflicting literal", "[constraints]") {
+    getDefaultTypeManager(tm);
+    auto T1 = tm.CreateTypeVar();
+    auto T2 = tm.CreateTypeVar();
+
+    tm.CreateBindToConstraint(T1, tm.getRegisteredType("int"));
+    tm.CreateLiteralConformsToConstraint(T2, typecheck::KnownProtocolKind::ExpressibleByFloat);
+    tm.CreateEqualsConstraint(T1, T2);
+
+    REQUIRE(!tm.solve());
+}
+
 TEST_CASE("solve basic type int equals constraint", "[constraint]") {
     getDefaultTypeManager(tm);
 
@@ -157,6 +183,40 @@ TEST_CASE("solve convertible bind reverse constraint", "[constraint]") {
     REQUIRE(solution.has_value());
 }
 
+TEST_CASE("solve convertible transitive constraint", "[constraint]") {
+    typecheck::TypeManager tm;
+    tm.registerType("int");
+    tm.registerType("float");
+    tm.registerType("double");
+    tm.setConvertible("int", "float");
+    tm.setConvertible("float", "double");
+
+    auto T1 = tm.CreateTypeVar();
+    auto T2 = tm.CreateTypeVar();
+
+    tm.CreateBindToConstraint(T1, tm.getRegisteredType("int"));
+    tm.CreateBindToConstraint(T2, tm.getRegisteredType("double"));
+    tm.CreateConvertibleConstraint(T1, T2);
+
+    REQUIRE(tm.solve().has_value());
+}
+
+TEST_CASE("solve convertible pruned constraint", "[constraint]") {
+    getDefaultTypeManager(tm);
+
+    auto T1 = tm.CreateTypeVar();
+    auto T2 = tm.CreateTypeVar();
+    auto T3 = tm.CreateTypeVar();
+
+    // double -> T2 -> int, nothing converts to int but itself
+    tm.CreateBindToConstraint(T1, tm.getRegisteredType("double"));
+    tm.CreateBindToConstraint(T3, tm.getRegisteredType("int"));
+    tm.CreateConvertibleConstraint(T1, T2);
+    tm.CreateConvertibleConstraint(T2, T3);
+
+    REQUIRE(!tm.solve());
+}
+
 TEST_CASE("solve convertible conversion explicit constraint", "[constraint]") {
     getDefaultTypeManager(tm);
 
@@ -318,6 +378,103 @@ TEST_CASE("solve function same num args different types application constraint",
     CHECK(solution->getResolvedType(T.at(2)).raw().name() == "double");
 }
 
+TEST_CASE("solve independent function applications constraint", "[constraint]") {
+    getDefaultTypeManager(tm);
+
+    // Enough residual constraints for the components to be searched on threads
+    const std::size_t numFunctions = 64;
+    const auto T = CreateMultipleSymbols(tm, 3 * numFunctions);
+
+    // func f<i>(a: Int) -> Double, func f<i>(a: Float) -> Float, each called with an integer literal
+    for (std::size_t i = 0; i < numFunctions; ++i) {
+        const auto name = "f" + std::to_string(i);
+        tm.CreateApplicableFunctionConstraint(tm.CreateFunctionHash(name, {"a"}), { tm.getRegisteredType("int") }, tm.getRegisteredType("double"));
+        tm.CreateApplicableFunctionConstraint(tm.CreateFunctionHash(name, {"a"}), { tm.getRegisteredType("float") }, tm.getRegisteredType("float"));
+
+        tm.CreateBindFunctionConstraint(tm.CreateFunctionHash(name, {"a"}), T.at(3 * i), { T.at(3 * i + 1) }, T.at(3 * i + 2));
+        tm.CreateLiteralConformsToConstraint(T.at(3 * i + 1), typecheck::KnownProtocolKind::ExpressibleByInteger);
+    }
+
+    const auto solution = tm.solve();
+    REQUIRE(solution.has_value());
+    for (std::size_t i = 0; i < numFunctions; ++i) {
+        REQUIRE(solution->getResolvedType(T.at(3 * i)).has_func());
+        CHECK(solution->getResolvedType(T.at(3 * i)).func().id() == tm.CreateFunctionHash("f" + std::to_string(i), {"a"}));
+        CHECK(solution->getResolvedType(T.at(3 * i + 1)).raw().name() == "int");
+        CHECK(solution->getResolvedType(T.at(3 * i + 2)).raw().name() == "double");
+    }
+}
+
+TEST_CASE("solve repeated function applications constraint", "[constraint]") {
+    getDefaultTypeManager(tm);
+    tm.registerType("void");
+
+    // func print(a: Int) -> Void, func print(a: Float) -> Void
+    const auto print = tm.CreateFunctionHash("print", {"a"});
+    tm.CreateApplicableFunctionConstraint(print, { tm.getRegisteredType("int") }, tm.getRegisteredType("void"));
+    tm.CreateApplicableFunctionConstraint(print, { tm.getRegisteredType("float") }, tm.getRegisteredType("void"));
+
+    const std::size_t numCalls = 2000;
+    const auto T = CreateMultipleSymbols(tm, 3 * numCalls);
+    for (std::size_t i = 0; i < numCalls; ++i) {
+        tm.CreateBindToConstraint(T.at(3 * i + 1), tm.getRegisteredType(i % 2 == 0 ? "int" : "float"));
+        tm.CreateBindFunctionConstraint(print, T.at(3 * i), { T.at(3 * i + 1) }, T.at(3 * i + 2));
+    }
+
+    const auto solution = tm.solve();
+    REQUIRE(solution.has_value());
+    for (std::size_t i = 0; i < numCalls; ++i) {
+        const auto func = solution->getResolvedType(T.at(3 * i));
+        REQUIRE(func.has_func());
+        REQUIRE(func.func().args_size() == 1);
+        CHECK(func.func().args(0).raw().name() == (i % 2 == 0 ? "int" : "float"));
+        CHECK(solution->getResolvedType(T.at(3 * i + 2)).raw().name() == "void");
+    }
+}
+
+TEST_CASE("solve nested function applications constraint", "[constraint]") {
+    getDefaultTypeManager(tm);
+
+    // func g(a: Int) -> Float, func g(a: Float) -> Int
+    const auto g = tm.CreateFunctionHash("g", {"a"});
+    tm.CreateApplicableFunctionConstraint(g, { tm.getRegisteredType("int") }, tm.getRegisteredType("float"));
+    tm.CreateApplicableFunctionConstraint(g, { tm.getRegisteredType("float") }, tm.getRegisteredType("int"));
+
+    // g(g(x)), with x: Int
+    const auto T = CreateMultipleSymbols(tm, 5);
+    tm.CreateBindToConstraint(T.at(0), tm.getRegisteredType("int"));
+    tm.CreateBindFunctionConstraint(g, T.at(3), { T.at(2) }, T.at(4));
+    tm.CreateBindFunctionConstraint(g, T.at(1), { T.at(0) }, T.at(2));
+
+    const auto solution = tm.solve();
+    REQUIRE(solution.has_value());
+    CHECK(solution->getResolvedType(T.at(2)).raw().name() == "float");
+    CHECK(solution->getResolvedType(T.at(4)).raw().name() == "int");
+}
+
+TEST_CASE("solve long chain of function applications constraint", "[constraint]") {
+    getDefaultTypeManager(tm);
+
+    // func g(a: Int) -> Float, func g(a: Float) -> Int
+    const auto g = tm.CreateFunctionHash("g", {"a"});
+    tm.CreateApplicableFunctionConstraint(g, { tm.getRegisteredType("int") }, tm.getRegisteredType("float"));
+    tm.CreateApplicableFunctionConstraint(g, { tm.getRegisteredType("float") }, tm.getRegisteredType("int"));
+
+    // g(g(...g(x))), with x: Int and the outermost call first
+    const std::size_t depth = 2000;
+    const auto T = CreateMultipleSymbols(tm, 2 * depth + 1);
+    tm.CreateBindToConstraint(T.at(0), tm.getRegisteredType("int"));
+    for (std::size_t i = depth; i > 0; --i) {
+        tm.CreateBindFunctionConstraint(g, T.at(2 * i - 1), { T.at(2 * i - 2) }, T.at(2 * i));
+    }
+
+    const auto solution = tm.solve();
+    REQUIRE(solution.has_value());
+    for (std::size_t i = 1; i <= depth; ++i) {
+        CHECK(solution->getResolvedType(T.at(2 * i)).raw().name() == (i % 2 == 1 ? "float" : "int"));
+    }
+}
+
 TEST_CASE("solve function infer args later constraint", "[constraint]") {
     getDefaultTypeManager(tm);
     tm.registerType("void");
@@ -721,3 +878,5 @@ CREATE_STRESS_TEST(200)
 CREATE_STRESS_TEST(300)
 CREATE_STRESS_TEST(400)
 CREATE_STRESS_TEST(800)
+CREATE_STRESS_TEST(10000)
+CREATE_STRESS_TEST(100000)
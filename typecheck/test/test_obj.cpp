@@ -1,5 +1,9 @@
 #include "test_include_catch.hpp"
 #include <typecheck/type.hpp>
+#include <typecheck/constraint.hpp>
+#include <typecheck/interner.hpp>
+#include <typecheck/union_find.hpp>
+#include <typecheck/bit_matrix.hpp>
 
 TEST_CASE("Check raw type copy constructor", "[raw_type]") {
 	typecheck::RawType t;
@@ -156,3 +160,117 @@ TEST_CASE("Copy Type Constructor", "[type]") {
 	CHECK(g.func().returntype().has_raw());
 	CHECK(g.func().returntype().raw().name() == "Hello world");
 }
+
+TEST_CASE("Interned var ids", "[type_var]") {
+	typecheck::TypeVar t{"Interned A"};
+	typecheck::TypeVar g{"Interned A"};
+	typecheck::TypeVar h{"Interned B"};
+	CHECK(t.id() == g.id());
+	CHECK(t.id() != h.id());
+	CHECK(t == g);
+	CHECK(t != h);
+	CHECK(std::hash<typecheck::TypeVar>()(t) == std::hash<typecheck::TypeVar>()(g));
+
+	h.set_symbol("Interned A");
+	CHECK(h.id() == t.id());
+	CHECK(h.symbol() == "Interned A");
+}
+
+TEST_CASE("Empty var id", "[type_var]") {
+	typecheck::TypeVar t;
+	CHECK(t.id() == typecheck::Interner::EmptyID);
+	CHECK(t.symbol().empty());
+}
+
+TEST_CASE("Raw type from id", "[raw_type]") {
+	typecheck::RawType t{"Hello World"};
+	const auto g = typecheck::RawType::FromID(t.id());
+	CHECK(g == t);
+	CHECK(g.name() == "Hello World");
+}
+
+TEST_CASE("Interner find", "[interner]") {
+	typecheck::Interner interner;
+	CHECK(!interner.find("foo").has_value());
+	const auto id = interner.intern("foo");
+	CHECK(interner.find("foo") == id);
+	CHECK(interner.intern("foo") == id);
+	CHECK(interner.name(id) == "foo");
+	CHECK(interner.intern("") == typecheck::Interner::EmptyID);
+	CHECK(interner.size() == 2);
+}
+
+TEST_CASE("Structural type hash", "[type]") {
+	typecheck::Type t;
+	t.mutable_func()->set_name("foo");
+	t.mutable_func()->add_args()->mutable_raw()->set_name("int");
+	t.mutable_func()->mutable_returntype()->mutable_raw()->set_name("float");
+
+	typecheck::Type g{t};
+	CHECK(g == t);
+	CHECK(g.hash() == t.hash());
+
+	typecheck::Type raw;
+	raw.mutable_raw()->set_name("foo");
+	CHECK(raw.hash() != t.hash());
+}
+
+TEST_CASE("Constraint equals", "[constraint]") {
+	typecheck::Constraint c;
+	c.set_id(1);
+	c.set_kind(typecheck::ConstraintKind::Equal);
+	c.mutable_types()->mutable_first()->set_symbol("T1");
+	c.mutable_types()->mutable_second()->set_symbol("T2");
+
+	typecheck::Constraint d{c};
+	CHECK(c == d);
+
+	d.mutable_types()->mutable_second()->set_symbol("T3");
+	CHECK(!(c == d));
+}
+
+TEST_CASE("Union find", "[union_find]") {
+	typecheck::UnionFind sets;
+	const auto a = sets.add();
+	const auto b = sets.add();
+	const auto c = sets.add();
+	const auto d = sets.add();
+	CHECK(sets.size() == 4);
+	CHECK(!sets.same(a, b));
+
+	sets.merge(a, b);
+	sets.merge(c, d);
+	CHECK(sets.same(a, b));
+	CHECK(!sets.same(b, c));
+	CHECK(sets.setSize(a) == 2);
+
+	sets.merge(b, d);
+	CHECK(sets.same(a, c));
+	CHECK(sets.find(a) == sets.find(d));
+	CHECK(sets.setSize(c) == 4);
+}
+
+TEST_CASE("Bit matrix", "[bit_matrix]") {
+	typecheck::BitMatrix matrix;
+	matrix.resize(70);
+	CHECK(matrix.size() == 70);
+	CHECK(!matrix.test(0, 69));
+
+	matrix.set(0, 69);
+	matrix.set(1, 2);
+	CHECK(matrix.test(0, 69));
+	CHECK(!matrix.merge(0, 0));
+	CHECK(matrix.merge(0, 1));
+	CHECK(matrix.test(0, 2));
+
+	// Growing keeps the bits that are set
+	matrix.resize(130);
+	CHECK(matrix.test(0, 69));
+	CHECK(!matrix.test(0, 129));
+	CHECK(!matrix.test(200, 0));
+
+	auto row = matrix.emptyRow();
+	typecheck::BitMatrix::set(row, 69);
+	CHECK(typecheck::BitMatrix::intersects(row, matrix.row(0)));
+	CHECK(!typecheck::BitMatrix::intersects(row, matrix.row(1)));
+}
@@ -70,3 +70,24 @@ TEST_CASE("load basic type conversions", "[type_manager]") {
     CHECK(!tm.isConvertible("float", "int"));
     CHECK(!tm.isConvertible("double", "float"));
 }
+
+TEST_CASE("load transitive type conversions", "[type_manager]") {
+    typecheck::TypeManager tm;
+    CHECK(tm.registerType("int"));
+    CHECK(tm.registerType("float"));
+    CHECK(tm.registerType("double"));
+    CHECK(tm.setConvertible("float", "double"));
+    CHECK(!tm.isConvertible("int", "double"));
+
+    // Edges added later extend the closure of earlier ones
+    CHECK(tm.setConvertible("int", "float"));
+    CHECK(!tm.setConvertible("int", "float"));
+    CHECK(tm.isConvertible("int", "double"));
+    CHECK(!tm.isConvertible("double", "int"));
+
+    // Types registered afterwards join the closure too
+    CHECK(tm.registerType("long double"));
+    CHECK(tm.setConvertible("double", "long double"));
+    CHECK(tm.isConvertible("int", "long double"));
+    CHECK(tm.getConvertible(tm.getRegisteredType("int")).size() == 3);
+}